@@ -41,12 +41,14 @@
 #include "ticcutils/StringOps.h"
 #include "ticcutils/XMLtools.h"
 #include "libfolia/folia.h"
+#include "tscan/tokens.h"
 
 enum DD_type { SUB_VERB, OBJ1_VERB, OBJ2_VERB, VERB_PP, VERB_VC,
 	       VERB_COMP, NOUN_DET, PREP_OBJ1, CRD_CNJ, COMP_BODY, NOUN_VC,
 	       VERB_SVP, VERB_PREDC_N, VERB_PREDC_A, VERB_MOD_BW,
 	       VERB_MOD_A, VERB_NOUN };
 
+double MMaverage( const std::multimap<DD_type, int>& mm, DD_type t );
 std::string MMtoString( const std::multimap<DD_type, int>& mm, DD_type t );
 std::string MMtoString( const std::multimap<DD_type, int>& mm );
 void aggregate( std::multimap<DD_type,int>& out, const std::multimap<DD_type,int>& in );
@@ -70,7 +72,7 @@ bool checkImp( const xmlNode * );
 bool checkModifier( const xmlNode * );
 void countCrdCnj( xmlDoc *, int&, int& );
 void mod_stats( xmlDoc *, int&, int& );
-int get_d_level( const folia::Sentence *s, xmlDoc *alp );
+int get_d_level( const tokenTable&, xmlDoc *alp );
 int indef_npcount( xmlDoc *alp );
 WWform classifyVerb( const xmlNode *, const std::string&, std::string& );
 std::multimap<DD_type, int> getDependencyDist( const xmlNode *,
@@ -0,0 +1,85 @@
+#ifndef ANALYZER_H
+#define ANALYZER_H
+
+#include <string>
+#include <vector>
+#include <memory>
+#include "libfolia/folia.h"
+#include "tscan/compress.h"
+
+struct docStats;
+
+/*
+ * The analysis of tscan as a library, libtscan. An Analyzer reads the
+ * configuration and its lexicons once; after that documents can be
+ * analysed from several threads at the same time, as the workers of
+ * 'tscan --serve' do. A document is a text, which is tagged by Frog, or
+ * a FoLiA document that Frog tagged before.
+ *
+ * The settings are shared by the whole process, so there can only be
+ * one Analyzer at a time. Logging and profiling are set up with the
+ * Log and Profile namespaces, see log.h and profile.h.
+ */
+namespace TScan {
+
+    // the changes to the configuration that the tscan options make
+    struct options {
+        options():
+            sentencePerLine( false ),
+            compression( Compress::NONE ),
+            profileMetadata( false ){};
+        std::string groups;         // --groups, empty for the configured ones
+        std::string skip;           // --skip
+        bool sentencePerLine;       // -n
+        Compress::Type compression; // --compress
+        std::string columnsPrefix;  // --columns
+        bool profileMetadata;       // --profile-metadata
+    };
+
+    // the outputs of one document, in memory
+    struct result {
+        std::string folia;
+        // the document, paragraph, sentence and word tables, when wanted
+        std::string csv[4];
+    };
+
+    class Analyzer {
+    public:
+        // Reads the configuration file and the lexicons it names. Throws
+        // a runtime_error when they are invalid, and a logic_error when
+        // there is an Analyzer already.
+        explicit Analyzer( const std::string&, const options& = options() );
+        // saves the Alpino parses, when configured
+        ~Analyzer();
+        Analyzer( const Analyzer& ) = delete;
+        Analyzer& operator=( const Analyzer& ) = delete;
+
+        // Adds the metrics to a document tagged by Frog and returns its
+        // statistics, which refer to the document. They also refer to
+        // the strings interned by the calling thread, so use them before
+        // that thread analyses another document.
+        std::unique_ptr<docStats> analyse( folia::Document*,
+                                           const std::string& ) const;
+        // Analyses a text or a FoLiA document, named after 'name' in the
+        // tables, and serialises the results. The tables are only made
+        // when asked for. Returns false, with a message, on failure.
+        bool analyse( const std::string&, const std::string&, bool,
+                      result&, std::string& ) const;
+        // Analyses a file and saves the FoLiA output, and the tables
+        // when asked for; the names of the files saved are added to
+        // 'outputs'. Returns false, with a message, on failure.
+        bool analyseFile( const std::string&, const std::string&, bool,
+                          std::vector<std::string>&, std::string& ) const;
+
+        const std::string& configFile() const { return configName; };
+        // whether the tables are wanted, as configured
+        bool tablesWanted() const;
+        Compress::Type compression() const;
+
+    private:
+        void init( const options& );
+        std::string configName;
+    };
+}
+
+#endif /* ANALYZER_H */
@@ -23,9 +23,26 @@ namespace CGN {
     enum Position {
         NOMIN, PRENOM, VRIJ, NOPOS
     };
+    Position toPosition( const std::string& );
     std::string toString(Position);
     std::ostream& operator<<( std::ostream& os, const Position& p );
 
+    // the Frog features that are inspected per word, decoded once
+    enum WVorm {
+        NO_WVORM, WV_PV, WV_INF, WV_VD, WV_OD, WV_UNKNOWN
+    };
+    WVorm toWVorm( const std::string& );
+
+    enum PvTijd {
+        NO_PVTIJD, TGW, VERL, CONJ
+    };
+    PvTijd toPvTijd( const std::string& );
+
+    enum ConjType {
+        NO_CONJTYPE, NEVEN, ONDER
+    };
+    ConjType toConjType( const std::string& );
+
 }
 
 #endif	/* CGN_H */
@@ -0,0 +1,67 @@
+#ifndef COLUMNS_H
+#define COLUMNS_H
+
+#include <string>
+#include <vector>
+#include <unordered_map>
+#include <cstdint>
+#include "tscan/csv.h"
+
+/*
+ * The columnar output: a binary alternative to the CSV files that needs
+ * no parsing. The tables of many documents can be appended to one file,
+ * each document as a block that describes itself:
+ *
+ *   "TSCB"
+ *   uint32  version, 1 (a reader that sees 0x01000000 must swap bytes)
+ *   uint64  the size of the rest of the block, in bytes
+ *   string  the document
+ *   uint64  rows
+ *   uint32  columns
+ *   per column:
+ *     string  name
+ *     uint8   type: 0 integer, 1 real, 2 text
+ *     integer: rows x int64, NA is INT64_MIN (as in R)
+ *     real:    rows x float64, NA is NaN
+ *     text:    uint32 n, n strings, rows x uint32 index, NA is 0xFFFFFFFF
+ *
+ * A string is a uint32 length followed by that many bytes of UTF-8.
+ * Numbers are in the byte order of the machine, little endian in practice.
+ * When the name of the file ends in .gz or .zst, each block is compressed
+ * on its own, as a gzip member or zstd frame, which may be concatenated.
+ * A block is only written when complete, and while holding an flock on
+ * the file, so several runs can append to the same file at once. A run
+ * that is killed while writing may leave a truncated block at the end of
+ * the file, which a reader can recognise by its size. tests/columns has
+ * a reader.
+ */
+
+class columnFile: public tableFile {
+public:
+    columnFile(): rows( 0 ), cur( 0 ) {};
+    bool open( const std::string&, const std::string& );
+    bool close() override;
+private:
+    struct colData {
+        std::string name;
+        colType type;
+        std::vector<int64_t> ints;
+        std::vector<double> reals;
+        std::vector<uint32_t> codes;
+        std::vector<std::string> words;
+        std::unordered_map<std::string,uint32_t> dict;
+    };
+    colData& next();
+    void column( const char *, colType ) override;
+    void na() override;
+    void text( const std::string&, bool ) override;
+    void real( double ) override;
+    void integer( long long ) override;
+    void endLine( size_t, bool ) override;
+    std::string document_name;
+    std::vector<colData> cols;
+    uint64_t rows;
+    size_t cur;
+};
+
+#endif /* COLUMNS_H */
@@ -0,0 +1,51 @@
+#ifndef COMPRESS_H
+#define COMPRESS_H
+
+#include <string>
+
+/*
+ * Compressed output and input. What an output file is compressed with
+ * follows from the extension of its name: '.gz' for gzip and '.zst' for
+ * zstd. Input files are recognised by their first bytes, whatever their
+ * name. zstd is only available when tscan was configured with libzstd.
+ */
+namespace Compress {
+
+    enum Type { NONE, GZIP, ZSTD };
+
+    // parses the value of --compress: 'none', 'gz' or 'zstd'
+    bool parse( const std::string&, Type& );
+    bool available( Type );
+    // the extension for a type, including the dot
+    std::string extension( Type );
+    // the type an output file with this name should get
+    Type byName( const std::string& );
+
+    // Compresses data in pieces. Every compressor writes one gzip member or
+    // zstd frame; these may be concatenated in one file.
+    class compressor {
+    public:
+        explicit compressor( Type );
+        ~compressor();
+        // compresses the data, appending the result to out
+        void add( const char *, size_t, std::string& out );
+        // ends the member or frame, appending the rest to out
+        void finish( std::string& out );
+    private:
+        compressor( const compressor& ) = delete;
+        compressor& operator=( const compressor& ) = delete;
+        void run( const char *, size_t, std::string&, bool );
+        Type type;
+        void *state;
+    };
+
+    // writes data to a file, compressed as its name says, under a
+    // temporary name that is renamed when done
+    bool writeFile( const std::string&, const std::string& );
+    // true when the file starts as gzip or zstd data
+    bool isCompressed( const std::string& );
+    // reads a whole file, decompressing it when needed
+    bool readFile( const std::string&, std::string& );
+}
+
+#endif /* COMPRESS_H */
@@ -0,0 +1,303 @@
+#ifndef COUNTERS_H
+#define COUNTERS_H
+
+/*
+ * Schema of the structStats counters that are plain sums over the
+ * children of a node. Each list is expanded (X-macro style) into an enum
+ * that indexes the arrays holding the sums, a table of their names and a
+ * named accessor per counter, so a counter is added by listing it here.
+ * structStats::merge adds up the arrays in one loop each. Counters with
+ * any other merge rule are NOT listed here.
+ */
+
+#define STRUCT_INT_SUMS(X) \
+  X(wordCnt) \
+  X(wordInclCnt) /* wordCnt including stopwords */ \
+  X(vdBvCnt) \
+  X(vdNwCnt) \
+  X(vdVrijCnt) \
+  X(odBvCnt) \
+  X(odNwCnt) \
+  X(odVrijCnt) \
+  X(infBvCnt) \
+  X(infNwCnt) \
+  X(infVrijCnt) \
+  X(smainCnt) \
+  X(ssubCnt) \
+  X(sv1Cnt) \
+  X(clauseCnt) \
+  X(correctedClauseCnt) \
+  X(smainCnjCnt) \
+  X(ssubCnjCnt) \
+  X(sv1CnjCnt) \
+  X(presentCnt) \
+  X(pastCnt) \
+  X(subjonctCnt) \
+  X(nameCnt) \
+  X(nameInclCnt) /* nameCnt including stopwords */ \
+  X(pron1Cnt) \
+  X(pron2Cnt) \
+  X(pron3Cnt) \
+  X(passiveCnt) \
+  X(modalCnt) \
+  X(timeVCnt) \
+  X(koppelCnt) \
+  X(persRefCnt) \
+  X(pronRefCnt) \
+  X(archaicsCnt) \
+  X(contentCnt) \
+  X(contentInclCnt) /* contentCnt including stopwords */ \
+  X(contentStrictCnt) \
+  X(contentStrictInclCnt) /* contentStrictCnt including stopwords */ \
+  X(nominalCnt) \
+  X(adjCnt) \
+  X(adjInclCnt) /* adjCnt including stopwords */ \
+  X(vgCnt) \
+  X(vnwCnt) \
+  X(lidCnt) \
+  X(vzCnt) \
+  X(bwCnt) \
+  X(twCnt) \
+  X(nounCnt) \
+  X(nounInclCnt) /* nounCnt including stopwords */ \
+  X(verbCnt) \
+  X(verbInclCnt) /* verbCnt including stopwords */ \
+  X(tswCnt) \
+  X(specCnt) \
+  X(letCnt) \
+  X(betrCnt) \
+  X(bijwCnt) \
+  X(complCnt) \
+  X(mvFinInbedCnt) \
+  X(infinComplBepCnt) \
+  X(mvInbedCnt) \
+  X(losBetrCnt) \
+  X(losBijwCnt) \
+  X(allConnCnt) \
+  X(tempConnCnt) \
+  X(opsomWgConnCnt) \
+  X(opsomZinConnCnt) \
+  X(contrastConnCnt) \
+  X(compConnCnt) \
+  X(causeConnCnt) \
+  X(timeSitCnt) \
+  X(spaceSitCnt) \
+  X(causeSitCnt) \
+  X(emoSitCnt) \
+  X(propNegCnt) \
+  X(morphNegCnt) \
+  X(multiNegCnt) \
+  X(wordOverlapCnt) \
+  X(lemmaOverlapCnt) \
+  X(prevalenceCovered) \
+  X(prevalenceContentCovered) \
+  X(f50Cnt) \
+  X(f65Cnt) \
+  X(f77Cnt) \
+  X(f80Cnt) \
+  X(top1000Cnt) \
+  X(top2000Cnt) \
+  X(top3000Cnt) \
+  X(top5000Cnt) \
+  X(top10000Cnt) \
+  X(top20000Cnt) \
+  X(top1000ContentCnt) \
+  X(top2000ContentCnt) \
+  X(top3000ContentCnt) \
+  X(top5000ContentCnt) \
+  X(top10000ContentCnt) \
+  X(top20000ContentCnt) \
+  X(top1000ContentStrictCnt) \
+  X(top2000ContentStrictCnt) \
+  X(top3000ContentStrictCnt) \
+  X(top5000ContentStrictCnt) \
+  X(top10000ContentStrictCnt) \
+  X(top20000ContentStrictCnt) \
+  X(intensCnt) \
+  X(intensBvnwCnt) \
+  X(intensBvbwCnt) \
+  X(intensBwCnt) \
+  X(intensCombiCnt) \
+  X(intensNwCnt) \
+  X(intensTussCnt) \
+  X(intensWwCnt) \
+  X(formalCnt) \
+  X(formalBvnwCnt) \
+  X(formalBwCnt) \
+  X(formalVgwCnt) \
+  X(formalVnwCnt) \
+  X(formalVzCnt) \
+  X(formalVzgCnt) \
+  X(formalWwCnt) \
+  X(formalZnwCnt) \
+  X(generalNounCnt) \
+  X(generalNounSepCnt) \
+  X(generalNounRelCnt) \
+  X(generalNounActCnt) \
+  X(generalNounKnowCnt) \
+  X(generalNounDiscCnt) \
+  X(generalNounDeveCnt) \
+  X(generalVerbCnt) \
+  X(generalVerbSepCnt) \
+  X(generalVerbRelCnt) \
+  X(generalVerbActCnt) \
+  X(generalVerbKnowCnt) \
+  X(generalVerbDiscCnt) \
+  X(generalVerbDeveCnt) \
+  X(generalAdverbCnt) \
+  X(specificAdverbCnt) \
+  X(broadNounCnt) \
+  X(strictNounCnt) \
+  X(broadAdjCnt) \
+  X(strictAdjCnt) \
+  X(subjectiveAdjCnt) \
+  X(abstractWwCnt) \
+  X(concreteWwCnt) \
+  X(undefinedWwCnt) \
+  X(undefinedATPCnt) \
+  X(stateCnt) \
+  X(actionCnt) \
+  X(processCnt) \
+  X(humanAdjCnt) \
+  X(emoAdjCnt) \
+  X(nonhumanAdjCnt) \
+  X(shapeAdjCnt) \
+  X(colorAdjCnt) \
+  X(matterAdjCnt) \
+  X(soundAdjCnt) \
+  X(nonhumanOtherAdjCnt) \
+  X(techAdjCnt) \
+  X(timeAdjCnt) \
+  X(placeAdjCnt) \
+  X(specPosAdjCnt) \
+  X(specNegAdjCnt) \
+  X(posAdjCnt) \
+  X(negAdjCnt) \
+  X(evaluativeAdjCnt) \
+  X(epiPosAdjCnt) \
+  X(epiNegAdjCnt) \
+  X(abstractAdjCnt) \
+  X(undefinedNounCnt) \
+  X(uncoveredNounCnt) \
+  X(undefinedAdjCnt) \
+  X(uncoveredAdjCnt) \
+  X(uncoveredVerbCnt) \
+  X(humanCnt) \
+  X(nonHumanCnt) \
+  X(artefactCnt) \
+  X(concrotherCnt) \
+  X(substanceConcCnt) \
+  X(foodcareCnt) \
+  X(timeCnt) \
+  X(placeCnt) \
+  X(measureCnt) \
+  X(dynamicConcCnt) \
+  X(substanceAbstrCnt) \
+  X(dynamicAbstrCnt) \
+  X(nonDynamicCnt) \
+  X(institutCnt) \
+  X(npCnt) \
+  X(indefNpCnt) \
+  X(npSize) \
+  X(vcModCnt) \
+  X(vcModSingleCnt) \
+  X(adjNpModCnt) \
+  X(npModCnt) \
+  X(smallCnjCnt) \
+  X(smallCnjExtraCnt) \
+  X(dLevel_gt4) \
+  X(impCnt) \
+  X(questCnt) \
+  X(prepExprCnt) \
+  X(nerCnt) \
+  X(compoundCnt) \
+  X(compound3Cnt) \
+  X(charCntNoun) \
+  X(charCntNonComp) \
+  X(charCntComp) \
+  X(charCntHead) \
+  X(charCntSat) \
+  X(charCntNounCorr) \
+  X(charCntCorr) \
+  X(top1000CntNoun) \
+  X(top1000CntNonComp) \
+  X(top1000CntComp) \
+  X(top1000CntHead) \
+  X(top1000CntSat) \
+  X(top1000CntNounCorr) \
+  X(top1000CntCorr) \
+  X(top5000CntNoun) \
+  X(top5000CntNonComp) \
+  X(top5000CntComp) \
+  X(top5000CntHead) \
+  X(top5000CntSat) \
+  X(top5000CntNounCorr) \
+  X(top5000CntCorr) \
+  X(top20000CntNoun) \
+  X(top20000CntNonComp) \
+  X(top20000CntComp) \
+  X(top20000CntHead) \
+  X(top20000CntSat) \
+  X(top20000CntNounCorr) \
+  X(top20000CntCorr)
+
+#define STRUCT_DOUBLE_SUMS(X) \
+  X(prevalenceP) \
+  X(prevalenceZ) \
+  X(prevalenceContentP) \
+  X(prevalenceContentZ) \
+  X(word_freq) \
+  X(word_freq_n) \
+  X(word_freq_strict) \
+  X(word_freq_n_strict) \
+  X(lemma_freq) \
+  X(lemma_freq_n) \
+  X(lemma_freq_strict) \
+  X(lemma_freq_n_strict) \
+  X(avg_prob10_fwd) \
+  X(avg_prob10_fwd_content) \
+  X(avg_prob10_fwd_ex_names) \
+  X(avg_prob10_fwd_content_ex_names) \
+  X(avg_prob10_bwd) \
+  X(avg_prob10_bwd_content) \
+  X(avg_prob10_bwd_ex_names) \
+  X(avg_prob10_bwd_content_ex_names) \
+  X(entropy_fwd) \
+  X(entropy_fwd_norm) \
+  X(entropy_bwd) \
+  X(entropy_bwd_norm) \
+  X(perplexity_fwd) \
+  X(perplexity_fwd_norm) \
+  X(perplexity_bwd) \
+  X(perplexity_bwd_norm) \
+  X(word_freq_log_noun) \
+  X(word_freq_log_non_comp) \
+  X(word_freq_log_comp) \
+  X(word_freq_log_head) \
+  X(word_freq_log_sat) \
+  X(word_freq_log_head_sat) \
+  X(word_freq_log_noun_corr) \
+  X(word_freq_log_corr) \
+  X(word_freq_log_corr_strict) \
+  X(word_freq_log_n_corr) \
+  X(word_freq_log_n_corr_strict)
+
+#define COUNTER_ENUM( name ) name,
+#define COUNTER_NAME( name ) #name,
+#define COUNTER_INT_ACCESSOR( name ) \
+  int& name() { return int_sums[Counters::name]; } \
+  int name() const { return int_sums[Counters::name]; }
+#define COUNTER_DOUBLE_ACCESSOR( name ) \
+  double& name() { return double_sums[Counters::name]; } \
+  double name() const { return double_sums[Counters::name]; }
+
+namespace Counters {
+    // the index of a counter in structStats::int_sums or double_sums
+    enum intSum { STRUCT_INT_SUMS(COUNTER_ENUM) N_INT_SUMS };
+    enum doubleSum { STRUCT_DOUBLE_SUMS(COUNTER_ENUM) N_DOUBLE_SUMS };
+    // the names of the counters, by index
+    extern const char *intNames[N_INT_SUMS];
+    extern const char *doubleNames[N_DOUBLE_SUMS];
+}
+
+#endif /* COUNTERS_H */
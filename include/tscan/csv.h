@@ -0,0 +1,106 @@
+#ifndef CSV_H
+#define CSV_H
+
+#include <string>
+#include <fstream>
+#include <memory>
+#include <type_traits>
+#include "tscan/utils.h"
+#include "tscan/compress.h"
+#include "tscan/groups.h"
+
+/*
+ * The table output. The columns of a level are listed once, by name and
+ * value, in functions that fill a csvLine: for the header line only the
+ * names (and types) are passed on, for the other lines only the values.
+ * So the header and the values can't get out of step. What is done with
+ * them depends on the tableFile: a csvFile writes text, a columnFile (see
+ * columns.h) collects typed columns. A line only holds the metric groups
+ * that were selected, see groups.h.
+ */
+
+enum colType { INT_COL, REAL_COL, TEXT_COL };
+
+class tableFile;
+
+// One line of a tableFile.
+class csvLine {
+public:
+    csvLine( tableFile&, bool, const Groups::selection& );
+    bool isHeader() const { return header; };
+    bool wants( Groups::Group g ) const { return groups.has( g ); };
+    // when set, the values of the following columns are written as NA
+    void missing( bool m ) { skip = m; };
+    // a number column that is unknown
+    void na( const char * );
+    void col( const char *, const std::string& );
+    void col( const char *, const char * );
+    void col( const char *name, const proportion& p ) { real( name, p.p ); };
+    void col( const char *name, const density& d ) { real( name, d.d ); };
+    template <typename T>
+    typename std::enable_if<std::is_arithmetic<T>::value>::type
+    col( const char *name, T val ){
+        if ( std::is_floating_point<T>::value )
+            real( name, val );
+        else
+            integer( name, val );
+    };
+    void quoted( const char *, const std::string& );
+    void end();
+private:
+    bool next( const char *, colType );
+    void real( const char *, double );
+    void integer( const char *, long long );
+    tableFile& file;
+    const Groups::selection& groups;
+    bool header;
+    bool skip;
+    size_t cols;
+};
+
+// Where the lines go.
+class tableFile {
+public:
+    virtual ~tableFile(){};
+    virtual bool close() = 0;
+    const std::string& name() const { return fname; };
+protected:
+    friend class csvLine;
+    virtual void column( const char *, colType ) = 0;
+    virtual void na() = 0;
+    virtual void text( const std::string&, bool ) = 0;
+    virtual void real( double ) = 0;
+    virtual void integer( long long ) = 0;
+    virtual void endLine( size_t, bool ) = 0;
+    std::string fname;
+};
+
+// A CSV file, written through a buffer and compressed as its name says.
+// It only gets its name when closed, see commitFile(). Or the CSV text,
+// collected in a string.
+class csvFile: public tableFile {
+public:
+    csvFile(): target( 0 ), columns( 0 ), cols( 0 ) {};
+    bool open( const std::string& );
+    // collects the (uncompressed) text in the string instead
+    void collect( std::string& );
+    bool close() override;
+private:
+    void separate() { if ( cols++ > 0 ) buf += ','; };
+    void flush( bool );
+    void column( const char *, colType ) override;
+    void na() override;
+    void text( const std::string&, bool ) override;
+    void real( double ) override;
+    void integer( long long ) override;
+    void endLine( size_t, bool ) override;
+    std::ofstream out;
+    std::string tmpName;
+    std::unique_ptr<Compress::compressor> zip;
+    std::string *target;
+    std::string buf;
+    size_t columns;
+    size_t cols;
+};
+
+#endif /* CSV_H */
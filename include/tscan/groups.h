@@ -0,0 +1,44 @@
+#ifndef GROUPS_H
+#define GROUPS_H
+
+#include <string>
+
+/*
+ * The metric groups of the CSV and columnar output. A selection of them
+ * can be made with the 'groups' setting or the --groups option; only
+ * their columns are written, and the analyses that none of them needs
+ * are skipped.
+ */
+namespace Groups {
+
+    enum Group { TOP_PREDICTORS, WORD_DIFFICULTIES, COMPOUND,
+                 SENT_DIFFICULTIES, INFORMATION_DENSITY, COHERENCE,
+                 CONCREET, PERSOONLIJKHEID, VERB, IMPERATIVE, WORD_SORT,
+                 PREP_PHRASE, INTENS, FORMAL, MISC, N_GROUPS };
+
+    // the analyses that are only done for some groups. The lexicon
+    // classifications of the words are analyses too: their counts only
+    // show up in the columns of a few groups
+    enum Analysis { WOPR = 1, COMPOUND_SPLITTER = 2, SEM_TYPES = 4,
+                    INTENSIFIERS = 8, FORMAL_WORDS = 16, GENERAL_WORDS = 32,
+                    DOC_OVERLAP = 64 };
+
+    std::string toString( Group );
+
+    class selection {
+    public:
+        // all groups
+        selection();
+        // parses a comma separated list of group names, or 'all'
+        bool parse( const std::string&, std::string& );
+        bool has( Group g ) const { return groups[g]; };
+        // true when a selected group needs the analysis
+        bool needs( Analysis ) const;
+        std::string toString() const;
+    private:
+        bool groups[N_GROUPS];
+    };
+
+}
+
+#endif /* GROUPS_H */
@@ -0,0 +1,27 @@
+#ifndef INTERN_H
+#define INTERN_H
+
+#include <string>
+#include <vector>
+#include <unordered_map>
+#include <cstdint>
+
+namespace Intern {
+
+    // 32-bit handle for an interned string. Ids are dense and handed out
+    // in order of first appearance, so they can index plain arrays.
+    typedef uint32_t Id;
+
+    // the empty string is always interned first, so its Id is 0
+    const Id EMPTY = 0;
+
+    Id intern( const std::string& );
+    const std::string& toString( Id );
+    size_t size();
+    void clear();
+
+    // counts per interned string, used for the unique_* type counters
+    typedef std::unordered_map<Id,int> Counter;
+}
+
+#endif /* INTERN_H */
@@ -0,0 +1,61 @@
+#ifndef LOG_H
+#define LOG_H
+
+#include <string>
+#include <sstream>
+
+/*
+ * The run log and problems.log. Lines are collected in a buffer per
+ * thread and written in blocks, so a busy run doesn't do a write per
+ * line; errors and warnings are written at once, and everything is
+ * written by Log::flush() and at exit.
+ *
+ * A line is logged as
+ *   TLOG( DEBUG ) << "analyse tokenized sentence=" << text;
+ * without an endl. The arguments are only evaluated when the level is
+ * enabled (see --log-level), and TRACE lines are compiled out unless
+ * tscan is configured with --enable-trace. As TLOG is an if statement,
+ * don't use it as the only statement of an if without braces.
+ */
+namespace Log {
+
+    enum Level { ERROR, WARNING, INFO, DEBUG, TRACE };
+
+#ifdef TSCAN_TRACE
+    const bool traceCompiled = true;
+#else
+    const bool traceCompiled = false;
+#endif
+
+    extern Level level;
+
+    inline bool enabled( Level l ){
+        return ( traceCompiled || l != TRACE ) && l <= level;
+    }
+
+    // parses 'error', 'warning', 'info', 'debug' or 'trace'
+    bool parse( const std::string&, Level& );
+
+    class line {
+    public:
+        explicit line( Level l ): lvl( l ) {};
+        ~line();
+        std::ostream& stream() { return os; };
+    private:
+        Level lvl;
+        std::ostringstream os;
+    };
+
+    // Opens problems.log, the words missing from the lexicons, one per
+    // line, and writes its header. Returns false when it can't be opened.
+    bool openProblems( const std::string&, const std::string& );
+    void problem( const std::string& );
+
+    // writes the buffers of all threads
+    void flush();
+}
+
+#define TLOG( l ) \
+    if ( !Log::enabled( Log::l ) ) ; else Log::line( Log::l ).stream()
+
+#endif /* LOG_H */
@@ -0,0 +1,28 @@
+#ifndef MTLD_H
+#define MTLD_H
+
+#include <vector>
+#include "tscan/intern.h"
+
+/*
+ * MTLD (Measure of Textual Lexical Diversity) over interned tokens. The
+ * types seen in the current factor are kept as epoch stamps in an array
+ * indexed by token id, so starting a new factor is just a matter of
+ * bumping the epoch. An engine keeps that array between calls, so use
+ * one per thread. The TTR threshold is passed with every call, as the
+ * Analyzers that share a thread may be configured differently.
+ */
+class mtldEngine {
+public:
+    mtldEngine(): epoch( 0 ){};
+    // the mean of the forward and the backward MTLD, for a threshold
+    double average( const std::vector<Intern::Id>&, double );
+    double calculate( const std::vector<Intern::Id>&, bool, double );
+
+private:
+    void next_epoch();
+    std::vector<unsigned int> seen;
+    unsigned int epoch;
+};
+
+#endif /* MTLD_H */
@@ -2,12 +2,15 @@
 #define NER_H
 
 #include <string>
+#include <vector>
 #include <iostream>
 #include "libfolia/folia.h"
 #include "tscan/sem.h"
 
 namespace NER {
 
+    extern const std::string frog_ner_set;
+
     enum Type {
         NONER,
         LOC_B, LOC_I,
@@ -17,7 +20,22 @@ namespace NER {
         PER_B, PER_I,
         PRO_B, PRO_I
     };
-    Type lookupNer(const folia::Word*, const folia::Sentence*);
+
+    /*
+     * The entity layer of a sentence, decoded once: the NER::Type of each
+     * of its words, by position. Looking up a word that is in an entity
+     * of an unknown class throws a folia::ValueError.
+     */
+    class sentenceNers {
+    public:
+        explicit sentenceNers( size_t n ): types( n, NONER ), unknown( n ){};
+        Type operator[]( size_t ) const;
+    private:
+        friend sentenceNers lookupNers(const std::vector<folia::Word*>&, const folia::Sentence*);
+        std::vector<Type> types;
+        std::vector<std::string> unknown;
+    };
+    sentenceNers lookupNers(const std::vector<folia::Word*>&, const folia::Sentence*);
     std::string toString(Type);
     std::ostream& operator<<(std::ostream&, Type);
 
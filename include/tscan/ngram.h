@@ -0,0 +1,94 @@
+#ifndef NGRAM_H
+#define NGRAM_H
+
+#include <string>
+#include <vector>
+#include <unordered_map>
+#include <cstdint>
+
+/*
+ * An in-process alternative to the Wopr servers: an interpolated
+ * Kneser-Ney n-gram model, stored in a count file that is mapped into
+ * memory as is. The file is made by tscan-lm-build. A backward model is
+ * just a model built from reversed sentences.
+ */
+namespace NGram {
+
+    const size_t MAX_ORDER = 6;
+
+    // one n-gram in the count file. The tables of each order are sorted
+    // on key, which is a hash of the words.
+    struct entry {
+        uint64_t key;
+        uint32_t count;     // c(g): the numerator at the highest order
+        uint32_t cont;      // N1+(. g): the numerator at the lower orders
+        uint32_t followers; // N1+(g .): the number of distinct next words
+        uint32_t ctx;       // the sum of the numerators of g's extensions
+    };
+
+    struct header {
+        char magic[8];
+        uint32_t order;
+        uint32_t reversed;
+        double discount[MAX_ORDER];
+        uint64_t sizes[MAX_ORDER];
+        uint64_t unigram_denom;
+        uint64_t vocab;
+    };
+
+    uint64_t hash( const std::vector<std::string>&, size_t, size_t );
+
+    // The sentence metrics of the log10 probabilities of its words, as in
+    // the Wopr columns: avg_prob10 is their mean, the entropy is the mean
+    // -log2 probability (in bits per word) and the perplexity is 2 to the
+    // power of the entropy. They stay NaN for a sentence without words.
+    void summarize( const std::vector<double>&, double&, double&, double& );
+
+    // A read-only model, mapped from a count file. It is safe to score
+    // from several threads at once.
+    class model {
+    public:
+        model();
+        ~model();
+        bool open( const std::string& );
+        void close();
+        bool isOpen() const { return base != 0; };
+        size_t order() const;
+        bool reversed() const;
+        // fills the log10 probability of every word of the sentence,
+        // reading it in the direction the model was built for
+        void score( const std::vector<std::string>&, std::vector<double>& ) const;
+    private:
+        model( const model& ); // no copies
+        model& operator=( const model& );
+        const entry *find( size_t, uint64_t ) const;
+        double prob( const std::vector<std::string>&, size_t ) const;
+        void *base;
+        size_t length;
+        const header *head;
+        const entry *tables[MAX_ORDER];
+    };
+
+    // Counts the n-grams of a corpus and writes them as a count file.
+    class builder {
+    public:
+        explicit builder( size_t, bool );
+        void add( const std::vector<std::string>& );
+        bool save( const std::string& ) const;
+    private:
+        struct stats {
+            stats(): count(0), cont(0), followers(0), ctx(0), prefix(0) {};
+            uint32_t count;
+            uint32_t cont;
+            uint32_t followers;
+            uint32_t ctx;
+            uint64_t prefix;
+        };
+        size_t n;
+        bool reverse;
+        std::vector<std::unordered_map<uint64_t,stats> > grams;
+    };
+
+}
+
+#endif /* NGRAM_H */
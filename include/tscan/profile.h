@@ -0,0 +1,80 @@
+#ifndef PROFILE_H
+#define PROFILE_H
+
+#include <string>
+#include <atomic>
+#include <chrono>
+
+/*
+ * Where the time goes. With --profile a report is made for every file:
+ * the time spent in each stage, how often it was entered, a histogram
+ * of the latencies of the single calls (for the servers: the round trips)
+ * and the hit rates of the caches, written as one line of JSON.
+ *
+ * A report is the current one of the thread that analyses the file; the
+ * threads that work for it (the omp sections, the Frog shards) are given
+ * the same report with a scope. Without a current report the timers do
+ * nothing. Stages may nest: the compound splitter is part of the words,
+ * for instance, so the stage totals don't add up to the total time.
+ */
+namespace Profile {
+
+    enum Stage { FROG, ALPINO, WOPR_FWD, WOPR_BWD, COMPOUND_SPLITTER,
+                 LEMMATIZE, WORDS, OVERLAP, MTLD, METRICS, SAVE_FOLIA,
+                 SAVE_CSV, SAVE_COLUMNS, N_STAGES };
+
+    enum Counter { ALPINO_LOOKUP_HIT, ALPINO_LOOKUP_MISS,
+                   WOPR_BATCH_HIT, WOPR_BATCH_MISS, N_COUNTERS };
+
+    // latency buckets: below 1 ms, below 2 ms, below 4 ms, ..., the last
+    // one holds the rest
+    const int N_BUCKETS = 16;
+
+    class report {
+    public:
+        explicit report( const std::string& );
+        void add( Stage, std::chrono::steady_clock::duration );
+        void count( Counter c ) { ++counters[c]; };
+        std::string toJSON() const;
+    private:
+        std::string file;
+        std::chrono::steady_clock::time_point start;
+        std::atomic<long long> nanos[N_STAGES];
+        std::atomic<long long> calls[N_STAGES];
+        std::atomic<long long> buckets[N_STAGES][N_BUCKETS];
+        std::atomic<long long> counters[N_COUNTERS];
+    };
+
+    // the report of this thread, or 0
+    report *current();
+
+    // Makes a report the current one of this thread, while it lives.
+    class scope {
+    public:
+        explicit scope( report * );
+        ~scope();
+    private:
+        report *prev;
+    };
+
+    // Adds the time it lives to a stage of the current report.
+    class timer {
+    public:
+        explicit timer( Stage );
+        ~timer();
+    private:
+        report *rep;
+        Stage stage;
+        std::chrono::steady_clock::time_point begin;
+    };
+
+    void count( Counter );
+
+    // Where the reports go: a file they are appended to, or "-" for
+    // stderr. Returns false when the file can't be opened.
+    bool open( const std::string& );
+    bool enabled();
+    void write( const report& );
+}
+
+#endif /* PROFILE_H */
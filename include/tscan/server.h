@@ -0,0 +1,40 @@
+#ifndef SERVER_H
+#define SERVER_H
+
+#include <string>
+#include <vector>
+#include <map>
+#include <functional>
+
+/*
+ * The daemon mode of tscan: the configuration and lexicons are loaded
+ * once, after which documents are analysed on request.
+ *
+ * The protocol is line based. A client sends 'key=value' lines, ended
+ * by an empty line, and gets back either
+ *   OK
+ *   output=<file>   (one line per file written)
+ * or
+ *   ERROR <message>
+ * followed by an empty line, after which the connection is closed.
+ *
+ * There is no authentication: a client can have any file read and
+ * written that tscan may access. So the TCP port is only open to this
+ * machine, and the permissions of a unix socket decide who may use it.
+ */
+namespace Server {
+
+    typedef std::map<std::string,std::string> request;
+
+    // analyses one request. Returns false, with a message, on failure.
+    typedef std::function<bool( const request&,
+                                std::vector<std::string>&,
+                                std::string& )> handler;
+
+    // Listens on a TCP port of the loopback interface, when the address
+    // is a number, or else on a unix socket, and hands the requests to a
+    // pool of worker threads. Only returns when listening failed.
+    bool serve( const std::string&, size_t, const handler& );
+}
+
+#endif /* SERVER_H */
@@ -0,0 +1,31 @@
+#ifndef SHARDS_H
+#define SHARDS_H
+
+#include <string>
+#include <vector>
+#include <utility>
+
+/*
+ * Tagging one text on several Frog servers: the text is split in parts
+ * at paragraph boundaries, and the FoLiA documents Frog returns for the
+ * parts are stitched into one, as if the text was tagged at once.
+ */
+namespace Shards {
+
+    // Splits the lines in at most n parts of about the same size. Parts
+    // only end at an empty line, or at any line with one sentence per
+    // line. Returns the [from, to) ranges of the parts.
+    std::vector<std::pair<size_t,size_t> > split( const std::vector<std::string>&,
+                                                  size_t, bool );
+
+    // Combines the FoLiA documents of consecutive parts, in text order.
+    // The ids in the text of the later parts get the document id of the
+    // first, and their top level numbers (of the paragraphs, say) are
+    // continued after those of the earlier parts. The annotation
+    // declarations and processors that the later parts add are merged
+    // in; the rest of the metadata is that of the first part. Returns an
+    // empty string when a part doesn't look as expected.
+    std::string stitch( const std::vector<std::string>& );
+}
+
+#endif /* SHARDS_H */
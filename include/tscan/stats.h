@@ -3,6 +3,9 @@
 
 #include <cmath>
 #include <map>
+#include <array>
+#include <deque>
+#include <algorithm>
 #include <string>
 #include <fstream>
 #include <iostream>
@@ -19,13 +22,18 @@
 #include "tscan/afk.h"
 #include "tscan/adverb.h"
 #include "tscan/ner.h"
+#include "tscan/intern.h"
+#include "tscan/tokens.h"
+#include "tscan/counters.h"
 #include "tscan/utils.h"
+#include "tscan/csv.h"
 
 struct sentStats; // Forward declaration
 struct wordStats; // Forward declaration
+struct wordSpan; // Forward declaration
+class statsArena; // Forward declaration
 
 enum top_val { top1000, top2000, top3000, top5000, top10000, top20000, notFound };
-enum csvKind { DOC_CSV, PAR_CSV, SENT_CSV, WORD_CSV };
 
 struct basicStats {
   basicStats( int pos, folia::FoliaElement* el, const std::string& cat ):
@@ -44,42 +52,16 @@ struct basicStats {
     }
   };
   virtual ~basicStats(){};
-  virtual void CSVheader( std::ostream&, const std::string& = "" ) const = 0;
-  virtual void wordDifficultiesHeader( std::ostream& ) const = 0;
-  virtual void wordDifficultiesToCSV( std::ostream& ) const = 0;
-  virtual void compoundHeader( std::ostream& ) const = 0;
-  virtual void compoundToCSV( std::ostream& ) const = 0;
-  virtual void sentDifficultiesHeader( std::ostream& ) const = 0;
-  virtual void sentDifficultiesToCSV( std::ostream& ) const = 0;
-  virtual void infoHeader( std::ostream& ) const = 0;
-  virtual void informationDensityToCSV( std::ostream& ) const = 0;
-  virtual void coherenceHeader( std::ostream& ) const = 0;
-  virtual void coherenceToCSV( std::ostream& ) const = 0;
-  virtual void concreetHeader( std::ostream& ) const = 0;
-  virtual void concreetToCSV( std::ostream& ) const = 0;
-  virtual void persoonlijkheidHeader( std::ostream& ) const = 0;
-  virtual void persoonlijkheidToCSV( std::ostream& ) const = 0;
-  virtual void verbHeader( std::ostream& ) const = 0;
-  virtual void verbToCSV( std::ostream& ) const = 0;
-  virtual void imperativeHeader( std::ostream& ) const = 0;
-  virtual void imperativeToCSV( std::ostream& ) const = 0;
-  virtual void wordSortHeader( std::ostream& ) const = 0;
-  virtual void wordSortToCSV( std::ostream& ) const = 0;
-  virtual void prepPhraseHeader( std::ostream& ) const = 0;
-  virtual void prepPhraseToCSV( std::ostream& ) const = 0;
-  virtual void intensHeader( std::ostream& ) const = 0;
-  virtual void intensToCSV( std::ostream& ) const = 0;
-  virtual void formalHeader( std::ostream& ) const = 0;
-  virtual void formalToCSV( std::ostream& ) const = 0;
-  virtual void miscToCSV( std::ostream& ) const = 0;
-  virtual void miscHeader( std::ostream& ) const = 0;
+  // fills the columns of a CSV line, see csv.h
+  virtual void CSVcolumns( csvLine& ) const = 0;
   virtual double rarity( int ) const { return NAN; };
-  virtual void toCSV( std::ostream& ) const = 0;
   virtual void addMetrics() const = 0;
   virtual std::string text() const { return ""; };
   virtual std::string ltext() const { return ""; };
   virtual std::string Lemma() const { return ""; };
   virtual std::string llemma() const { return ""; };
+  virtual Intern::Id ltextId() const { return Intern::EMPTY; };
+  virtual Intern::Id lemmaId() const { return Intern::EMPTY; };
   virtual CGN::Type postag() const { return CGN::UNASS; };
   virtual CGN::Prop wordProperty() const { return CGN::NOTAWORD; };
   virtual Conn::Type getConnType() const { return Conn::NOCONN; };
@@ -93,7 +75,7 @@ struct basicStats {
     throw std::logic_error("setSitType() only valid for words" );
   };
   virtual Situation::Type getSitType() const { return Situation::NO_SIT; };
-  virtual std::vector<const wordStats*> collectWords() const = 0;
+  virtual wordSpan collectWords() const = 0;
   virtual double get_al_gem() const { return NAN; };
   virtual double get_al_max() const { return NAN; };
   folia::FoliaElement* folia_node;
@@ -109,41 +91,21 @@ struct basicStats {
 
 
 struct wordStats : public basicStats {
-  wordStats( int, folia::Word*, const xmlNode*, const std::set<size_t>&, bool );
-  void CSVheader( std::ostream &, const std::string & ) const override;
-  void wordDifficultiesHeader( std::ostream & ) const override;
-  void wordDifficultiesToCSV( std::ostream & ) const override;
-  void sentDifficultiesHeader( std::ostream & ) const override{};
-  void sentDifficultiesToCSV( std::ostream & ) const override{};
-  void infoHeader( std::ostream & ) const override{};
-  void informationDensityToCSV( std::ostream & ) const override{};
-  void coherenceHeader( std::ostream & ) const override;
-  void coherenceToCSV( std::ostream & ) const override;
-  void concreetHeader( std::ostream & ) const override;
-  void concreetToCSV( std::ostream & ) const override;
-  void compoundHeader( std::ostream & ) const override;
-  void compoundToCSV( std::ostream & ) const override;
-  void persoonlijkheidHeader( std::ostream & ) const override;
-  void persoonlijkheidToCSV( std::ostream & ) const override;
-  void verbHeader( std::ostream & ) const override{};
-  void verbToCSV( std::ostream & ) const override{};
-  void imperativeHeader( std::ostream & ) const override{};
-  void imperativeToCSV( std::ostream & ) const override{};
-  void wordSortHeader( std::ostream & ) const override;
-  void wordSortToCSV( std::ostream & ) const override;
-  void prepPhraseHeader( std::ostream & ) const override{};
-  void prepPhraseToCSV( std::ostream & ) const override{};
-  void intensHeader( std::ostream & ) const override{};
-  void intensToCSV( std::ostream & ) const override{};
-  void formalHeader( std::ostream & ) const override{};
-  void formalToCSV( std::ostream & ) const override{};
-  void miscHeader( std::ostream &os ) const override;
-  void miscToCSV( std::ostream & ) const override;
-  void toCSV( std::ostream & ) const override;
+  wordStats( int, const tokenTable&, const xmlNode*, bool );
+  void CSVcolumns( csvLine& ) const override;
+  void wordSortCSV( csvLine& ) const;
+  void wordDifficultiesCSV( csvLine& ) const;
+  void coherenceCSV( csvLine& ) const;
+  void concreetCSV( csvLine& ) const;
+  void compoundCSV( csvLine& ) const;
+  void persoonlijkheidCSV( csvLine& ) const;
+  void miscCSV( csvLine& ) const;
   std::string text() const override { return word; };
   std::string ltext() const override { return l_word; };
   std::string Lemma() const override { return lemma; };
   std::string llemma() const override { return l_lemma; };
+  Intern::Id ltextId() const override { return l_word_id; };
+  Intern::Id lemmaId() const override { return lemma_id; };
   CGN::Type postag() const override { return tag; };
   Conn::Type getConnType() const override { return connType; };
   void setConnType( Conn::Type t ) override { connType = t; };
@@ -156,7 +118,7 @@ struct wordStats : public basicStats {
   Conn::Type checkConnective() const;
   Situation::Type checkSituation() const;
   bool checkNominal( const xmlNode* ) const;
-  void setCGNProps( const folia::PosAnnotation* );
+  void setCGNProps( const tokenInfo& );
   CGN::Prop wordProperty() const override { return prop; };
   void checkNoun();
   SEM::Type checkSemProps() const;
@@ -177,7 +139,7 @@ struct wordStats : public basicStats {
   void freqLookup();
   void getSentenceOverlap( const std::vector<std::string>&, const std::vector<std::string>& );
   bool isOverlapCandidate() const;
-  std::vector<const wordStats *> collectWords() const override;
+  wordSpan collectWords() const override;
   bool parseFail;
   std::string word;
   std::string l_word;
@@ -186,6 +148,9 @@ struct wordStats : public basicStats {
   std::string lemma;
   std::string full_lemma; // scheidbare ww hebben dit
   std::string l_lemma;
+  Intern::Id l_word_id;
+  Intern::Id lemma_id;
+  Intern::Id l_lemma_id;
   WWform wwform;
   bool isPersRef;
   bool isPronRef;
@@ -246,248 +211,41 @@ struct wordStats : public basicStats {
   std::string my_classification;
 };
 
+/**
+ * A [begin, end) range of wordStats that are stored contiguously, in
+ * document order. Used to walk all words below a structStats node
+ * without collecting them first.
+ */
+struct wordSpan {
+  wordSpan(): first(0), last(0) {};
+  wordSpan( const wordStats *b, const wordStats *e ): first(b), last(e) {};
+  const wordStats *begin() const { return first; };
+  const wordStats *end() const { return last; };
+  size_t size() const { return last - first; };
+  bool empty() const { return first == last; };
+  const wordStats& operator[]( size_t i ) const { return first[i]; };
+  const wordStats *first;
+  const wordStats *last;
+};
+
 struct structStats: public basicStats {
   structStats( int index, folia::FoliaElement* el, const std::string& cat ):
     basicStats( index, el, cat ),
-    wordCnt(0),
-    wordInclCnt(0), // wordCnt including stopwords
+    int_sums(),
+    double_sums(),
     sentCnt(0),
     parseFailCnt(0),
-    vdBvCnt(0),
-    vdNwCnt(0),
-    vdVrijCnt(0),
-    odBvCnt(0),
-    odNwCnt(0),
-    odVrijCnt(0),
-    infBvCnt(0),
-    infNwCnt(0),
-    infVrijCnt(0),
-    smainCnt(0),
-    ssubCnt(0),
-    sv1Cnt(0),
-    clauseCnt(0),
-    correctedClauseCnt(0),
-    smainCnjCnt(0),
-    ssubCnjCnt(0),
-    sv1CnjCnt(0),
-    presentCnt(0),
-    pastCnt(0),
-    subjonctCnt(0),
-    nameCnt(0),
-    nameInclCnt(0), // nameCnt including stopwords
-    pron1Cnt(0),
-    pron2Cnt(0),
-    pron3Cnt(0),
-    passiveCnt(0),
-    modalCnt(0),
-    timeVCnt(0),
-    koppelCnt(0),
-    persRefCnt(0),
-    pronRefCnt(0),
-    archaicsCnt(0),
-    contentCnt(0),
-    contentInclCnt(0), // contentCnt including stopwords
-    contentStrictCnt(0),
-    contentStrictInclCnt(0), // contentStrictCnt including stopwords
-    nominalCnt(0),
-    adjCnt(0),
-    adjInclCnt(0), // adjCnt including stopwords
-    vgCnt(0),
-    vnwCnt(0),
-    lidCnt(0),
-    vzCnt(0),
-    bwCnt(0),
-    twCnt(0),
-    nounCnt(0),
-    nounInclCnt(0), // nounCnt including stopwords
-    verbCnt(0),
-    verbInclCnt(0), // verbCnt including stopwords
-    tswCnt(0),
-    specCnt(0),
-    letCnt(0),
-    betrCnt(0),
-    bijwCnt(0),
-    complCnt(0),
-    mvFinInbedCnt(0),
-    infinComplBepCnt(0),
-    mvInbedCnt(0),
-    losBetrCnt(0),
-    losBijwCnt(0),
-    allConnCnt(0),
-    tempConnCnt(0),
-    opsomWgConnCnt(0),
-    opsomZinConnCnt(0),
-    contrastConnCnt(0),
-    compConnCnt(0),
-    causeConnCnt(0),
-    timeSitCnt(0),
-    spaceSitCnt(0),
-    causeSitCnt(0),
-    emoSitCnt(0),
-    propNegCnt(0),
-    morphNegCnt(0),
-    multiNegCnt(0),
-    wordOverlapCnt(0),
-    lemmaOverlapCnt(0),
-    prevalenceP(0),
-    prevalenceZ(0),
-    prevalenceContentP(0),
-    prevalenceContentZ(0),
-    prevalenceCovered(0),
-    prevalenceContentCovered(0),
-    f50Cnt(0),
-    f65Cnt(0),
-    f77Cnt(0),
-    f80Cnt(0),
-    top1000Cnt(0),
-    top2000Cnt(0),
-    top3000Cnt(0),
-    top5000Cnt(0),
-    top10000Cnt(0),
-    top20000Cnt(0),
-    top1000ContentCnt(0),
-    top2000ContentCnt(0),
-    top3000ContentCnt(0),
-    top5000ContentCnt(0),
-    top10000ContentCnt(0),
-    top20000ContentCnt(0),
-    top1000ContentStrictCnt(0),
-    top2000ContentStrictCnt(0),
-    top3000ContentStrictCnt(0),
-    top5000ContentStrictCnt(0),
-    top10000ContentStrictCnt(0),
-    top20000ContentStrictCnt(0),
-    word_freq(0),
-    word_freq_n(0),
-    word_freq_strict(0),
-    word_freq_n_strict(0),
     word_freq_log(NAN),
     word_freq_log_n(NAN),
     word_freq_log_strict(NAN),
     word_freq_log_n_strict(NAN),
-    lemma_freq(0),
-    lemma_freq_n(0),
-    lemma_freq_strict(0),
-    lemma_freq_n_strict(0),
     lemma_freq_log(NAN),
     lemma_freq_log_n(NAN),
     lemma_freq_log_strict(NAN),
     lemma_freq_log_n_strict(NAN),
-    avg_prob10_fwd(0),
-    avg_prob10_fwd_content(0),
-    avg_prob10_fwd_ex_names(0),
-    avg_prob10_fwd_content_ex_names(0),
-    avg_prob10_bwd(0),
-    avg_prob10_bwd_content(0),
-    avg_prob10_bwd_ex_names(0),
-    avg_prob10_bwd_content_ex_names(0),
-    entropy_fwd(0),
-    entropy_fwd_norm(0),
-    entropy_bwd(0),
-    entropy_bwd_norm(0),
-    perplexity_fwd(0),
-    perplexity_fwd_norm(0),
-    perplexity_bwd(0),
-    perplexity_bwd_norm(0),
     al_gem(NAN),
     al_max(NAN),
-    intensCnt(0),
-    intensBvnwCnt(0),
-    intensBvbwCnt(0),
-    intensBwCnt(0),
-    intensCombiCnt(0),
-    intensNwCnt(0),
-    intensTussCnt(0),
-    intensWwCnt(0),
-    formalCnt(0),
-    formalBvnwCnt(0),
-    formalBwCnt(0),
-    formalVgwCnt(0),
-    formalVnwCnt(0),
-    formalVzCnt(0),
-    formalVzgCnt(0),
-    formalWwCnt(0),
-    formalZnwCnt(0),
-    generalNounCnt(0),
-    generalNounSepCnt(0),
-    generalNounRelCnt(0),
-    generalNounActCnt(0),
-    generalNounKnowCnt(0),
-    generalNounDiscCnt(0),
-    generalNounDeveCnt(0),
-    generalVerbCnt(0),
-    generalVerbSepCnt(0),
-    generalVerbRelCnt(0),
-    generalVerbActCnt(0),
-    generalVerbKnowCnt(0),
-    generalVerbDiscCnt(0),
-    generalVerbDeveCnt(0),
-    generalAdverbCnt(0),
-    specificAdverbCnt(0),
-    broadNounCnt(0),
-    strictNounCnt(0),
-    broadAdjCnt(0),
-    strictAdjCnt(0),
-    subjectiveAdjCnt(0),
-    abstractWwCnt(0),
-    concreteWwCnt(0),
-    undefinedWwCnt(0),
-    undefinedATPCnt(0),
-    stateCnt(0),
-    actionCnt(0),
-    processCnt(0),
-    humanAdjCnt(0),
-    emoAdjCnt(0),
-    nonhumanAdjCnt(0),
-    shapeAdjCnt(0),
-    colorAdjCnt(0),
-    matterAdjCnt(0),
-    soundAdjCnt(0),
-    nonhumanOtherAdjCnt(0),
-    techAdjCnt(0),
-    timeAdjCnt(0),
-    placeAdjCnt(0),
-    specPosAdjCnt(0),
-    specNegAdjCnt(0),
-    posAdjCnt(0),
-    negAdjCnt(0),
-    evaluativeAdjCnt(0),
-    epiPosAdjCnt(0),
-    epiNegAdjCnt(0),
-    abstractAdjCnt(0),
-    undefinedNounCnt(0),
-    uncoveredNounCnt(0),
-    undefinedAdjCnt(0),
-    uncoveredAdjCnt(0),
-    uncoveredVerbCnt(0),
-    humanCnt(0),
-    nonHumanCnt(0),
-    artefactCnt(0),
-    concrotherCnt(0),
-    substanceConcCnt(0),
-    foodcareCnt(0),
-    timeCnt(0),
-    placeCnt(0),
-    measureCnt(0),
-    dynamicConcCnt(0),
-    substanceAbstrCnt(0),
-    dynamicAbstrCnt(0),
-    nonDynamicCnt(0),
-    institutCnt(0),
-    npCnt(0),
-    indefNpCnt(0),
-    npSize(0),
-    vcModCnt(0),
-    vcModSingleCnt(0),
-    adjNpModCnt(0),
-    npModCnt(0),
-    smallCnjCnt(0),
-    smallCnjExtraCnt(0),
     dLevel(-1),
-    dLevel_gt4(0),
-    impCnt(0),
-    questCnt(0),
-    prepExprCnt(0),
     word_mtld(0),
     lemma_mtld(0),
     content_mtld(0),
@@ -504,353 +262,74 @@ struct structStats: public basicStats {
     ruimte_sit_mtld(0),
     cause_sit_mtld(0),
     emotion_sit_mtld(0),
-    nerCnt(0),
-    compoundCnt(0),
-    compound3Cnt(0),
-    charCntNoun(0),
-    charCntNonComp(0),
-    charCntComp(0),
-    charCntHead(0),
-    charCntSat(0),
-    charCntNounCorr(0),
-    charCntCorr(0),
-    word_freq_log_noun(0),
-    word_freq_log_non_comp(0),
-    word_freq_log_comp(0),
-    word_freq_log_head(0),
-    word_freq_log_sat(0),
-    word_freq_log_head_sat(0),
-    word_freq_log_noun_corr(0),
-    word_freq_log_corr(0),
-    word_freq_log_corr_strict(0),
-    word_freq_log_n_corr(0),
-    word_freq_log_n_corr_strict(0),
-    top1000CntNoun(0),
-    top1000CntNonComp(0),
-    top1000CntComp(0),
-    top1000CntHead(0),
-    top1000CntSat(0),
-    top1000CntNounCorr(0),
-    top1000CntCorr(0),
-    top5000CntNoun(0),
-    top5000CntNonComp(0),
-    top5000CntComp(0),
-    top5000CntHead(0),
-    top5000CntSat(0),
-    top5000CntNounCorr(0),
-    top5000CntCorr(0),
-    top20000CntNoun(0),
-    top20000CntNonComp(0),
-    top20000CntComp(0),
-    top20000CntHead(0),
-    top20000CntSat(0),
-    top20000CntNounCorr(0),
-    top20000CntCorr(0),
     rarityLevel(0),
     overlapSize(0)
- {};
-  ~structStats();
+  {};
   void addMetrics() const override;
-  void topPredictorsHeader( std::ostream& ) const;
-  void topPredictorsToCSV( std::ostream& ) const;
-  void wordDifficultiesHeader( std::ostream & ) const override;
-  void wordDifficultiesToCSV( std::ostream & ) const override;
-  void compoundHeader( std::ostream & ) const override;
-  void compoundToCSV( std::ostream & ) const override;
-  void sentDifficultiesHeader( std::ostream & ) const override;
-  void sentDifficultiesToCSV( std::ostream & ) const override;
-  void infoHeader( std::ostream & ) const override;
-  void informationDensityToCSV( std::ostream & ) const override;
-  void coherenceHeader( std::ostream & ) const override;
-  void coherenceToCSV( std::ostream & ) const override;
-  void concreetHeader( std::ostream & ) const override;
-  void concreetToCSV( std::ostream & ) const override;
-  void persoonlijkheidHeader( std::ostream & ) const override;
-  void persoonlijkheidToCSV( std::ostream & ) const override;
-  void verbHeader( std::ostream & ) const override;
-  void verbToCSV( std::ostream & ) const override;
-  void imperativeHeader( std::ostream & ) const override;
-  void imperativeToCSV( std::ostream & ) const override;
-  void wordSortHeader( std::ostream & ) const override;
-  void wordSortToCSV( std::ostream & ) const override;
-  void prepPhraseHeader( std::ostream & ) const override;
-  void prepPhraseToCSV( std::ostream & ) const override;
-  void intensHeader( std::ostream & ) const override;
-  void intensToCSV( std::ostream & ) const override;
-  void formalHeader( std::ostream & ) const override;
-  void formalToCSV( std::ostream & ) const override;
-  void miscHeader( std::ostream & ) const override;
-  void miscToCSV( std::ostream & ) const override;
-  void CSVheader( std::ostream &, const std::string & ) const override;
-  void toCSV( std::ostream & ) const override;
+  void CSVcolumns( csvLine& ) const override;
+  void topPredictorsCSV( csvLine& ) const;
+  void wordDifficultiesCSV( csvLine& ) const;
+  void compoundCSV( csvLine& ) const;
+  void sentDifficultiesCSV( csvLine& ) const;
+  void informationDensityCSV( csvLine& ) const;
+  void coherenceCSV( csvLine& ) const;
+  void concreetCSV( csvLine& ) const;
+  void persoonlijkheidCSV( csvLine& ) const;
+  void verbCSV( csvLine& ) const;
+  void imperativeCSV( csvLine& ) const;
+  void wordSortCSV( csvLine& ) const;
+  void prepPhraseCSV( csvLine& ) const;
+  void intensCSV( csvLine& ) const;
+  void formalCSV( csvLine& ) const;
+  void miscCSV( csvLine& ) const;
   void merge( structStats* );
   virtual bool isSentence() const { return false; };
   virtual bool isDocument() const { return false; };
   virtual int word_overlapCnt() const { return -1; };
   virtual int lemma_overlapCnt() const { return -1; };
-  std::vector<const wordStats *> collectWords() const override;
+  wordSpan collectWords() const override;
   double get_al_gem() const override { return al_gem; };
   double get_al_max() const override { return al_max; };
   virtual double getMeanAL() const;
   virtual double getHighestAL() const;
   void calculate_MTLDs();
   std::string text;
-  int wordCnt;
-  int wordInclCnt;
+  wordSpan words;
+  // the summed counters, see counters.h
+  std::array<int, Counters::N_INT_SUMS> int_sums;
+  std::array<double, Counters::N_DOUBLE_SUMS> double_sums;
+  STRUCT_INT_SUMS(COUNTER_INT_ACCESSOR)
+  STRUCT_DOUBLE_SUMS(COUNTER_DOUBLE_ACCESSOR)
   int sentCnt;
   int parseFailCnt;
-  int vdBvCnt;
-  int vdNwCnt;
-  int vdVrijCnt;
-  int odBvCnt;
-  int odNwCnt;
-  int odVrijCnt;
-  int infBvCnt;
-  int infNwCnt;
-  int infVrijCnt;
-  int smainCnt;
-  int ssubCnt;
-  int sv1Cnt;
-  int clauseCnt;
-  int correctedClauseCnt;
-  int smainCnjCnt;
-  int ssubCnjCnt;
-  int sv1CnjCnt;
-  int presentCnt;
-  int pastCnt;
-  int subjonctCnt;
-  int nameCnt;
-  int nameInclCnt;
-  int pron1Cnt;
-  int pron2Cnt;
-  int pron3Cnt;
-  int passiveCnt;
-  int modalCnt;
-  int timeVCnt;
-  int koppelCnt;
-  int persRefCnt;
-  int pronRefCnt;
-  int archaicsCnt;
-  int contentCnt;
-  int contentInclCnt;
-  int contentStrictCnt;
-  int contentStrictInclCnt;
-  int nominalCnt;
-  int adjCnt;
-  int adjInclCnt;
-  int vgCnt;
-  int vnwCnt;
-  int lidCnt;
-  int vzCnt;
-  int bwCnt;
-  int twCnt;
-  int nounCnt;
-  int nounInclCnt;
-  int verbCnt;
-  int verbInclCnt;
-  int tswCnt;
-  int specCnt;
-  int letCnt;
-  int betrCnt;
-  int bijwCnt;
-  int complCnt;
-  int mvFinInbedCnt;
-  int infinComplBepCnt;
-  int mvInbedCnt;
-  int losBetrCnt;
-  int losBijwCnt;
-  int allConnCnt;
-  int tempConnCnt;
-  int opsomWgConnCnt;
-  int opsomZinConnCnt;
-  int contrastConnCnt;
-  int compConnCnt;
-  int causeConnCnt;
-  int timeSitCnt;
-  int spaceSitCnt;
-  int causeSitCnt;
-  int emoSitCnt;
-  int propNegCnt;
-  int morphNegCnt;
-  int multiNegCnt;
-  int wordOverlapCnt;
-  int lemmaOverlapCnt;
-  double prevalenceP;
-  double prevalenceZ;
-  double prevalenceContentP;
-  double prevalenceContentZ;
-  int prevalenceCovered;
-  int prevalenceContentCovered;
-  int f50Cnt;
-  int f65Cnt;
-  int f77Cnt;
-  int f80Cnt;
-  int top1000Cnt;
-  int top2000Cnt;
-  int top3000Cnt;
-  int top5000Cnt;
-  int top10000Cnt;
-  int top20000Cnt;
-  int top1000ContentCnt;
-  int top2000ContentCnt;
-  int top3000ContentCnt;
-  int top5000ContentCnt;
-  int top10000ContentCnt;
-  int top20000ContentCnt;
-  int top1000ContentStrictCnt;
-  int top2000ContentStrictCnt;
-  int top3000ContentStrictCnt;
-  int top5000ContentStrictCnt;
-  int top10000ContentStrictCnt;
-  int top20000ContentStrictCnt;
-  double word_freq;
-  double word_freq_n;
-  double word_freq_strict;
-  double word_freq_n_strict;
   double word_freq_log;
   double word_freq_log_n;
   double word_freq_log_strict;
   double word_freq_log_n_strict;
-  double lemma_freq;
-  double lemma_freq_n;
-  double lemma_freq_strict;
-  double lemma_freq_n_strict;
   double lemma_freq_log;
   double lemma_freq_log_n;
   double lemma_freq_log_strict;
   double lemma_freq_log_n_strict;
-  double avg_prob10_fwd;
-  double avg_prob10_fwd_content;
-  double avg_prob10_fwd_ex_names;
-  double avg_prob10_fwd_content_ex_names;
-  double avg_prob10_bwd;
-  double avg_prob10_bwd_content;
-  double avg_prob10_bwd_ex_names;
-  double avg_prob10_bwd_content_ex_names;
-  double entropy_fwd;
-  double entropy_fwd_norm;
-  double entropy_bwd;
-  double entropy_bwd_norm;
-  double perplexity_fwd;
-  double perplexity_fwd_norm;
-  double perplexity_bwd;
-  double perplexity_bwd_norm;
   double al_gem;
   double al_max;
-  int intensCnt;
-  int intensBvnwCnt;
-  int intensBvbwCnt;
-  int intensBwCnt;
-  int intensCombiCnt;
-  int intensNwCnt;
-  int intensTussCnt;
-  int intensWwCnt;
-  int formalCnt;
-  int formalBvnwCnt;
-  int formalBwCnt;
-  int formalVgwCnt;
-  int formalVnwCnt;
-  int formalVzCnt;
-  int formalVzgCnt;
-  int formalWwCnt;
-  int formalZnwCnt;
-  int generalNounCnt;
-  int generalNounSepCnt;
-  int generalNounRelCnt;
-  int generalNounActCnt;
-  int generalNounKnowCnt;
-  int generalNounDiscCnt;
-  int generalNounDeveCnt;
-  int generalVerbCnt;
-  int generalVerbSepCnt;
-  int generalVerbRelCnt;
-  int generalVerbActCnt;
-  int generalVerbKnowCnt;
-  int generalVerbDiscCnt;
-  int generalVerbDeveCnt;
-  int generalAdverbCnt;
-  int specificAdverbCnt;
-  int broadNounCnt;
-  int strictNounCnt;
-  int broadAdjCnt;
-  int strictAdjCnt;
-  int subjectiveAdjCnt;
-  int abstractWwCnt;
-  int concreteWwCnt;
-  int undefinedWwCnt;
-  int undefinedATPCnt;
-  int stateCnt;
-  int actionCnt;
-  int processCnt;
-  int humanAdjCnt;
-  int emoAdjCnt;
-  int nonhumanAdjCnt;
-  int shapeAdjCnt;
-  int colorAdjCnt;
-  int matterAdjCnt;
-  int soundAdjCnt;
-  int nonhumanOtherAdjCnt;
-  int techAdjCnt;
-  int timeAdjCnt;
-  int placeAdjCnt;
-  int specPosAdjCnt;
-  int specNegAdjCnt;
-  int posAdjCnt;
-  int negAdjCnt;
-  int evaluativeAdjCnt;
-  int epiPosAdjCnt;
-  int epiNegAdjCnt;
-  int abstractAdjCnt;
-  int undefinedNounCnt;
-  int uncoveredNounCnt;
-  int undefinedAdjCnt;
-  int uncoveredAdjCnt;
-  int uncoveredVerbCnt;
-  int humanCnt;
-  int nonHumanCnt;
-  int artefactCnt;
-  int concrotherCnt;
-  int substanceConcCnt;
-  int foodcareCnt;
-  int timeCnt;
-  int placeCnt;
-  int measureCnt;
-  int dynamicConcCnt;
-  int substanceAbstrCnt;
-  int dynamicAbstrCnt;
-  int nonDynamicCnt;
-  int institutCnt;
-  int npCnt;
-  int indefNpCnt;
-  int npSize;
-  int vcModCnt;
-  int vcModSingleCnt;
-  int adjNpModCnt;
-  int npModCnt;
-  int smallCnjCnt;
-  int smallCnjExtraCnt;
   int dLevel;
-  int dLevel_gt4;
-  int impCnt;
-  int questCnt;
-  int prepExprCnt;
   std::map<CGN::Type,int> heads;
-  std::map<std::string,int> unique_names;
-  std::map<std::string,int> unique_contents;
-  std::map<std::string,int> unique_contents_strict;
-  std::map<std::string,int> unique_tijd_sits;
-  std::map<std::string,int> unique_ruimte_sits;
-  std::map<std::string,int> unique_cause_sits;
-  std::map<std::string,int> unique_emotion_sits;
-  std::map<std::string,int> unique_all_conn;
-  std::map<std::string,int> unique_temp_conn;
-  std::map<std::string,int> unique_reeks_wg_conn;
-  std::map<std::string,int> unique_reeks_zin_conn;
-  std::map<std::string,int> unique_contr_conn;
-  std::map<std::string,int> unique_comp_conn;
-  std::map<std::string,int> unique_cause_conn;
-  std::map<std::string,int> unique_words;
-  std::map<std::string,int> unique_lemmas;
+  Intern::Counter unique_names;
+  Intern::Counter unique_contents;
+  Intern::Counter unique_contents_strict;
+  Intern::Counter unique_tijd_sits;
+  Intern::Counter unique_ruimte_sits;
+  Intern::Counter unique_cause_sits;
+  Intern::Counter unique_emotion_sits;
+  Intern::Counter unique_all_conn;
+  Intern::Counter unique_temp_conn;
+  Intern::Counter unique_reeks_wg_conn;
+  Intern::Counter unique_reeks_zin_conn;
+  Intern::Counter unique_contr_conn;
+  Intern::Counter unique_comp_conn;
+  Intern::Counter unique_cause_conn;
+  Intern::Counter unique_words;
+  Intern::Counter unique_lemmas;
   double word_mtld;
   double lemma_mtld;
   double content_mtld;
@@ -868,58 +347,43 @@ struct structStats: public basicStats {
   double cause_sit_mtld;
   double emotion_sit_mtld;
   std::map<NER::Type, int> ners;
-  int nerCnt;
   std::map<Afk::Type, int> afks;
   std::multimap<DD_type,int> distances;
-  int compoundCnt;
-  int compound3Cnt;
-  int charCntNoun;
-  int charCntNonComp;
-  int charCntComp;
-  int charCntHead;
-  int charCntSat;
-  int charCntNounCorr;
-  int charCntCorr;
-  double word_freq_log_noun;
-  double word_freq_log_non_comp;
-  double word_freq_log_comp;
-  double word_freq_log_head;
-  double word_freq_log_sat;
-  double word_freq_log_head_sat;
-  double word_freq_log_noun_corr;
-  double word_freq_log_corr;
-  double word_freq_log_corr_strict;
-  double word_freq_log_n_corr;
-  double word_freq_log_n_corr_strict;
-  int top1000CntNoun;
-  int top1000CntNonComp;
-  int top1000CntComp;
-  int top1000CntHead;
-  int top1000CntSat;
-  int top1000CntNounCorr;
-  int top1000CntCorr;
-  int top5000CntNoun;
-  int top5000CntNonComp;
-  int top5000CntComp;
-  int top5000CntHead;
-  int top5000CntSat;
-  int top5000CntNounCorr;
-  int top5000CntCorr;
-  int top20000CntNoun;
-  int top20000CntNonComp;
-  int top20000CntComp;
-  int top20000CntHead;
-  int top20000CntSat;
-  int top20000CntNounCorr;
-  int top20000CntCorr;
   int rarityLevel;
   unsigned int overlapSize;
   std::map<std::string,int> my_classification;
 };
 
 
+/**
+ * The Wopr results for one sentence, in one direction.
+ */
+struct woprScores {
+  explicit woprScores( size_t n = 0 ):
+    wordProbs( n, NAN ), sentProb( NAN ), entropy( NAN ), perplexity( NAN ){};
+  std::vector<double> wordProbs;
+  double sentProb;
+  double entropy;
+  double perplexity;
+};
+
+/**
+ * The Wopr results for a range of sentences, ordered with one request
+ * per direction instead of two per sentence. Sentences for which the
+ * batch returned nothing usable are not found, and are sent on their own.
+ */
+class woprBatch {
+ public:
+  void order( const std::vector<folia::Sentence*>& );
+  bool find( const folia::Sentence*, woprScores&, woprScores& ) const;
+ private:
+  std::map<const folia::Sentence*, woprScores> fwd;
+  std::map<const folia::Sentence*, woprScores> bwd;
+};
+
+
 struct sentStats : public structStats {
-  sentStats( const std::string&, int, folia::Sentence*, const sentStats* );
+  sentStats( const std::string&, int, folia::Sentence*, const sentStats*, const woprBatch*, statsArena& );
   bool isSentence() const override { return true; };
   void resolveConnectives();
   void resolveSituations();
@@ -944,20 +408,51 @@ struct sentStats : public structStats {
 
 
 struct parStats: public structStats {
-  parStats( const std::string&, int, folia::Paragraph* );
+  parStats( const std::string&, int, folia::Paragraph*, const woprBatch*, statsArena& );
   void addMetrics() const override;
 };
 
+/**
+ * Owns all nodes of the analysis tree of one document.
+ * The words are stored contiguously in document order: the storage is
+ * reserved up front and never reallocated. Sentences and paragraphs
+ * live in deques. So no node ever moves, the pointers in sv and the
+ * wordSpans stay valid, and the whole tree is released in one go with
+ * the document.
+ */
+class statsArena {
+ public:
+  explicit statsArena( size_t n ){ words.reserve( n ); };
+  wordStats *addWord( int, const tokenTable&, const xmlNode*, bool );
+  sentStats *addSentence( const std::string&, int, folia::Sentence*, const sentStats*, const woprBatch* );
+  parStats *addParagraph( const std::string&, int, folia::Paragraph*, const woprBatch* );
+  const wordStats *nextWord() const { return words.data() + words.size(); };
+ private:
+  std::vector<wordStats> words;
+  std::deque<sentStats> sentences;
+  std::deque<parStats> paragraphs;
+};
+
 
 struct docStats : public structStats {
   explicit docStats( const std::string&, folia::Document* );
   bool isDocument() const override { return true; };
-  void toCSV( const std::string&, csvKind ) const;
+  void toCSV( const std::string&, Compress::Type,
+              const Groups::selection& ) const;
+  void toCSV( const std::string&, std::string[4],
+              const Groups::selection& ) const;
+  bool toColumns( const std::string&, const std::string&, Compress::Type,
+                  const Groups::selection& ) const;
+  static std::string csvName( const std::string&, int, Compress::Type );
+  static std::string columnsName( const std::string&, int, Compress::Type );
+  void fillTables( const std::string&, tableFile *[],
+                   const Groups::selection& ) const;
   double rarity( int level ) const override;
   void addMetrics() const override;
   int word_overlapCnt() const override { return doc_word_overlapCnt; };
   int lemma_overlapCnt() const override { return doc_lemma_overlapCnt; };
   void calculate_doc_overlap();
+  statsArena arena;
   int doc_word_overlapCnt;
   int doc_lemma_overlapCnt;
   double rarity_index;
@@ -0,0 +1,52 @@
+#ifndef TOKENS_H
+#define TOKENS_H
+
+#include <string>
+#include <vector>
+#include <set>
+#include <unordered_map>
+#include "libfolia/folia.h"
+#include "tscan/cgn.h"
+#include "tscan/intern.h"
+
+extern const std::string frog_pos_set;
+extern const std::string frog_lemma_set;
+
+// The Frog annotation of one word, decoded once per sentence.
+struct tokenInfo {
+    folia::Word *word;
+    // the Frog POS tag, 0 when the word has no (unique) one. The features
+    // that are not decoded below are read from it.
+    const folia::PosAnnotation *pa;
+    CGN::Type head;
+    CGN::WVorm wvorm;
+    CGN::Position position;
+    CGN::PvTijd pvtijd;
+    CGN::ConjType conjtype;
+    bool isPunct;
+    int charCnt;
+    Intern::Id word_id;
+    Intern::Id l_word_id;
+    Intern::Id lemma_id; // EMPTY when there is no POS tag
+    Intern::Id l_lemma_id;
+};
+
+// The tokens of a folia::Sentence, in the order of s->words().
+// It interns strings, so it must be built outside of parallel sections.
+class tokenTable {
+public:
+    explicit tokenTable( const folia::Sentence* );
+    size_t size() const { return tokens.size(); };
+    const tokenInfo& operator[]( size_t i ) const { return tokens[i]; };
+    const tokenInfo *find( const folia::FoliaElement* ) const;
+    const std::vector<folia::Word*>& words() const { return wordlist; };
+    // the positions of the punctuation tokens
+    const std::set<size_t>& punctuation() const { return puncts; };
+private:
+    std::vector<folia::Word*> wordlist;
+    std::vector<tokenInfo> tokens;
+    std::unordered_map<const folia::FoliaElement*,size_t> positions;
+    std::set<size_t> puncts;
+};
+
+#endif /* TOKENS_H */
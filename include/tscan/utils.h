@@ -7,18 +7,54 @@
 #include <string>
 #include <fstream>
 #include <iostream>
+#include <type_traits>
 #include "ticcutils/StringOps.h"
 #include "libfolia/folia.h"
+#include "tscan/intern.h"
 
 static std::string suffixesArray[] = { "e", "en", "s" };
 
 void addOneMetric( folia::Document*, folia::FoliaElement*, const std::string&, const std::string& );
+std::string formatInteger( long long );
+std::string formatUnsigned( unsigned long long );
+std::string formatDouble( double );
+
+/**
+ * Formats a number the way an ostream does by default, without the
+ * cost of a stringstream.
+ */
+template <typename T>
+std::string formatNumber( T val ){
+  static_assert( std::is_arithmetic<T>::value, "formatNumber: not a number" );
+  if ( std::is_floating_point<T>::value )
+    return formatDouble( val );
+  else if ( std::is_signed<T>::value )
+    return formatInteger( val );
+  else
+    return formatUnsigned( val );
+}
+
+/**
+ * Adds a Metric with a numeric value.
+ */
+template <typename T>
+typename std::enable_if<std::is_arithmetic<T>::value>::type
+addOneMetric( folia::Document *doc, folia::FoliaElement *parent,
+	      const std::string& cls, T val ){
+  addOneMetric( doc, parent, cls, formatNumber( val ) );
+}
+
+enum vnw_class { VNW_1S, VNW_2S, VNW_3SM, VNW_3SF, VNW_1P, VNW_2P, VNW_3P,
+		 N_VNW_CLASSES };
+unsigned int pronoun_classes( const std::string& );
 void argument_overlap( const std::string&, const std::vector<std::string>&, int& );
 std::istream& safe_getline( std::istream&, std::string& );
 void updateCounter( std::map<std::string, int>&, std::map<std::string, int>);
 std::string toStringCounter( std::map<std::string, int>);
 std::string toMString( double d );
 std::string escape_quotes(const std::string &before);
+std::string tempName( const std::string& );
+bool commitFile( std::ofstream&, const std::string&, const std::string& );
 
 /**
  * Search a maps for the passed word and also tries searching it
@@ -76,6 +112,31 @@ template<class M> void aggregate( M& out, const M& in ){
   }
 }
 
+/**
+ * A sliding window over the last n words or lemmas, for the document
+ * overlap. It keeps a count per token and per pronoun class of the
+ * window contents, so both adding a token and testing for overlap take
+ * constant time.
+ */
+class overlapWindow {
+ public:
+  explicit overlapWindow( size_t n ):
+    ring( n ), oldest( 0 ), filled( 0 ), class_counts() {};
+  bool full() const { return filled == ring.size(); };
+  bool overlaps( Intern::Id, unsigned int ) const;
+  void push( Intern::Id, unsigned int );
+ private:
+  struct entry {
+    Intern::Id id;
+    unsigned int classes;
+  };
+  std::vector<entry> ring;
+  size_t oldest;
+  size_t filled;
+  std::vector<int> counts;
+  int class_counts[N_VNW_CLASSES];
+};
+
 struct proportion {
   proportion( double d1, double d2 ) {
     if ( d2 == 0 || std::isnan(d1) || std::isnan(d2) )
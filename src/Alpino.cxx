@@ -21,12 +21,13 @@
 */
 
 #include "tscan/Alpino.h"
+#include "tscan/log.h"
 #include "ticcutils/Unicode.h"
 
 using namespace std;
 
 
-string MMtoString( const multimap<DD_type, int>& mm, DD_type t ){
+double MMaverage( const multimap<DD_type, int>& mm, DD_type t ){
   size_t len = mm.count(t);
   if ( len > 0 ){
     int result = 0;
@@ -35,10 +36,18 @@ string MMtoString( const multimap<DD_type, int>& mm, DD_type t ){
    ++pos ){
       result += pos->second;
     }
-    return TiCC::toString( result/double(len) );
+    return result/double(len);
   }
   else
+    return NAN;
+}
+
+string MMtoString( const multimap<DD_type, int>& mm, DD_type t ){
+  double avg = MMaverage( mm, t );
+  if ( std::isnan( avg ) )
     return "NA";
+  else
+    return TiCC::toString( avg );
 }
 
 string MMtoString( const multimap<DD_type, int>& mm ){
@@ -51,7 +60,7 @@ string MMtoString( const multimap<DD_type, int>& mm ){
       if ( !std::isnan(pos->second) )
   result += pos->second;
     }
-    cerr << "MM to string " << result << "/" << len << endl;
+    TLOG( TRACE ) << "MM to string " << result << "/" << len;
     return TiCC::toString( result/double(len) );
   }
   else
@@ -72,7 +81,7 @@ xmlNode *getAlpNodeWord( xmlDoc *doc, const folia::Word *w ){
   string::size_type ppos = id.find_last_of( '.' );
   string posS = id.substr( ppos + 1 );
   if ( posS.empty() ){
-    cerr << "unable to extract a word index from " << id << endl;
+    TLOG( WARNING ) << "unable to extract a word index from " << id;
     return 0;
   }
   else {
@@ -725,34 +734,17 @@ WWform classifyVerb( const xmlNode *wnode, const string& lemma,
   }
 }
 
-int get_d_level( const folia::Sentence *s, xmlDoc *alp ){
+int get_d_level( const tokenTable& tokens, xmlDoc *alp ){
   // determine de d-level of a folia::Sentence
-  vector<folia::PosAnnotation*> poslist;
-  vector<folia::Word*> wordlist = s->words();
   int pv_counter = 0;
   int neven_counter = 0;
-  for ( size_t i=0; i < wordlist.size(); ++i ){
-    folia::Word *w = wordlist[i];
-    vector<folia::PosAnnotation*> posV = w->select<folia::PosAnnotation>("http://ilk.uvt.nl/folia/sets/frog-mbpos-cgn");
-    if ( posV.size() != 1 )
+  for ( size_t i=0; i < tokens.size(); ++i ){
+    if ( !tokens[i].pa )
       throw folia::ValueError( "word doesn't have POS tag info" );
-    folia::PosAnnotation *pa = posV[0];
-    string pos = pa->feat("head");
-    poslist.push_back( pa );
-    if ( pos == "WW" ){
-      //      cerr << "WW " << pa->xmlstring() << endl;
-      string wvorm = pa->feat("wvorm");
-      if( wvorm == "pv" )
-        ++pv_counter;
-      //      cerr << "pv_counter= " << pv_counter << endl;
-    }
-    if ( pos == "VG" ){
-      //      cerr << "VG " << pa->xmlstring() << endl;
-      string cp = pa->feat("conjtype");
-      if ( cp == "neven" )
-        ++neven_counter;
-      //      cerr << "neven_counter= " << neven_counter << endl;
-    }
+    if ( tokens[i].head == CGN::WW && tokens[i].wvorm == CGN::WV_PV )
+      ++pv_counter;
+    if ( tokens[i].head == CGN::VG && tokens[i].conjtype == CGN::NEVEN )
+      ++neven_counter;
   }
   if ( pv_counter - neven_counter > 2 ){
     // op niveau 7 staan zinnen met meerdere bijzinnen, maar deelzinnen die
@@ -797,17 +789,13 @@ int get_d_level( const folia::Sentence *s, xmlDoc *alp ){
   }
 
   // < 6
-  for ( size_t i=0; i < poslist.size(); ++i ){
+  for ( size_t i=0; i < tokens.size(); ++i ){
     // we kijken of het om een level 5 zin gaat
     // Zinnen met ondergeschikte bijzinnen
     //     ("Pietje wilde naar huis, omdat het regende.")
-    string pos = poslist[i]->feat("head");
-    if ( pos == "VG" ){
-      string cp = poslist[i]->feat("conjtype");
-      if ( cp == "onder" ){
-        if ( poslist[i]->parent()->text() != "dat" )
-          return 5;
-      }
+    if ( tokens[i].head == CGN::VG && tokens[i].conjtype == CGN::ONDER ){
+      if ( tokens[i].word->text() != "dat" )
+        return 5;
     }
   }
 
@@ -900,18 +888,11 @@ int get_d_level( const folia::Sentence *s, xmlDoc *alp ){
   }
 
   // < 3
-  for ( size_t i=0; i < poslist.size(); ++i ){
+  for ( size_t i=0; i < tokens.size(); ++i ){
     // we kijken of het om een level 2 zin gaat
     // zinnen met nevenschikkingen
-    // cerr << "bekijk " << poslist[i] << endl;
-    // cerr << "head=" << poslist[i]->feat("head") << endl;
-    // cerr << "head=" << poslist[i]->feat("headfeature") << endl;
-    string pos = poslist[i]->feat("head");
-    if ( pos == "VG" ){
-      string cp = poslist[i]->feat("conjtype");
-      if ( cp == "neven" )
-        return 2;
-    }
+    if ( tokens[i].head == CGN::VG && tokens[i].conjtype == CGN::NEVEN )
+      return 2;
   }
 
   // < 2
@@ -1100,7 +1081,7 @@ xmlDoc *AlpinoParse( const folia::Sentence *s, const string& dirname ){
   // cerr << "run: " << parseCmd << endl;
   int res = system( parseCmd.c_str() );
   if ( res ){
-    cerr << "Alpino failed: RES = " << res << endl;
+    TLOG( ERROR ) << "Alpino failed: RES = " << res;
   }
   remove( txtfile.c_str() );
   string xmlfile = dirname + "1.xml";
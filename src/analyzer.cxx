@@ -0,0 +1,4084 @@
+/*
+  T-scan
+
+  Copyright (c) 1998 - 2018
+
+  This file is part of tscan
+
+  tscan is free software; you can redistribute it and/or modify
+  it under the terms of the GNU Affero General Public License as published by
+  the Free Software Foundation; either version 3 of the License, or
+  (at your option) any later version.
+
+  tscan is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU Affere General Public License for more details.
+
+  You should have received a copy of the GNU Affero General Public License
+  along with this program; if not, see <http://www.gnu.org/licenses/>.
+
+*/
+
+#include <string>
+#include <fstream>
+#include <sstream>
+#include <cmath>
+#include <regex>
+#include <algorithm>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <atomic>
+#include <exception>
+#include <functional>
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <cerrno>
+#include "config.h"
+#ifdef HAVE_OPENMP
+#include "omp.h"
+#endif
+
+#include "ticcutils/FdStream.h"
+#include "ticcutils/ServerBase.h"
+#include "ticcutils/StringOps.h"
+#include "ticcutils/Configuration.h"
+#include "ticcutils/FileUtils.h"
+#include "ticcutils/CommandLine.h"
+#include "ticcutils/XMLtools.h"
+#include "ticcutils/Unicode.h"
+#include "libfolia/folia.h"
+#include "frog/FrogAPI.h"
+#include "tscan/Alpino.h"
+#include "tscan/cgn.h"
+#include "tscan/sem.h"
+#include "tscan/intensify.h"
+#include "tscan/formal.h"
+#include "tscan/conn.h"
+#include "tscan/general.h"
+#include "tscan/situation.h"
+#include "tscan/afk.h"
+#include "tscan/adverb.h"
+#include "tscan/ner.h"
+#include "tscan/utils.h"
+#include "tscan/ngram.h"
+#include "tscan/compress.h"
+#include "tscan/groups.h"
+#include "tscan/profile.h"
+#include "tscan/log.h"
+#include "tscan/mtld.h"
+#include "tscan/shards.h"
+#include "tscan/stats.h"
+#include "tscan/analyzer.h"
+
+using namespace std;
+
+// The state of the analysis below is private to this file: libtscan
+// shouldn't export names as common as 'config' or 'settings'.
+namespace {
+
+const string frog_morph_set = "http://ilk.uvt.nl/folia/sets/frog-mbma-nl";
+
+// ignore very small files as these are probably gibberish
+const int min_file_length = 10;
+const size_t max_length_intensify = 5;
+const size_t max_length_formal = 5;
+
+// set up by the TScan::Analyzer, see analyzer.h
+string columnsPrefix; // append the tables to columnar files, see columns.h
+bool profileMetadata = false; // embed the profile report in the FoLiA
+string probFilename = "problems.log";
+TiCC::Configuration config;
+string workdir_name;
+
+struct cf_data {
+  long int count;
+  double freq;
+};
+
+struct noun {
+  noun() :
+      type( SEM::NO_SEMTYPE ), is_compound( false ), compound_parts( 0 ){};
+  SEM::Type type;
+  bool is_compound;
+  string head;
+  string satellite_clean;
+  int compound_parts;
+};
+
+struct prevalence {
+  double percentage;
+  double zscore;
+};
+
+struct tagged_classification {
+  CGN::Type tag;
+  string classification;
+};
+
+/// @brief how many sentences are sent to Wopr per request
+enum woprLevel { WOPR_SENTENCE, WOPR_PARAGRAPH, WOPR_DOCUMENT };
+
+struct settingData {
+  void init( const TiCC::Configuration & );
+  bool doAlpino;
+  bool doAlpinoLookup;
+  bool doAlpinoServer;
+  bool saveAlpinoOutput;
+  string alpinoJournal; // where the lookup of the saved parses goes
+  bool saveAlpinoMetadata;
+  bool doWopr;
+  woprLevel woprBatchLevel;
+  string ngram_fwd_file;
+  string ngram_bwd_file;
+  bool doXfiles;
+  Compress::Type compression; // of the output files
+  Groups::selection groups; // the metric groups to produce
+  bool showProblems;
+  bool sentencePerLine;
+  string style;
+  int rarityLevel;
+  unsigned int overlapSize;
+  double freq_clip;
+  double mtld_threshold;
+  map<string, SEM::Type> adj_sem;
+  map<string, noun> noun_sem;
+  map<string, SEM::Type> verb_sem;
+  map<string, Intensify::Type> intensify;
+  map<string, Formal::Type> formal;
+  map<string, General::Type> general_nouns;
+  map<string, General::Type> general_verbs;
+  map<string, Adverb::adverb> adverbs;
+  map<string, double> pol_lex;
+  map<string, cf_data> staph_word_freq_lex;
+  long int staph_total;
+  map<string, cf_data> word_freq_lex;
+  long int word_total;
+  map<string, cf_data> lemma_freq_lex;
+  long int lemma_total;
+  map<string, top_val> top_freq_lex;
+  map<CGN::Type, set<string>> temporals1;
+  set<string> multi_temporals;
+  map<CGN::Type, set<string>> causals1;
+  set<string> multi_causals;
+  map<CGN::Type, set<string>> opsommers_wg;
+  set<string> multi_opsommers_wg;
+  map<CGN::Type, set<string>> opsommers_zin;
+  set<string> multi_opsommers_zin;
+  map<CGN::Type, set<string>> contrast1;
+  set<string> multi_contrast;
+  map<CGN::Type, set<string>> compars1;
+  set<string> multi_compars;
+  map<CGN::Type, set<string>> causal_sits;
+  set<string> multi_causal_sits;
+  map<CGN::Type, set<string>> space_sits;
+  set<string> multi_space_sits;
+  map<CGN::Type, set<string>> time_sits;
+  set<string> multi_time_sits;
+  map<CGN::Type, set<string>> emotion_sits;
+  set<string> multi_emotion_sits;
+  set<string> vzexpr2;
+  set<string> vzexpr3;
+  set<string> vzexpr4;
+  map<string, Afk::Type> afkos;
+  map<string, prevalence> prevalences;
+  map<CGN::Type, set<string>> stop_lemmata;
+  map<string, tagged_classification> my_classification;
+};
+
+/// @brief the settings as filled by the TScan::Analyzer from the config
+/// file and its options. Don't change them once the analysis has started.
+settingData writable_settings;
+/// @brief read-only view on the settings, used by the analysis
+const settingData &settings = writable_settings;
+
+/// @brief map from tokenized sentences to Alpino XML filenames. Unlike
+/// the settings it grows during the run, when parses are saved, so all
+/// access is synchronised. Once a journal is opened every added parse is
+/// appended to it right away, so the lookup survives a crash.
+class alpinoLookupTable {
+public:
+  bool fill( const string & );
+  bool find( const string &, pair<string, int> & ) const;
+  void add( const string &, const string & );
+  bool openJournal( const string & );
+  bool save( const string & );
+  void clear();
+
+private:
+  mutable mutex lock;
+  map<string, pair<string, int>> entries;
+  ofstream journal;
+  string journalName;
+};
+
+alpinoLookupTable alpinoLookup;
+
+/// @brief the in-process language models that replace the Wopr servers,
+/// when configured. Read-only once opened.
+NGram::model ngram_fwd;
+NGram::model ngram_bwd;
+
+} // namespace
+
+string unique_filename( const string &filename, const string &extension );
+
+bool fillAlpinoLookup( map<string, pair<string, int>> &m, istream &is ) {
+  string line;
+  while ( safe_getline( is, line ) ) {
+    // Trim the lines
+    line = TiCC::trim( line );
+    if ( line.empty() )
+      continue;
+
+    // Split at a tab; the line should contain three values (tokens, filename and offset)
+    vector<string> parts;
+    int i = TiCC::split_at( line, parts, "\t" );
+    if ( i != 3 ) {
+      cerr << "skip line: " << line << " (expected 3 values, got " << i << ")" << endl;
+      continue;
+    }
+
+    // It contains the tokens, the Alpino XML filename and Alpino_DS index
+    m[parts[0]] = make_pair( parts[1], TiCC::stringTo<int>( parts[2] ) );
+  }
+  return true;
+}
+
+bool fillAlpinoLookup( map<string, pair<string, int>> &m, const string &filename ) {
+  string data;
+  if ( Compress::readFile( filename, data ) ) {
+    istringstream is( data );
+    return fillAlpinoLookup( m, is );
+  }
+  else {
+    cerr << "couldn't open file: " << filename << endl;
+  }
+  return false;
+}
+
+bool saveAlpinoLookup( const map<string, pair<string, int>> &m, const string &filename ) {
+  string tmp = tempName( filename );
+  ofstream out( tmp );
+  if ( out ) {
+    auto it = m.begin();
+    while ( it != m.end() ) {
+      auto tokens = it->first;
+      auto filename = it->second.first;
+      auto index = it->second.second;
+      out << tokens << "\t" << filename << "\t" << index << "\n";
+      ++it;
+    }
+    if ( commitFile( out, tmp, filename ) ) {
+      cerr << "stored Alpino lookup in " << filename << endl;
+      return true;
+    }
+  }
+  cerr << "storing Alpino lookup in " << filename << " FAILED!" << endl;
+  return false;
+}
+
+bool alpinoLookupTable::fill( const string &filename ) {
+  lock_guard<mutex> guard( lock );
+  return fillAlpinoLookup( entries, filename );
+}
+
+bool alpinoLookupTable::find( const string &tokens,
+                              pair<string, int> &location ) const {
+  lock_guard<mutex> guard( lock );
+  auto it = entries.find( tokens );
+  if ( it == entries.end() ) {
+    return false;
+  }
+  location = it->second;
+  return true;
+}
+
+void alpinoLookupTable::add( const string &tokens, const string &filename ) {
+  lock_guard<mutex> guard( lock );
+  entries[tokens] = make_pair( filename, 0 );
+  if ( journal.is_open() ) {
+    journal << tokens << "\t" << filename << "\t" << 0 << endl;
+  }
+}
+
+/// @brief Starts writing the lookup to a journal. The entries an earlier
+/// run wrote to it are read first, and used as well; the entries known
+/// so far that it lacks are appended, as are the ones added later.
+/// @param filename the name of the journal
+/// @return false when the journal can't be read or opened
+bool alpinoLookupTable::openJournal( const string &filename ) {
+  lock_guard<mutex> guard( lock );
+  journalName = filename;
+  map<string, pair<string, int>> journaled;
+  struct stat sbuf;
+  if ( stat( journalName.c_str(), &sbuf ) == 0 ) {
+    if ( !fillAlpinoLookup( journaled, journalName ) ) {
+      return false;
+    }
+    cerr << "read " << journaled.size() << " Alpino parses from "
+         << journalName << endl;
+  }
+  journal.open( journalName, ios::app );
+  if ( !journal ) {
+    cerr << "unable to open Alpino lookup '" << journalName << "'" << endl;
+    return false;
+  }
+  for ( const auto &it : entries ) {
+    if ( journaled.find( it.first ) == journaled.end() ) {
+      journal << it.first << "\t" << it.second.first << "\t"
+              << it.second.second << "\n";
+    }
+  }
+  journal.flush();
+  // the parses of the earlier runs are the more recent ones
+  for ( const auto &it : journaled ) {
+    entries[it.first] = it.second;
+  }
+  return true;
+}
+
+/// @brief Writes the lookup, sorted and without duplicates. It replaces
+/// the journal when there is one, keeping what other runs appended to it
+/// in the meantime.
+bool alpinoLookupTable::save( const string &filename ) {
+  lock_guard<mutex> guard( lock );
+  if ( journal.is_open() ) {
+    journal.close();
+    map<string, pair<string, int>> journaled;
+    fillAlpinoLookup( journaled, journalName );
+    entries.insert( journaled.begin(), journaled.end() );
+    return saveAlpinoLookup( entries, journalName );
+  }
+  return saveAlpinoLookup( entries,
+                           unique_filename( filename, ".alpino_lookup.data" ) );
+}
+
+/// @brief Forgets the entries, and stops the journal without saving it.
+void alpinoLookupTable::clear() {
+  lock_guard<mutex> guard( lock );
+  if ( journal.is_open() ) {
+    journal.close();
+  }
+  journalName.clear();
+  entries.clear();
+}
+
+bool fillN( map<string, noun> &m, istream &is ) {
+  string line;
+  while ( safe_getline( is, line ) ) {
+    // Trim the lines
+    line = TiCC::trim( line );
+    if ( line.empty() )
+      continue;
+
+    // Split at a tab; the line should contain either 3 (non-compounds) or 6 (compounds) values
+    vector<string> parts;
+    int i = TiCC::split_at( line, parts, "\t" );
+    if ( i != 3 && i != 6 ) {
+      cerr << "skip line: " << line << " (expected 3 or 6 values, got " << i << ")" << endl;
+      continue;
+    }
+
+    // Classify the noun, set the compound values and add the noun to the map
+    noun n;
+    n.type = SEM::classifyNoun( parts[1] );
+    n.is_compound = parts[2] == "1";
+    if ( n.is_compound ) {
+      n.head = parts[3];
+      n.satellite_clean = parts[4];
+      n.compound_parts = atoi( parts[5].c_str() );
+    }
+    m[parts[0]] = n;
+  }
+  return true;
+}
+
+bool fillN( map<string, noun> &m, const string &filename ) {
+  ifstream is( filename.c_str() );
+  if ( is ) {
+    return fillN( m, is );
+  }
+  else {
+    cerr << "couldn't open file: " << filename << endl;
+  }
+  return false;
+}
+
+bool fillWW( map<string, SEM::Type> &m, istream &is ) {
+  string line;
+  while ( safe_getline( is, line ) ) {
+    line = TiCC::trim( line );
+    if ( line.empty() )
+      continue;
+    vector<string> parts;
+    int n = TiCC::split_at( line, parts, "\t" ); // split at tab
+    if ( n != 3 ) {
+      cerr << "skip line: " << line << " (expected 3 values, got "
+           << n << ")" << endl;
+      continue;
+    }
+    SEM::Type res = SEM::classifyWW( parts[1], parts[2] );
+    if ( res != SEM::UNFOUND_VERB ) {
+      // no use to store undefined values
+      m[parts[0]] = res;
+    }
+  }
+  return true;
+}
+
+bool fillADJ( map<string, SEM::Type> &m, istream &is ) {
+  string line;
+  while ( safe_getline( is, line ) ) {
+    line = TiCC::trim( line );
+    if ( line.empty() )
+      continue;
+    vector<string> parts;
+    int n = TiCC::split_at( line, parts, "\t" ); // split at tab
+    if ( n < 2 || n > 3 ) {
+      cerr << "skip line: " << line << " (expected 2 or 3 values, got "
+           << n << ")" << endl;
+      continue;
+    }
+    SEM::Type res = SEM::UNFOUND_ADJ;
+    if ( n == 2 ) {
+      res = SEM::classifyADJ( parts[1] );
+    }
+    else {
+      res = SEM::classifyADJ( parts[1], parts[2] );
+    }
+    string low = TiCC::lowercase( parts[0] );
+    if ( m.find( low ) != m.end() ) {
+      cerr << "Information: multiple entry '" << low << "' in ADJ lex" << endl;
+    }
+    if ( res != SEM::UNFOUND_ADJ ) {
+      // no use to store undefined values
+      m[low] = res;
+    }
+  }
+  return true;
+}
+
+bool fill( CGN::Type tag, map<string, SEM::Type> &m, const string &filename ) {
+  ifstream is( filename.c_str() );
+  if ( is ) {
+    if ( tag == CGN::WW )
+      return fillWW( m, is );
+    else if ( tag == CGN::ADJ )
+      return fillADJ( m, is );
+  }
+  else {
+    cerr << "couldn't open file: " << filename << endl;
+  }
+  return false;
+}
+
+bool fill_intensify( map<string, Intensify::Type> &m, istream &is ) {
+  string line;
+  while ( safe_getline( is, line ) ) {
+    line = TiCC::trim( line );
+    if ( line.empty() )
+      continue;
+    vector<string> parts;
+    int n = TiCC::split_at( line, parts, "\t" ); // split at tab
+    if ( n < 2 || n > 2 ) {
+      cerr << "skip line: " << line << " (expected 2 values, got "
+           << n << ")" << endl;
+      continue;
+    }
+    string low = TiCC::trim( TiCC::lowercase( parts[0] ) );
+    Intensify::Type res = Intensify::classify( TiCC::lowercase( parts[1] ) );
+    if ( m.find( low ) != m.end() ) {
+      cerr << "Information: multiple entry '" << low << "' in Intensify lex" << endl;
+    }
+    if ( res != Intensify::NO_INTENSIFY ) {
+      // no use to store undefined values
+      m[low] = res;
+    }
+  }
+  return true;
+}
+
+bool fill_intensify( map<string, Intensify::Type> &m, const string &filename ) {
+  ifstream is( filename.c_str() );
+  if ( is ) {
+    return fill_intensify( m, is );
+  }
+  else {
+    cerr << "couldn't open file: " << filename << endl;
+  }
+  return false;
+}
+
+bool fill_general( map<string, General::Type> &m, istream &is ) {
+  string line;
+  while ( safe_getline( is, line ) ) {
+    line = TiCC::trim( line );
+    if ( line.empty() )
+      continue;
+    vector<string> parts;
+    int n = TiCC::split_at( line, parts, "\t" ); // split at tab
+    if ( n < 2 || n > 2 ) {
+      cerr << "skip line: " << line << " (expected 2 values, got "
+           << n << ")" << endl;
+      continue;
+    }
+    string low = TiCC::trim( TiCC::lowercase( parts[0] ) );
+    General::Type res = General::classify( TiCC::lowercase( parts[1] ) );
+    if ( m.find( low ) != m.end() ) {
+      cerr << "Information: multiple entry '" << low << "' in general lex" << endl;
+    }
+    if ( res != General::NO_GENERAL ) {
+      // no use to store undefined values
+      m[low] = res;
+    }
+  }
+  return true;
+}
+
+bool fill_general( map<string, General::Type> &m, const string &filename ) {
+  ifstream is( filename.c_str() );
+  if ( is ) {
+    return fill_general( m, is );
+  }
+  else {
+    cerr << "couldn't open file: " << filename << endl;
+  }
+  return false;
+}
+
+bool fill_adverbs( map<string, Adverb::adverb> &m, istream &is ) {
+  string line;
+  while ( safe_getline( is, line ) ) {
+    line = TiCC::trim( line );
+    if ( line.empty() )
+      continue;
+    vector<string> parts;
+    int n = TiCC::split_at( line, parts, "\t" ); // split at tab
+    if ( n != 3 ) {
+      cerr << "skip line: " << line << " (expected 3 values, got "
+           << n << ")" << endl;
+      continue;
+    }
+    string low = TiCC::trim( TiCC::lowercase( parts[0] ) );
+    Adverb::adverb a;
+    a.type = Adverb::classifyType( TiCC::lowercase( parts[1] ) );
+    a.subtype = Adverb::classifySubType( TiCC::lowercase( parts[2] ) );
+    if ( m.find( low ) != m.end() ) {
+      cerr << "Information: multiple entry '" << low << "' in adverbs lex" << endl;
+    }
+    if ( a.type != Adverb::NO_ADVERB ) {
+      // no use to store undefined values
+      m[low] = a;
+    }
+  }
+  return true;
+}
+
+bool fill_adverbs( map<string, Adverb::adverb> &m, const string &filename ) {
+  ifstream is( filename.c_str() );
+  if ( is ) {
+    return fill_adverbs( m, is );
+  }
+  else {
+    cerr << "couldn't open file: " << filename << endl;
+  }
+  return false;
+}
+
+bool fill_freqlex( map<string, cf_data> &m, long int &total, istream &is ) {
+  total = 0;
+  string line;
+  while ( safe_getline( is, line ) ) {
+    line = TiCC::trim( line );
+    if ( line.empty() )
+      continue;
+    vector<string> parts;
+    size_t n = TiCC::split_at( line, parts, "\t" ); // split at tabs
+    if ( n != 4 ) {
+      cerr << "skip line: " << line << " (expected 4 values, got "
+           << n << ")" << endl;
+      continue;
+    }
+    cf_data data;
+    data.count = TiCC::stringTo<long int>( parts[1] );
+    data.freq = TiCC::stringTo<double>( parts[3] );
+    if ( data.count == 1 ) {
+      // we are done. Skip all singleton stuff
+      return true;
+    }
+    if ( settings.freq_clip > 0 ) {
+      // skip low frequent word, when desired
+      if ( data.freq > settings.freq_clip ) {
+        return true;
+      }
+    }
+    total += data.count;
+    m[parts[0]] = data;
+  }
+  return true;
+}
+
+bool fill_freqlex( map<string, cf_data> &m, long int &total,
+                   const string &filename ) {
+  ifstream is( filename.c_str() );
+  if ( is ) {
+    fill_freqlex( m, total, is );
+    cout << "read " << filename << " (" << total << " entries)" << endl;
+    return true;
+  }
+  else {
+    cerr << "couldn't open file: " << filename << endl;
+  }
+  return false;
+}
+
+bool fill_topvals( map<string, top_val> &m, istream &is ) {
+  string line;
+  int line_count = 0;
+  top_val val = top2000;
+  while ( safe_getline( is, line ) ) {
+    line = TiCC::trim( line );
+    if ( line.empty() )
+      continue;
+    ++line_count;
+    if ( line_count > 10000 )
+      val = top20000;
+    else if ( line_count > 5000 )
+      val = top10000;
+    else if ( line_count > 3000 )
+      val = top5000;
+    else if ( line_count > 2000 )
+      val = top3000;
+    else if ( line_count > 1000 )
+      val = top2000;
+    else
+      val = top1000;
+    vector<string> parts;
+    size_t n = TiCC::split_at( line, parts, "\t" ); // split at tabs
+    if ( n != 4 ) {
+      cerr << "skip line: " << line << " (expected 2 values, got "
+           << n << ")" << endl;
+      continue;
+    }
+    m[parts[0]] = val;
+  }
+  return true;
+}
+
+bool fill_topvals( map<string, top_val> &m, const string &filename ) {
+  ifstream is( filename.c_str() );
+  if ( is ) {
+    return fill_topvals( m, is );
+  }
+  else {
+    cerr << "couldn't open file: " << filename << endl;
+  }
+  return false;
+}
+
+bool fill_connectors( map<CGN::Type, set<string>> &c1,
+                      set<string> &cM,
+                      istream &is ) {
+  cM.clear();
+  string line;
+  while ( safe_getline( is, line ) ) {
+    // a line is supposed to be :
+    // a comment, starting with '#'
+    // like: '# comment'
+    // OR an entry of 1 to 4 words seperated by a single space
+    // like: 'dus' OR 'de facto'
+    // OR the 1 word followed by a TAB ('\t') and a CGN tag
+    // like: 'maar   VG'
+    line = TiCC::trim( line );
+    if ( line.empty() || line[0] == '#' )
+      continue;
+    vector<string> vec;
+    int n = TiCC::split_at( line, vec, "\t" );
+    if ( n == 0 || n > 2 ) {
+      cerr << "skip line: " << line << " (expected 1 or 2 values, got "
+           << n << ")" << endl;
+      continue;
+    }
+    CGN::Type tag = CGN::UNASS;
+    if ( n == 2 ) {
+      tag = CGN::toCGN( vec[1] );
+    }
+    vector<string> dum;
+    n = TiCC::split_at( vec[0], dum, " " );
+    if ( n < 1 || n > 4 ) {
+      cerr << "skip line: " << line
+           << " (expected 1, to 4 values in the first part: " << vec[0]
+           << ", got " << n << ")" << endl;
+      continue;
+    }
+    if ( n == 1 ) {
+      c1[tag].insert( vec[0] );
+    }
+    else if ( tag != CGN::UNASS ) {
+      cerr << "skip line: " << line
+           << " (no GCN tag info allowed for multiword entries) " << endl;
+      continue;
+    }
+    else {
+      cM.insert( vec[0] );
+    }
+  }
+  return true;
+}
+
+bool fill_connectors( map<CGN::Type, set<string>> &c1,
+                      set<string> &cM,
+                      const string &filename ) {
+  ifstream is( filename.c_str() );
+  if ( is ) {
+    return fill_connectors( c1, cM, is );
+  }
+  else {
+    cerr << "couldn't open file: " << filename << endl;
+  }
+  return false;
+}
+
+bool fill_vzexpr( set<string> &vz2, set<string> &vz3, set<string> &vz4,
+                  istream &is ) {
+  string line;
+  while ( safe_getline( is, line ) ) {
+    // a line is supposed to be :
+    // a comment, starting with '#'
+    // like: '# comment'
+    // OR an entry of 2, 3 or 4 words seperated by whitespace
+    line = TiCC::trim( line );
+    if ( line.empty() || line[0] == '#' )
+      continue;
+    vector<string> vec;
+    int n = TiCC::split_at_first_of( line, vec, " \t" );
+    if ( n == 0 || n > 4 ) {
+      cerr << "skip line: " << line << " (expected 2, 3 or 4 values, got "
+           << n << ")" << endl;
+      continue;
+    }
+    string expression;
+    switch ( n ) {
+      case 2: {
+        expression = vec[0] + " " + vec[1];
+        vz2.insert( expression );
+      } break;
+      case 3: {
+        expression = vec[0] + " " + vec[1] + " " + vec[2];
+        vz3.insert( expression );
+      } break;
+      case 4: {
+        expression = vec[0] + " " + vec[1] + " " + vec[2] + " " + vec[3];
+        vz4.insert( expression );
+      } break;
+      default:
+        throw logic_error( "switch out of range" );
+    }
+  }
+  return true;
+}
+
+bool fill_vzexpr( set<string> &vz2, set<string> &vz3, set<string> &vz4,
+                  const string &filename ) {
+  ifstream is( filename.c_str() );
+  if ( is ) {
+    return fill_vzexpr( vz2, vz3, vz4, is );
+  }
+  else {
+    cerr << "couldn't open file: " << filename << endl;
+  }
+  return false;
+}
+
+bool fill( map<string, Afk::Type> &afkos, istream &is ) {
+  string line;
+  while ( safe_getline( is, line ) ) {
+    Afk::Type afkType;
+    // a line is supposed to be :
+    // a comment, starting with '#'
+    // like: '# comment'
+    // OR an entry of 2 words seperated by whitespace
+    line = TiCC::trim( line );
+    if ( line.empty() || line[0] == '#' )
+      continue;
+    vector<string> vec;
+    int n = TiCC::split_at_first_of( line, vec, " \t" );
+    if ( n < 2 ) {
+      cerr << "skip line: " << line << " (expected at least 2 values, got "
+           << n << ")" << endl;
+      continue;
+    }
+    if ( n == 2 ) {
+      afkType = Afk::classify( vec[1] );
+      if ( afkType != Afk::NO_A )
+        afkos[vec[0]] = afkType;
+    }
+    else if ( n == 3 ) {
+      afkType = Afk::classify( vec[2] );
+      if ( afkType != Afk::NO_A ) {
+        string s = vec[0] + " " + vec[1];
+        afkos[s] = afkType;
+      }
+    }
+    else if ( n == 4 ) {
+      afkType = Afk::classify( vec[3] );
+      if ( afkType != Afk::NO_A ) {
+        string s = vec[0] + " " + vec[1] + " " + vec[2];
+        afkos[s] = afkType;
+      }
+    }
+    else {
+      cerr << "skip line: " << line << " (expected at most 4 values, got "
+           << n << ")" << endl;
+      continue;
+    }
+  }
+  return true;
+}
+
+bool fill( map<string, Afk::Type> &afks, const string &filename ) {
+  ifstream is( filename.c_str() );
+  if ( is ) {
+    return fill( afks, is );
+  }
+  else {
+    cerr << "couldn't open file: " << filename << endl;
+  }
+  return false;
+}
+
+bool fill_prevalences( map<string, prevalence> &prevalences, istream &is ) {
+  string line;
+  while ( safe_getline( is, line ) ) {
+    // a line is supposed to be :
+    // a comment, starting with '#'
+    // like: '# comment'
+    // OR: a lemma with prevalence values in columns 2 and 3
+    line = TiCC::trim( line );
+    if ( line.empty() || line[0] == '#' )
+      continue;
+    vector<string> vec;
+    int n = TiCC::split_at_first_of( line, vec, " \t" );
+    if ( n != 6 ) {
+      cerr << "skip line: " << line << " (expected 6 values, got " << n << ")" << endl;
+      continue;
+    }
+    else {
+      prevalence p;
+      p.percentage = TiCC::stringTo<double>( vec[2] );
+      p.zscore = TiCC::stringTo<double>( vec[3] );
+      prevalences[vec[0]] = p;
+    }
+  }
+  return true;
+}
+
+bool fill_prevalences( map<string, prevalence> &prevalences, const string &filename ) {
+  ifstream is( filename.c_str() );
+  if ( is ) {
+    return fill_prevalences( prevalences, is );
+  }
+  else {
+    cerr << "couldn't open file: " << filename << endl;
+  }
+  return false;
+}
+
+bool fill_formal( map<string, Formal::Type> &formal, istream &is ) {
+  string line;
+  while ( safe_getline( is, line ) ) {
+    // a line is supposed to be :
+    // a comment, starting with '#'
+    // like: '# comment'
+    // OR: a lemma which is formal with their type in column 2
+    line = TiCC::trim( line );
+    if ( line.empty() || line[0] == '#' )
+      continue;
+    vector<string> vec;
+    int n = TiCC::split_at( line, vec, "\t" );
+    if ( n != 2 ) {
+      cerr << "skip line: " << line << " (expected 2 values, got " << n << ")" << endl;
+      continue;
+    }
+    else {
+      formal[vec[0]] = Formal::classify( TiCC::lowercase( vec[1] ) );
+    }
+  }
+  return true;
+}
+
+bool fill_formal( map<string, Formal::Type> &formal, const string &filename ) {
+  ifstream is( filename.c_str() );
+  if ( is ) {
+    return fill_formal( formal, is );
+  }
+  else {
+    cerr << "couldn't open file: " << filename << endl;
+  }
+  return false;
+}
+
+bool fill_stop_lemmata( map<CGN::Type, set<string>> &stop_lemmata, istream &is ) {
+  string line;
+  while ( safe_getline( is, line ) ) {
+    // a line is supposed to be :
+    // a comment, starting with '#'
+    // like: '# comment'
+    // OR: a lemma followed by an optional CGN tag
+    line = TiCC::trim( line );
+    if ( line.empty() || line[0] == '#' )
+      continue;
+    vector<string> vec;
+    int n = TiCC::split_at_first_of( line, vec, " \t" );
+    if ( n == 0 || n > 2 ) {
+      cerr << "skip line: " << line << " (expected 1 or 2 values, got "
+           << n << ")" << endl;
+      continue;
+    }
+    CGN::Type tag = CGN::UNASS;
+    if ( n == 2 ) {
+      tag = CGN::toCGN( vec[1] );
+    }
+    stop_lemmata[tag].insert( vec[0] );
+  }
+  return true;
+}
+
+bool fill_stop_lemmata( map<CGN::Type, set<string>> &stop_lemmata, const string &filename ) {
+  ifstream is( filename.c_str() );
+  if ( is ) {
+    return fill_stop_lemmata( stop_lemmata, is );
+  }
+  else {
+    cerr << "couldn't open file: " << filename << endl;
+  }
+  return false;
+}
+
+bool fill( map<string, tagged_classification> &my_classification, istream &is ) {
+  string line;
+  while ( safe_getline( is, line ) ) {
+    // a line is supposed to be :
+    // a comment, starting with '#'
+    // like: '# comment'
+    // OR: a lemma with an optional pos-tag, followed by a categorization
+    line = TiCC::trim( line );
+    if ( line.empty() || line[0] == '#' )
+      continue;
+    vector<string> vec;
+    int n = TiCC::split_at_first_of( line, vec, " \t" );
+    if ( n < 2 ) {
+      cerr << "skip line: " << line << " (expected at least 2 values, got " << n << ")" << endl;
+      continue;
+    }
+    if ( n == 2 ) {
+      tagged_classification tc;
+      tc.tag = CGN::UNASS;
+      tc.classification = vec[1];
+      my_classification[vec[0]] = tc;
+    }
+    else if ( n == 3 ) {
+      tagged_classification tc;
+      tc.tag = CGN::toCGN( vec[1] );
+      tc.classification = vec[2];
+      my_classification[vec[0]] = tc;
+    }
+    else {
+      cerr << "skip line: " << line << " (expected at most 3 values, got " << n << ")" << endl;
+      continue;
+    }
+  }
+  return true;
+}
+
+bool fill( map<string, tagged_classification> &my_classification, const string &filename ) {
+  ifstream is( filename.c_str() );
+  if ( is ) {
+    return fill( my_classification, is );
+  }
+  else {
+    cerr << "couldn't open file: " << filename << endl;
+  }
+  return false;
+}
+
+void settingData::init( const TiCC::Configuration &cf ) {
+  doXfiles = true;
+  compression = Compress::NONE;
+  doAlpino = false;
+  doAlpinoServer = false;
+  string val = cf.lookUp( "useAlpinoServer" );
+  if ( !val.empty() ) {
+    if ( !TiCC::stringTo( val, doAlpinoServer ) ) {
+      throw runtime_error( "invalid value for 'useAlpinoServer' in config file" );
+    }
+  }
+  if ( !doAlpinoServer ) {
+    val = cf.lookUp( "useAlpino" );
+    if ( !TiCC::stringTo( val, doAlpino ) ) {
+      throw runtime_error( "invalid value for 'useAlpino' in config file" );
+    }
+  }
+  saveAlpinoOutput = false;
+  val = cf.lookUp( "saveAlpinoOutput" );
+  if ( !val.empty() ) {
+    if ( !TiCC::stringTo( val, saveAlpinoOutput ) ) {
+      throw runtime_error( "invalid value for 'saveAlpinoOutput' in config file" );
+    }
+  }
+  alpinoJournal = cf.lookUp( "alpino_journal" );
+  if ( alpinoJournal.empty() ) {
+    alpinoJournal = "out.alpino_lookup.data";
+  }
+  saveAlpinoMetadata = false;
+  if ( saveAlpinoOutput ) {
+    val = cf.lookUp( "saveAlpinoMetadata" );
+    if ( !val.empty() ) {
+      if ( !TiCC::stringTo( val, saveAlpinoMetadata ) ) {
+        throw runtime_error( "invalid value for 'saveAlpinoMetadata' in config file" );
+      }
+    }
+  }
+  doWopr = false;
+  val = cf.lookUp( "useWopr" );
+  if ( !val.empty() ) {
+    if ( !TiCC::stringTo( val, doWopr ) ) {
+      throw runtime_error( "invalid value for 'useWopr' in config file" );
+    }
+  }
+  woprBatchLevel = WOPR_SENTENCE;
+  val = cf.lookUp( "batch", "wopr" );
+  if ( val == "paragraph" ) {
+    woprBatchLevel = WOPR_PARAGRAPH;
+  }
+  else if ( val == "document" ) {
+    woprBatchLevel = WOPR_DOCUMENT;
+  }
+  else if ( !val.empty() && val != "sentence" ) {
+    throw runtime_error( "invalid value for 'batch' in the [[wopr]] section of the config file" );
+  }
+  ngram_fwd_file = cf.lookUp( "model_fwd", "wopr" );
+  ngram_bwd_file = cf.lookUp( "model_bwd", "wopr" );
+  if ( ngram_fwd_file.empty() != ngram_bwd_file.empty() ) {
+    throw runtime_error( "the [[wopr]] section of the config file needs both 'model_fwd' and 'model_bwd', or neither" );
+  }
+  showProblems = true;
+  val = cf.lookUp( "logProblems" );
+  if ( !val.empty() ) {
+    if ( !TiCC::stringTo( val, showProblems ) ) {
+      throw runtime_error( "invalid value for 'showProblems' in config file" );
+    }
+  }
+  sentencePerLine = false;
+  val = cf.lookUp( "sentencePerLine" );
+  if ( !val.empty() ) {
+    if ( !TiCC::stringTo( val, sentencePerLine ) ) {
+      throw runtime_error( "invalid value for 'sentencePerLine' in config file" );
+    }
+  }
+  val = cf.lookUp( "styleSheet" );
+  if ( !val.empty() ) {
+    style = val;
+  }
+  val = cf.lookUp( "rarityLevel" );
+  if ( val.empty() ) {
+    rarityLevel = 10;
+  }
+  else if ( !TiCC::stringTo( val, rarityLevel ) ) {
+    cerr << "invalid value for 'rarityLevel' in config file" << endl;
+  }
+  val = cf.lookUp( "overlapSize" );
+  if ( val.empty() ) {
+    overlapSize = 50;
+  }
+  else if ( !TiCC::stringTo( val, overlapSize ) ) {
+    throw runtime_error( "invalid value for 'overlapSize' in config file" );
+  }
+  val = cf.lookUp( "frequencyClip" );
+  if ( val.empty() ) {
+    freq_clip = 90;
+  }
+  else if ( !TiCC::stringTo( val, freq_clip )
+            || ( freq_clip < 0 ) || ( freq_clip > 100 ) ) {
+    throw runtime_error( "invalid value for 'frequencyClip' in config file" );
+  }
+  val = cf.lookUp( "mtldThreshold" );
+  if ( val.empty() ) {
+    mtld_threshold = 0.720;
+  }
+  else if ( !TiCC::stringTo( val, mtld_threshold )
+            || ( mtld_threshold < 0 ) || ( mtld_threshold > 1.0 ) ) {
+    throw runtime_error( "invalid value for 'frequencyClip' in config file" );
+  }
+
+  groups = Groups::selection();
+  val = cf.lookUp( "groups" );
+  if ( !val.empty() ) {
+    string error;
+    if ( !groups.parse( val, error ) ) {
+      throw runtime_error( "invalid value for 'groups' in config file: " + error );
+    }
+  }
+
+  val = cf.lookUp( "alpino_lookup" );
+  if ( !val.empty() ) {
+    doAlpinoLookup = true;
+    if ( !alpinoLookup.fill( val ) )
+      throw runtime_error( "unable to read '" + val + "'" );
+  }
+  else {
+    doAlpinoLookup = false;
+  }
+
+  val = cf.lookUp( "adj_semtypes" );
+  if ( !val.empty() ) {
+    if ( !fill( CGN::ADJ, adj_sem, val ) ) // 20150316: Full path necessary to allow custom input
+      throw runtime_error( "unable to read '" + val + "'" );
+  }
+  val = cf.lookUp( "noun_semtypes" );
+  if ( !val.empty() ) {
+    if ( !fillN( noun_sem, val ) ) // 20141121: Full path necessary to allow custom input
+      throw runtime_error( "unable to read '" + val + "'" );
+  }
+  val = cf.lookUp( "verb_semtypes" );
+  if ( !val.empty() ) {
+    if ( !fill( CGN::WW, verb_sem, cf.configDir() + "/" + val ) )
+      throw runtime_error( "unable to read '" + val + "'" );
+  }
+  val = cf.lookUp( "intensify" );
+  if ( !val.empty() ) {
+    if ( !fill_intensify( intensify, val ) )
+      throw runtime_error( "unable to read '" + val + "'" );
+  }
+  val = cf.lookUp( "general_nouns" );
+  if ( !val.empty() ) {
+    if ( !fill_general( general_nouns, cf.configDir() + "/" + val ) )
+      throw runtime_error( "unable to read '" + val + "'" );
+  }
+  val = cf.lookUp( "general_verbs" );
+  if ( !val.empty() ) {
+    if ( !fill_general( general_verbs, cf.configDir() + "/" + val ) )
+      throw runtime_error( "unable to read '" + val + "'" );
+  }
+  val = cf.lookUp( "adverbs" );
+  if ( !val.empty() ) {
+    if ( !fill_adverbs( adverbs, cf.configDir() + "/" + val ) )
+      throw runtime_error( "unable to read '" + val + "'" );
+  }
+  staph_total = 0;
+  val = cf.lookUp( "staph_word_freq_lex" );
+  if ( !val.empty() ) {
+    if ( !fill_freqlex( staph_word_freq_lex, staph_total,
+                        cf.configDir() + "/" + val ) )
+      throw runtime_error( "unable to read '" + val + "'" );
+  }
+  word_total = 0;
+  val = cf.lookUp( "word_freq_lex" );
+  if ( !val.empty() ) {
+    if ( !fill_freqlex( word_freq_lex, word_total,
+                        cf.configDir() + "/" + val ) )
+      throw runtime_error( "unable to read '" + val + "'" );
+  }
+  lemma_total = 0;
+  val = cf.lookUp( "lemma_freq_lex" );
+  if ( !val.empty() ) {
+    if ( !fill_freqlex( lemma_freq_lex, lemma_total,
+                        cf.configDir() + "/" + val ) )
+      throw runtime_error( "unable to read '" + val + "'" );
+  }
+  // ignore created lemma total, as it contains many duplicates
+  // note: this assumes the frequency lists have the same actual total
+  // i.e.: they are derived from the same corpora
+  lemma_total = word_total;
+  val = cf.lookUp( "top_freq_lex" );
+  if ( !val.empty() ) {
+    if ( !fill_topvals( top_freq_lex, cf.configDir() + "/" + val ) )
+      throw runtime_error( "unable to read '" + val + "'" );
+  }
+  val = cf.lookUp( "temporals" );
+  if ( !val.empty() ) {
+    if ( !fill_connectors( temporals1, multi_temporals, cf.configDir() + "/" + val ) )
+      throw runtime_error( "unable to read '" + val + "'" );
+  }
+  val = cf.lookUp( "opsom_connectors_wg" );
+  if ( !val.empty() ) {
+    if ( !fill_connectors( opsommers_wg, multi_opsommers_wg, cf.configDir() + "/" + val ) )
+      throw runtime_error( "unable to read '" + val + "'" );
+  }
+  val = cf.lookUp( "opsom_connectors_zin" );
+  if ( !val.empty() ) {
+    if ( !fill_connectors( opsommers_zin, multi_opsommers_zin, cf.configDir() + "/" + val ) )
+      throw runtime_error( "unable to read '" + val + "'" );
+  }
+  val = cf.lookUp( "contrast" );
+  if ( !val.empty() ) {
+    if ( !fill_connectors( contrast1, multi_contrast, cf.configDir() + "/" + val ) )
+      throw runtime_error( "unable to read '" + val + "'" );
+  }
+  val = cf.lookUp( "compars" );
+  if ( !val.empty() ) {
+    if ( !fill_connectors( compars1, multi_compars, cf.configDir() + "/" + val ) )
+      throw runtime_error( "unable to read '" + val + "'" );
+  }
+  val = cf.lookUp( "causals" );
+  if ( !val.empty() ) {
+    if ( !fill_connectors( causals1, multi_causals, cf.configDir() + "/" + val ) )
+      throw runtime_error( "unable to read '" + val + "'" );
+  }
+  val = cf.lookUp( "causal_situation" );
+  if ( !val.empty() ) {
+    if ( !fill_connectors( causal_sits, multi_causal_sits, cf.configDir() + "/" + val ) )
+      throw runtime_error( "unable to read '" + val + "'" );
+  }
+  val = cf.lookUp( "space_situation" );
+  if ( !val.empty() ) {
+    if ( !fill_connectors( space_sits, multi_space_sits, cf.configDir() + "/" + val ) )
+      throw runtime_error( "unable to read '" + val + "'" );
+  }
+  val = cf.lookUp( "time_situation" );
+  if ( !val.empty() ) {
+    if ( !fill_connectors( time_sits, multi_time_sits, cf.configDir() + "/" + val ) )
+      throw runtime_error( "unable to read '" + val + "'" );
+  }
+
+  val = cf.lookUp( "emotion_situation" );
+  if ( !val.empty() ) {
+    if ( !fill_connectors( emotion_sits, multi_emotion_sits, cf.configDir() + "/" + val ) )
+      throw runtime_error( "unable to read '" + val + "'" );
+  }
+
+  val = cf.lookUp( "voorzetselexpr" );
+  if ( !val.empty() ) {
+    if ( !fill_vzexpr( vzexpr2, vzexpr3, vzexpr4, cf.configDir() + "/" + val ) )
+      throw runtime_error( "unable to read '" + val + "'" );
+  }
+  val = cf.lookUp( "afkortingen" );
+  if ( !val.empty() ) {
+    if ( !fill( afkos, cf.configDir() + "/" + val ) )
+      throw runtime_error( "unable to read '" + val + "'" );
+  }
+  val = cf.lookUp( "prevalence" );
+  if ( !val.empty() ) {
+    if ( !fill_prevalences( prevalences, cf.configDir() + "/" + val ) )
+      throw runtime_error( "unable to read '" + val + "'" );
+  }
+  val = cf.lookUp( "formal" );
+  if ( !val.empty() ) {
+    if ( !fill_formal( formal, cf.configDir() + "/" + val ) )
+      throw runtime_error( "unable to read '" + val + "'" );
+  }
+
+  val = cf.lookUp( "stop_lemmata" );
+  if ( !val.empty() ) {
+    if ( !fill_stop_lemmata( stop_lemmata, val ) )
+      throw runtime_error( "unable to read '" + val + "'" );
+  }
+
+  val = cf.lookUp( "my_classification" );
+  if ( !val.empty() ) {
+    if ( !fill( my_classification, val ) ) // full path necessary to allow custom input
+      throw runtime_error( "unable to read '" + val + "'" );
+  }
+}
+
+/// @brief Checks if a lemma is listed for a tag, without inserting
+/// anything in the (shared) lexicon
+/// @param m the lexicon, a set of lemmas per tag
+/// @param tag the tag
+/// @param lemma the lemma
+/// @return true when found
+bool inTagged( const map<CGN::Type, set<string>> &m,
+               CGN::Type tag,
+               const string &lemma ) {
+  auto it = m.find( tag );
+  return it != m.end() && it->second.find( lemma ) != it->second.end();
+}
+
+Conn::Type wordStats::checkConnective() const {
+  if ( tag != CGN::VG && tag != CGN::VZ && tag != CGN::BW )
+    return Conn::NOCONN;
+
+  if ( inTagged( settings.temporals1, tag, lemma ) )
+    return Conn::TEMPOREEL;
+  else if ( inTagged( settings.temporals1, CGN::UNASS, lemma ) )
+    return Conn::TEMPOREEL;
+
+  else if ( inTagged( settings.opsommers_wg, tag, lemma ) )
+    return Conn::OPSOMMEND_WG;
+  else if ( inTagged( settings.opsommers_wg, CGN::UNASS, lemma ) )
+    return Conn::OPSOMMEND_WG;
+
+  else if ( inTagged( settings.opsommers_zin, tag, lemma ) )
+    return Conn::OPSOMMEND_ZIN;
+  else if ( inTagged( settings.opsommers_zin, CGN::UNASS, lemma ) )
+    return Conn::OPSOMMEND_ZIN;
+
+  else if ( inTagged( settings.contrast1, tag, lemma ) )
+    return Conn::CONTRASTIEF;
+  else if ( inTagged( settings.contrast1, CGN::UNASS, lemma ) )
+    return Conn::CONTRASTIEF;
+
+  else if ( inTagged( settings.compars1, tag, lemma ) )
+    return Conn::COMPARATIEF;
+  else if ( inTagged( settings.compars1, CGN::UNASS, lemma ) )
+    return Conn::COMPARATIEF;
+
+  else if ( inTagged( settings.causals1, tag, lemma ) )
+    return Conn::CAUSAAL;
+  else if ( inTagged( settings.causals1, CGN::UNASS, lemma ) )
+    return Conn::CAUSAAL;
+
+  return Conn::NOCONN;
+}
+
+Situation::Type wordStats::checkSituation() const {
+  if ( inTagged( settings.time_sits, tag, lemma ) ) {
+    return Situation::TIME_SIT;
+  }
+  else if ( inTagged( settings.time_sits, CGN::UNASS, lemma ) ) {
+    return Situation::TIME_SIT;
+  }
+  else if ( inTagged( settings.causal_sits, tag, lemma ) ) {
+    return Situation::CAUSAL_SIT;
+  }
+  else if ( inTagged( settings.causal_sits, CGN::UNASS, lemma ) ) {
+    return Situation::CAUSAL_SIT;
+  }
+  else if ( inTagged( settings.space_sits, tag, lemma ) ) {
+    return Situation::SPACE_SIT;
+  }
+  else if ( inTagged( settings.space_sits, CGN::UNASS, lemma ) ) {
+    return Situation::SPACE_SIT;
+  }
+  else if ( inTagged( settings.emotion_sits, tag, lemma ) ) {
+    return Situation::EMO_SIT;
+  }
+  else if ( inTagged( settings.emotion_sits, CGN::UNASS, lemma ) ) {
+    return Situation::EMO_SIT;
+  }
+  return Situation::NO_SIT;
+}
+
+noun splitCompound( const string &word ) {
+  Profile::timer timer( Profile::COMPOUND_SPLITTER );
+  noun n;
+  // open connection
+  string host = config.lookUp( "host", "compound_splitter" );
+  string port = config.lookUp( "port", "compound_splitter" );
+  string method = config.lookUp( "method", "compound_splitter" );
+  Sockets::ClientSocket client;
+  if ( !client.connect( host, port ) ) {
+    TLOG( WARNING ) << "failed to open compound splitter connection: " << host << ":" << port;
+    TLOG( WARNING ) << "Reason: " << client.getMessage();
+  }
+  else {
+    TLOG( TRACE ) << "calling compound splitter for " << word;
+    client.write( word + "," + method );
+    string result;
+    client.read( result );
+    TLOG( TRACE ) << " -> " << result;
+
+    // store result in noun struct
+    vector<string> parts;
+    int size = TiCC::split_at( result, parts, "," );
+    if ( size > 1 ) {
+      n.is_compound = true;
+      n.head = parts[size - 1];
+      n.compound_parts = size;
+
+      string sat = "";
+      for ( size_t i = 0; i != size - 1; ++i ) {
+        sat = sat + parts[i];
+      }
+
+      n.satellite_clean = sat;
+    }
+    else {
+      n.is_compound = false;
+    }
+  }
+  return n;
+}
+
+// finds the probable word form of the head of a compounded lemma
+string formForHead( const string &complete_word, const string &head_lemma ) {
+  int match_start = 0;
+  int match_length = 0;
+
+  for ( int i = 0; i <= complete_word.size(); i++ ) {
+    int candidate_start = i;
+    int candidate_length = 0;
+    for ( int j = 0; j < head_lemma.size() && i + j < complete_word.size(); j++ ) {
+      if ( complete_word[i + j] == head_lemma[j] ) {
+        candidate_length++;
+      }
+      else {
+        break;
+      }
+    }
+
+    // prefer match at the end of the word
+    if ( candidate_length >= match_length ) {
+      match_start = candidate_start;
+      match_length = candidate_length;
+    }
+  }
+
+  // this found the largest match, e.g. for:
+  // complete word: waterschapsraden
+  // head lemma: raad
+  // match:
+  // ___________ra
+  // use start of match in the complete form to get the word form:
+  // ___________raden
+
+  string word = complete_word.substr( match_start );
+
+  TLOG( TRACE ) << " word form: (" << complete_word.substr( 0, match_start ) << ")" << word << ", head lemma: " << head_lemma;
+
+  return word;
+}
+
+string lemmatize( const string &word ) {
+  Profile::timer timer( Profile::LEMMATIZE );
+  string host = config.lookUp( "host", "frog" );
+  string port = config.lookUp( "port", "frog" );
+  Sockets::ClientSocket client;
+  if ( !client.connect( host, port ) ) {
+    TLOG( ERROR ) << "failed to open Frog connection: " << host << ":" << port;
+    TLOG( ERROR ) << "Reason: " << client.getMessage();
+    return 0;
+  }
+
+  client.write( word + "\nEOT\n" );
+  string result;
+  string s;
+  while ( client.read( s ) ) {
+    if ( s == "READY" )
+      break;
+    result += s + "\n";
+  }
+
+  if ( !result.empty() && result.size() > min_file_length ) {
+    folia::Document *doc;
+    doc = new folia::Document();
+    try {
+      doc->readFromString( result );
+      return doc->words()[0]->lemma();
+    }
+    catch ( std::exception &e ) {
+      TLOG( ERROR ) << "Frog parsing failed:\n" << e.what();
+    }
+  } else {
+    TLOG( WARNING ) << "Empty result from frog for " << word;
+  }
+
+  // failed
+  return word;
+}
+
+void wordStats::checkNoun() {
+  if ( tag == CGN::N ) {
+    // cerr << "lookup " << lemma << endl;
+    // semantic type is determined by lemma
+    // frequency however, is determined by the actual word form
+    map<string, noun>::const_iterator sit = findInflected( settings.noun_sem, lemma );
+    if ( sit != settings.noun_sem.end() ) {
+      noun n = sit->second;
+      sem_type = n.type;
+      if ( n.is_compound ) {
+        is_compound = n.is_compound;
+        compound_parts = n.compound_parts;
+        // word form is needed here for the frequency lookup
+        compound_head = formForHead( word, n.head );
+        compound_sat = n.satellite_clean;
+      }
+    }
+    else {
+      // call compound splitter
+      bool found_split = false;
+      if ( config.lookUp( "useCompoundSplitter" ) == "1"
+           && settings.groups.needs( Groups::COMPOUND_SPLITTER ) ) {
+        // lemmatization is already done by Frog
+        noun n = splitCompound( lemma );
+        if ( n.is_compound ) {
+          is_compound = n.is_compound;
+          compound_parts = n.compound_parts;
+          // word form is needed here for the frequency lookup
+          compound_head = formForHead( word, n.head );
+          compound_sat = n.satellite_clean;
+
+          // look for head in data
+          sit = findInflected( settings.noun_sem, n.head );
+
+          // retry lemmatization just this head
+          if ( sit == settings.noun_sem.end() ) {
+            string head_lemma = lemmatize( n.head );
+            TLOG( TRACE ) << " re-lemmatize head using Frog: " << n.head
+                          << " -> " << head_lemma;
+            sit = findInflected( settings.noun_sem, head_lemma );
+          }
+
+          if ( sit != settings.noun_sem.end() ) {
+            // if there is a match, fill in results
+            found_split = true;
+            noun match = sit->second;
+            sem_type = match.type;
+          }
+        }
+      }
+      if ( found_split == false ) {
+        // If we still haven't found a SEM::Type, add this to the problem file
+        // cerr << "unknown noun " << word << endl;
+        sem_type = SEM::UNFOUND_NOUN;
+        if ( settings.showProblems ) {
+          Log::problem( "N," + word + ", " + lemma );
+        }
+      }
+    }
+  }
+}
+
+SEM::Type wordStats::checkSemProps() const {
+  if ( prop == CGN::ISNAME ) {
+    // Names are te be looked up in the Noun list too, but use the word instead of the lemma (case-sensitivity)
+    SEM::Type sem = SEM::UNFOUND_NOUN;
+    map<string, noun>::const_iterator sit = settings.noun_sem.find( word );
+    if ( sit != settings.noun_sem.end() ) {
+      sem = sit->second.type;
+    }
+    return sem;
+  }
+  else if ( tag == CGN::ADJ ) {
+    //    cerr << "ADJ check semtype " << l_lemma << endl;
+    SEM::Type sem = SEM::UNFOUND_ADJ;
+    map<string, SEM::Type>::const_iterator sit = findInflected( settings.adj_sem, l_lemma );
+    if ( sit == settings.adj_sem.end() ) {
+      // lemma not found. maybe the whole word?
+      //      cerr << "ADJ check semtype " << word << endl;
+      sit = findInflected( settings.adj_sem, l_word );
+    }
+    if ( sit != settings.adj_sem.end() ) {
+      sem = sit->second;
+    }
+    else if ( settings.showProblems ) {
+      Log::problem( "ADJ," + l_word + "," + l_lemma );
+    }
+    //    cerr << "found semtype " << sem << endl;
+    return sem;
+  }
+  else if ( tag == CGN::WW ) {
+    //    cerr << "check semtype " << lemma << endl;
+    SEM::Type sem = SEM::UNFOUND_VERB;
+    map<string, SEM::Type>::const_iterator sit = settings.verb_sem.end();
+    if ( !full_lemma.empty() ) {
+      sit = settings.verb_sem.find( full_lemma );
+    }
+    if ( sit == settings.verb_sem.end() ) {
+      if ( position == CGN::PRENOM
+           && ( prop == CGN::ISVD || prop == CGN::ISOD ) ) {
+        // might be a 'hidden' adj!
+        //	cerr << "lookup a probable ADJ " << prop << " (" << word << ") " << endl;
+        map<string, SEM::Type>::const_iterator adj_sit;
+        adj_sit = settings.adj_sem.find( l_word );
+        if ( adj_sit == settings.adj_sem.end() )
+          sit = settings.verb_sem.end();
+        else
+          sit = adj_sit;
+      }
+    }
+    if ( sit == settings.verb_sem.end() ) {
+      //      cerr << "lookup lemma as verb (" << lemma << ") " << endl;
+      sit = settings.verb_sem.find( l_lemma );
+    }
+    if ( sit != settings.verb_sem.end() ) {
+      sem = sit->second;
+    }
+    else if ( settings.showProblems ) {
+      if ( !full_lemma.empty() )
+        Log::problem( "WW," + l_word + "," + l_lemma + "," + full_lemma );
+      else
+        Log::problem( "WW," + l_word + "," + l_lemma );
+    }
+    //    cerr << "found semtype " << sem << endl;
+    return sem;
+  }
+  return SEM::NO_SEMTYPE;
+}
+
+// Looks up the Intensity type for a word, or NO_INTENSIFY if not found
+Intensify::Type wordStats::checkIntensify( const xmlNode *alpWord ) const {
+  Intensify::Type res = Intensify::NO_INTENSIFY;
+
+  // First check the full lemma (if available), then the normal lemma
+  map<string, Intensify::Type>::const_iterator sit = settings.intensify.end();
+  if ( !full_lemma.empty() ) {
+    sit = settings.intensify.find( full_lemma );
+  }
+  if ( sit == settings.intensify.end() ) {
+    sit = settings.intensify.find( lemma );
+  }
+
+  if ( sit != settings.intensify.end() ) {
+    res = sit->second;
+
+    // Special case for BVBW: check if this is not a modifier
+    if ( res == Intensify::BVBW ) {
+      if ( !checkModifier( alpWord ) ) res = Intensify::NO_INTENSIFY;
+    }
+  }
+  return res;
+}
+
+// Looks up the Formal type for a word, or NOT_FORMAL if not found
+Formal::Type wordStats::checkFormal() const {
+  Formal::Type res = Formal::NOT_FORMAL;
+
+  // First check the full lemma (if available), then the normal lemma
+  map<string, Formal::Type>::const_iterator sit = settings.formal.end();
+  if ( !full_lemma.empty() ) {
+    sit = findInflected( settings.formal, full_lemma );
+  }
+  if ( sit == settings.formal.end() ) {
+    sit = findInflected( settings.formal, lemma );
+  }
+
+  if ( sit != settings.formal.end() ) {
+    res = sit->second;
+  }
+  return res;
+}
+
+// Looks up the General type for a noun (based on lemma), or NO_GENERAL if not found
+General::Type wordStats::checkGeneralNoun() const {
+  if ( tag == CGN::N ) {
+    map<string, General::Type>::const_iterator sit = settings.general_nouns.find( lemma );
+    if ( sit != settings.general_nouns.end() ) {
+      return sit->second;
+    }
+  }
+  return General::NO_GENERAL;
+}
+
+// Looks up the General type for a verb (based on (full) lemma), or NO_GENERAL if not found
+General::Type wordStats::checkGeneralVerb() const {
+  if ( tag == CGN::WW ) {
+    // First check the full lemma (if available), then the normal lemma
+    map<string, General::Type>::const_iterator sit = settings.general_verbs.end();
+    if ( !full_lemma.empty() ) {
+      sit = settings.general_verbs.find( full_lemma );
+    }
+    if ( sit == settings.general_verbs.end() ) {
+      sit = settings.general_verbs.find( lemma );
+    }
+
+    if ( sit != settings.general_verbs.end() ) {
+      return sit->second;
+    }
+  }
+  return General::NO_GENERAL;
+}
+
+Adverb::Type checkAdverbType( const string &word, CGN::Type tag ) {
+  if ( tag == CGN::BW ) {
+    map<string, Adverb::adverb>::const_iterator sit = settings.adverbs.find( word );
+    if ( sit != settings.adverbs.end() ) {
+      return sit->second.type;
+    }
+  }
+  return Adverb::NO_ADVERB;
+}
+
+Adverb::SubType checkAdverbSubType( const string &word, CGN::Type tag ) {
+  if ( tag == CGN::BW ) {
+    map<string, Adverb::adverb>::const_iterator sit = settings.adverbs.find( word );
+    if ( sit != settings.adverbs.end() ) {
+      return sit->second.subtype;
+    }
+  }
+  return Adverb::NO_ADVERB_SUBTYPE;
+}
+
+Afk::Type wordStats::checkAfk() const {
+  if ( tag == CGN::N || tag == CGN::SPEC ) {
+    map<string, Afk::Type>::const_iterator sit = settings.afkos.find( word );
+    if ( sit != settings.afkos.end() ) {
+      return sit->second;
+    }
+  }
+  return Afk::NO_A;
+}
+
+// Returns the self-defined classification for a lemma (if its tag is correct)
+string wordStats::checkMyClassification() const {
+  string result;
+  map<string, tagged_classification>::const_iterator sit = settings.my_classification.find( lemma );
+  if ( sit != settings.my_classification.end() ) {
+    tagged_classification tc = sit->second;
+    if ( tc.tag == CGN::UNASS || tc.tag == tag ) {
+      result = tc.classification;
+    }
+  }
+  return result;
+}
+
+// Returns whether the lemma appears on the stoplist
+bool wordStats::checkStoplist() const {
+  bool result = false;
+
+  if ( inTagged( settings.stop_lemmata, tag, lemma ) ) {
+    result = true;
+  }
+  else if ( inTagged( settings.stop_lemmata, CGN::UNASS, lemma ) ) {
+    result = true;
+  }
+  return result;
+}
+
+// Returns the position of a word in the top-20000 lexicon
+top_val wordStats::topFreqLookup( const string &w ) const {
+  map<string, top_val>::const_iterator it = settings.top_freq_lex.find( w );
+  top_val result = notFound;
+  if ( it != settings.top_freq_lex.end() ) {
+    result = it->second;
+  }
+  return result;
+}
+
+// Returns the frequency of a word in the word lexicon
+int wordStats::wordFreqLookup( const string &w ) const {
+  int result = 0;
+  map<string, cf_data>::const_iterator it = settings.word_freq_lex.find( w );
+  if ( it != settings.word_freq_lex.end() ) {
+    result = it->second.count;
+  }
+  return result;
+}
+
+// Returns the log of the frequency per billion words (with Laplace transformation)
+// See http://crr.ugent.be/papers/van_Heuven_et_al_SUBTLEX-UK.pdf
+double freqLog( const long int &freq, const long int &total ) {
+  return log10( ( ( freq + 1 ) / double( total ) ) * 1e9 );
+}
+
+// Find the frequencies of words and lemmata
+void wordStats::freqLookup() {
+  word_freq = wordFreqLookup( l_word );
+  word_freq_log = freqLog( word_freq, settings.word_total );
+
+  map<string, cf_data>::const_iterator it = settings.lemma_freq_lex.end();
+  if ( !full_lemma.empty() ) {
+    // scheidbaar ww
+    it = settings.lemma_freq_lex.find( full_lemma );
+  }
+  if ( it == settings.lemma_freq_lex.end() ) {
+    it = settings.lemma_freq_lex.find( l_lemma );
+  }
+  if ( it != settings.lemma_freq_lex.end() ) {
+    lemma_freq = it->second.count;
+    lemma_freq_log = freqLog( lemma_freq, settings.lemma_total );
+  }
+  else {
+    lemma_freq = 0;
+    lemma_freq_log = freqLog( lemma_freq, settings.lemma_total );
+  }
+}
+
+void wordStats::prevalenceLookup() {
+  map<string, prevalence>::const_iterator it = settings.prevalences.find( l_lemma );
+  if ( it != settings.prevalences.end() ) {
+    prevalenceP = it->second.percentage;
+    prevalenceZ = it->second.zscore;
+  }
+}
+
+void wordStats::staphFreqLookup() {
+  map<string, cf_data>::const_iterator it = settings.staph_word_freq_lex.find( l_word );
+  if ( it != settings.staph_word_freq_lex.end() ) {
+    double freq = it->second.freq;
+    if ( freq <= 50 )
+      f50 = true;
+    if ( freq <= 65 )
+      f65 = true;
+    if ( freq <= 77 )
+      f77 = true;
+    if ( freq <= 80 )
+      f80 = true;
+  }
+}
+
+wordStats::wordStats( int index,
+                      const tokenTable &tokens,
+                      const xmlNode *alpWord,
+                      bool fail ) :
+    basicStats( index, tokens[index].word, "word" ),
+    parseFail( fail ), tag( CGN::UNASS ), wwform( ::NO_VERB ),
+    isPersRef( false ), isPronRef( false ),
+    archaic( false ), isContent( false ), isContentStrict( false ),
+    isNominal( false ), isOnder( false ), isImperative( false ),
+    isBetr( false ), isPropNeg( false ), isMorphNeg( false ),
+    nerProp( NER::NONER ), connType( Conn::NOCONN ), isMultiConn( false ), sitType( Situation::NO_SIT ),
+    prevalenceP( NAN ), prevalenceZ( NAN ),
+    f50( false ), f65( false ), f77( false ), f80( false ),
+    top_freq( notFound ), word_freq( 0 ), lemma_freq( 0 ),
+    wordOverlapCnt( 0 ), lemmaOverlapCnt( 0 ),
+    word_freq_log( NAN ), lemma_freq_log( NAN ),
+    logprob10_fwd( NAN ), logprob10_bwd( NAN ),
+    prop( CGN::JUSTAWORD ), position( CGN::NOPOS ),
+    sem_type( SEM::NO_SEMTYPE ), intensify_type( Intensify::NO_INTENSIFY ),
+    formal_type( Formal::NOT_FORMAL ),
+    general_noun_type( General::NO_GENERAL ), general_verb_type( General::NO_GENERAL ),
+    adverb_type( Adverb::NO_ADVERB ), adverb_sub_type( Adverb::NO_ADVERB_SUBTYPE ),
+    afkType( Afk::NO_A ), is_compound( false ), compound_parts( 0 ),
+    word_freq_log_head( NAN ), word_freq_log_sat( NAN ), word_freq_log_head_sat( NAN ), word_freq_log_corr( NAN ), on_stoplist( false ) {
+  const tokenInfo &token = tokens[index];
+  folia::Word *w = token.word;
+  charCnt = token.charCnt;
+  word = Intern::toString( token.word_id );
+  l_word = Intern::toString( token.l_word_id );
+  l_word_id = token.l_word_id;
+  lemma_id = Intern::EMPTY;
+  l_lemma_id = Intern::EMPTY;
+  if ( fail )
+    return;
+  if ( !token.pa )
+    throw folia::ValueError( "word doesn't have Frog POS tag info" );
+  pos = token.pa->cls();
+  tag = token.head;
+  lemma_id = token.lemma_id;
+  l_lemma_id = token.l_lemma_id;
+  lemma = Intern::toString( lemma_id );
+  l_lemma = Intern::toString( l_lemma_id );
+
+  setCGNProps( token );
+  if ( alpWord ) {
+    distances = getDependencyDist( alpWord, tokens.punctuation() );
+    if ( tag == CGN::WW ) {
+      string full;
+      wwform = classifyVerb( alpWord, lemma, full );
+      if ( !full.empty() ) {
+        TiCC::to_lower( full );
+        //	cerr << "scheidbaar WW: " << full << endl;
+        full_lemma = full;
+      }
+      if ( ( prop == CGN::ISPVTGW || prop == CGN::ISPVVERL ) && wwform != PASSIVE_VERB ) {
+        isImperative = checkImp( alpWord );
+      }
+    }
+  }
+  if ( prop != CGN::ISLET ) {
+    vector<string> mv = get_full_morph_analysis( w, true );
+    // get_full_morph_amalysis returns 1 or more morpheme sequences
+    // like [appel][taart] of [veilig][heid]
+    // there may be more readings/morpheme lists:
+    // [ge][naken][t] versus [genaak][t]
+    size_t max = 0;
+    size_t pos = 0;
+    size_t match_pos = 0;
+    for ( const auto s : mv ) {
+      vector<string> parts;
+      TiCC::split_at_first_of( s, parts, "[]" );
+      if ( parts.size() > max ) {
+        // a hack: we assume the longest morpheme list to
+        // be the best choice.
+        morphemes = parts;
+        max = parts.size();
+        match_pos = pos;
+      }
+      ++pos;
+    }
+    if ( morphemes.size() == 0 ) {
+      TLOG( WARNING ) << "unable to retrieve morphemes from folia.";
+    }
+    //    cerr << "Morphemes " << word << "= " << morphemes << endl;
+    vector<string> cmps = get_compound_analysis( w );
+    //    cerr << "Comps " << word << "= " << cmps << endl;
+    if ( cmps.size() > match_pos ) {
+      // this might not be the case e.g. when frog isn't started
+      // with the --deep-morph option!
+      compstr = cmps[match_pos];
+    }
+    isPropNeg = checkPropNeg();
+    isMorphNeg = checkMorphNeg();
+    connType = checkConnective();
+    sitType = checkSituation();
+    morphCnt = morphemes.size();
+    if ( prop != CGN::ISNAME ) {
+      charCntExNames = charCnt;
+      morphCntExNames = morphCnt;
+    }
+    if ( settings.groups.needs( Groups::SEM_TYPES ) )
+      sem_type = checkSemProps();
+    checkNoun();
+    if ( settings.groups.needs( Groups::INTENSIFIERS ) )
+      intensify_type = checkIntensify( alpWord );
+    if ( settings.groups.needs( Groups::FORMAL_WORDS ) )
+      formal_type = checkFormal();
+    if ( settings.groups.needs( Groups::GENERAL_WORDS ) ) {
+      general_noun_type = checkGeneralNoun();
+      general_verb_type = checkGeneralVerb();
+    }
+    adverb_type = checkAdverbType( l_word, tag );
+    adverb_sub_type = checkAdverbSubType( l_word, tag );
+    afkType = checkAfk();
+    if ( alpWord )
+      isNominal = checkNominal( alpWord );
+    top_freq = topFreqLookup( l_word );
+    prevalenceLookup();
+    staphFreqLookup();
+    isContent = checkContent( false );
+    isContentStrict = checkContent( true );
+    if ( isContent ) {
+      freqLookup();
+    }
+    if ( is_compound ) {
+      charCntHead = compound_head.length();
+      charCntSat = compound_sat.length();
+      word_freq_log_head = freqLog( wordFreqLookup( compound_head ), settings.word_total );
+      word_freq_log_sat = freqLog( wordFreqLookup( compound_sat ), settings.word_total );
+      word_freq_log_head_sat = ( word_freq_log_head + word_freq_log_sat ) / double( 2 );
+      top_freq_head = topFreqLookup( compound_head );
+      top_freq_sat = topFreqLookup( compound_sat );
+      word_freq_log_corr = word_freq_log_head;
+    }
+    else {
+      word_freq_log_corr = word_freq_log;
+    }
+    on_stoplist = checkStoplist();
+    my_classification = checkMyClassification();
+  }
+}
+
+void structStats::calculate_MTLDs() {
+  Profile::timer timer( Profile::MTLD );
+  // the scratch space is per thread, the threshold per Analyzer
+  static thread_local mtldEngine engine;
+  const double threshold = settings.mtld_threshold;
+  vector<Intern::Id> words_v;
+  vector<Intern::Id> lemmas;
+  vector<Intern::Id> conts;
+  vector<Intern::Id> conts_strict;
+  vector<Intern::Id> names;
+  vector<Intern::Id> temp_conn;
+  vector<Intern::Id> reeks_wg_conn;
+  vector<Intern::Id> reeks_zin_conn;
+  vector<Intern::Id> contr_conn;
+  vector<Intern::Id> comp_conn;
+  vector<Intern::Id> cause_conn;
+  vector<Intern::Id> tijd_sits;
+  vector<Intern::Id> ruimte_sits;
+  vector<Intern::Id> cause_sits;
+  vector<Intern::Id> emotion_sits;
+  words_v.reserve( words.size() );
+  lemmas.reserve( words.size() );
+  for ( const wordStats *w = words.begin(); w != words.end(); ++w ) {
+    if ( w->prop == CGN::ISLET ) {
+      continue;
+    }
+    words_v.push_back( w->l_word_id );
+    lemmas.push_back( w->l_lemma_id );
+    if ( w->isContent ) {
+      conts.push_back( w->l_word_id );
+    }
+    if ( w->isContentStrict ) {
+      conts_strict.push_back( w->l_word_id );
+    }
+    if ( w->prop == CGN::ISNAME ) {
+      names.push_back( w->l_word_id );
+    }
+    switch ( w->connType ) {
+      case Conn::TEMPOREEL:
+        temp_conn.push_back( w->l_word_id );
+        break;
+      case Conn::OPSOMMEND_WG:
+        reeks_wg_conn.push_back( w->l_word_id );
+        break;
+      case Conn::OPSOMMEND_ZIN:
+        reeks_zin_conn.push_back( w->l_word_id );
+        break;
+      case Conn::CONTRASTIEF:
+        contr_conn.push_back( w->l_word_id );
+        break;
+      case Conn::COMPARATIEF:
+        comp_conn.push_back( w->l_word_id );
+        break;
+      case Conn::CAUSAAL:
+        cause_conn.push_back( w->l_word_id );
+        break;
+      default:
+        break;
+    }
+    switch ( w->sitType ) {
+      case Situation::TIME_SIT:
+        tijd_sits.push_back( w->lemma_id );
+        break;
+      case Situation::CAUSAL_SIT:
+        cause_sits.push_back( w->lemma_id );
+        break;
+      case Situation::SPACE_SIT:
+        ruimte_sits.push_back( w->lemma_id );
+        break;
+      case Situation::EMO_SIT:
+        emotion_sits.push_back( w->lemma_id );
+        break;
+      default:
+        break;
+    }
+  }
+
+  word_mtld = engine.average( words_v, threshold );
+  lemma_mtld = engine.average( lemmas, threshold );
+  content_mtld = engine.average( conts, threshold );
+  content_mtld_strict = engine.average( conts_strict, threshold );
+  name_mtld = engine.average( names, threshold );
+  temp_conn_mtld = engine.average( temp_conn, threshold );
+  reeks_wg_conn_mtld = engine.average( reeks_wg_conn, threshold );
+  reeks_zin_conn_mtld = engine.average( reeks_zin_conn, threshold );
+  contr_conn_mtld = engine.average( contr_conn, threshold );
+  comp_conn_mtld = engine.average( comp_conn, threshold );
+  cause_conn_mtld = engine.average( cause_conn, threshold );
+  tijd_sit_mtld = engine.average( tijd_sits, threshold );
+  ruimte_sit_mtld = engine.average( ruimte_sits, threshold );
+  cause_sit_mtld = engine.average( cause_sits, threshold );
+  emotion_sit_mtld = engine.average( emotion_sits, threshold );
+
+  // Combined connective MLTD (but don't include reeks_wg_conn)
+  // The parts are taken in reverse order, as the results have always been
+  // computed on the buckets after they were reversed for the backward pass
+  vector<Intern::Id> all_conn;
+  all_conn.insert( all_conn.end(), temp_conn.rbegin(), temp_conn.rend() );
+  all_conn.insert( all_conn.end(), reeks_zin_conn.rbegin(), reeks_zin_conn.rend() );
+  all_conn.insert( all_conn.end(), contr_conn.rbegin(), contr_conn.rend() );
+  all_conn.insert( all_conn.end(), comp_conn.rbegin(), comp_conn.rend() );
+  all_conn.insert( all_conn.end(), cause_conn.rbegin(), cause_conn.rend() );
+  all_conn_mtld = engine.average( all_conn, threshold );
+}
+
+namespace {
+
+/// @brief Keeps the first exception thrown in the sections of an OpenMP
+/// parallel region, which must not leave them, to rethrow it after the
+/// region.
+class sectionErrors {
+public:
+  void keep() {
+    lock_guard<mutex> guard( lock );
+    if ( !first ) {
+      first = current_exception();
+    }
+  }
+  void rethrow() {
+    if ( first ) {
+      rethrow_exception( first );
+    }
+  }
+
+private:
+  mutex lock;
+  exception_ptr first;
+};
+
+} // namespace
+
+//#define DEBUG_WOPR
+/// @brief sends text to the Wopr server for the given direction
+/// @param type "fwd" or "bwd"
+/// @param txt the tokenized sentences, one per line
+/// @return the FoLiA reply, or an empty string when it is not usable
+string requestWopr( const string &type, const string &txt ) {
+  string host = config.lookUp( "host_" + type, "wopr" );
+  string port = config.lookUp( "port_" + type, "wopr" );
+  Sockets::ClientSocket client;
+  if ( !client.connect( host, port ) ) {
+    throw runtime_error( "failed to open Wopr connection: " + host + ":" + port
+                         + ", reason: " + client.getMessage() );
+  }
+  TLOG( DEBUG ) << "calling Wopr";
+  client.write( txt + "\n\n" );
+  string result;
+  string s;
+  while ( client.read( s ) ) {
+    result += s + "\n";
+  }
+#ifdef DEBUG_WOPR
+  cerr << "received data [" << result << "]" << endl;
+#endif
+  if ( result.empty() || result.size() <= min_file_length ) {
+    TLOG( WARNING ) << "No usable FoLia data retrieved from Wopr. Got '"
+                    << result << "'";
+    return "";
+  }
+  return result;
+}
+
+/// @brief reads the Wopr metrics of one sentence of a Wopr reply
+/// @param s the sentence in the reply
+/// @param scores receives the metrics. Its wordProbs must already have
+/// the size of the input sentence.
+/// @return false when the number of words doesn't match the input
+bool readWoprScores( const folia::Sentence *s, woprScores &scores ) {
+  vector<folia::Word *> wv = s->words();
+  if ( wv.size() != scores.wordProbs.size() ) {
+    TLOG( WARNING ) << "unforseen mismatch between de number of words returned by WOPR\n"
+                    << " and the number of words in the input sentence. ";
+    return false;
+  }
+  for ( size_t i = 0; i < wv.size(); ++i ) {
+    vector<folia::Metric *> mv = wv[i]->select<folia::Metric>();
+    for ( size_t j = 0; j < mv.size(); ++j ) {
+      if ( mv[j]->cls() == "lprob10" ) {
+        scores.wordProbs[i] = TiCC::stringTo<double>( mv[j]->feat( "value" ) );
+      }
+    }
+  }
+  vector<folia::Metric *> mv = s->select<folia::Metric>();
+  for ( size_t j = 0; j < mv.size(); ++j ) {
+    if ( mv[j]->cls() == "avg_prob10" ) {
+      string val = mv[j]->feat( "value" );
+      if ( val != "nan" ) {
+        scores.sentProb = TiCC::stringTo<double>( val );
+      }
+    }
+    else if ( mv[j]->cls() == "entropy" ) {
+      string val = mv[j]->feat( "value" );
+      if ( val != "nan" ) {
+        scores.entropy = TiCC::stringTo<double>( val );
+      }
+    }
+    else if ( mv[j]->cls() == "perplexity" ) {
+      string val = mv[j]->feat( "value" );
+      if ( val != "nan" ) {
+        scores.perplexity = TiCC::stringTo<double>( val );
+      }
+    }
+  }
+  return true;
+}
+
+/// @brief orders the Wopr metrics of a list of sentences in one request
+/// @param type "fwd" or "bwd"
+/// @param texts the tokenized sentences
+/// @param scores one woprScores per sentence, sized to its word count
+/// @param usable set per sentence to whether its words matched the reply
+/// @return false when the reply didn't hold one sentence per input
+bool orderWopr( const string &type, const vector<string> &texts,
+                vector<woprScores> &scores, vector<bool> &usable ) {
+  usable.assign( texts.size(), false );
+  string txt;
+  for ( size_t i = 0; i < texts.size(); ++i ) {
+    txt += texts[i];
+    if ( i + 1 < texts.size() ) {
+      txt += "\n";
+    }
+  }
+  string result = requestWopr( type, txt );
+  if ( result.empty() ) {
+    return false;
+  }
+  bool ok = false;
+#ifdef DEBUG_WOPR
+  cerr << "start FoLiA parsing" << endl;
+#endif
+  folia::Document doc;
+  try {
+    doc.readFromString( result );
+#ifdef DEBUG_WOPR
+    cerr << "finished parsing" << endl;
+#endif
+    vector<folia::Sentence *> sv = doc.sentences();
+    if ( sv.size() == texts.size() ) {
+      for ( size_t i = 0; i < sv.size(); ++i ) {
+        usable[i] = readWoprScores( sv[i], scores[i] );
+      }
+      ok = true;
+    }
+    else if ( texts.size() == 1 ) {
+      throw logic_error( "The document returned by WOPR contains > 1 Sentence" );
+    }
+    else {
+      TLOG( WARNING ) << "WOPR returned " << sv.size() << " sentences for a batch of "
+                      << texts.size();
+    }
+  }
+  catch ( std::exception &e ) {
+    TLOG( ERROR ) << "FoLiaParsing failed:\n" << e.what();
+  }
+  TLOG( DEBUG ) << "done with Wopr";
+  return ok;
+}
+
+/// @brief fills the Wopr metrics of a sentence from an in-process model
+/// @param lm the forward or backward model
+/// @param txt the tokenized sentence
+/// @param scores receives the metrics, as Wopr would compute them
+void scoreNgram( const NGram::model &lm, const string &txt, woprScores &scores ) {
+  vector<string> words;
+  TiCC::split( txt, words );
+  if ( words.size() != scores.wordProbs.size() ) {
+    TLOG( WARNING ) << "unforseen mismatch between de number of words scored by the language model\n"
+                    << " and the number of words in the input sentence. ";
+    return;
+  }
+  if ( words.empty() ) {
+    return;
+  }
+  lm.score( words, scores.wordProbs );
+  NGram::summarize( scores.wordProbs, scores.sentProb, scores.entropy,
+                    scores.perplexity );
+}
+
+void orderWopr( const string &type, const string &txt, woprScores &scores ) {
+  vector<woprScores> v( 1, scores );
+  vector<bool> usable;
+  orderWopr( type, vector<string>( 1, txt ), v, usable );
+  scores = v[0];
+}
+
+/**
+ * Orders the Wopr metrics of the sentences, in both directions at once.
+ * @param sents the sentences to send, in text order
+ */
+void woprBatch::order( const vector<folia::Sentence *> &sents ) {
+  if ( sents.empty() ) {
+    return;
+  }
+  vector<string> texts( sents.size() );
+  vector<woprScores> fwd_scores;
+  for ( size_t i = 0; i < sents.size(); ++i ) {
+    texts[i] = TiCC::UnicodeToUTF8( sents[i]->toktext() );
+    fwd_scores.push_back( woprScores( sents[i]->words().size() ) );
+  }
+  vector<woprScores> bwd_scores = fwd_scores;
+  vector<bool> fwd_usable;
+  vector<bool> bwd_usable;
+  bool fwd_ok = false;
+  bool bwd_ok = false;
+  Profile::report *prof = Profile::current();
+  sectionErrors errors;
+#pragma omp parallel sections
+  {
+#pragma omp section
+    {
+      Profile::scope scope( prof );
+      try {
+        Profile::timer timer( Profile::WOPR_FWD );
+        fwd_ok = orderWopr( "fwd", texts, fwd_scores, fwd_usable );
+      }
+      catch ( ... ) {
+        errors.keep();
+      }
+    }
+#pragma omp section
+    {
+      Profile::scope scope( prof );
+      try {
+        Profile::timer timer( Profile::WOPR_BWD );
+        bwd_ok = orderWopr( "bwd", texts, bwd_scores, bwd_usable );
+      }
+      catch ( ... ) {
+        errors.keep();
+      }
+    }
+  }
+  errors.rethrow();
+  // a sentence of which the words didn't match is left out, so it is
+  // sent on its own, like all sentences of a reply that didn't match
+  for ( size_t i = 0; i < sents.size(); ++i ) {
+    if ( fwd_ok && fwd_usable[i] ) {
+      fwd[sents[i]] = fwd_scores[i];
+    }
+    if ( bwd_ok && bwd_usable[i] ) {
+      bwd[sents[i]] = bwd_scores[i];
+    }
+  }
+}
+
+/**
+ * Looks up the scores of a sentence.
+ * @return true when both directions were found
+ */
+bool woprBatch::find( const folia::Sentence *s, woprScores &fwd_scores, woprScores &bwd_scores ) const {
+  map<const folia::Sentence *, woprScores>::const_iterator f = fwd.find( s );
+  map<const folia::Sentence *, woprScores>::const_iterator b = bwd.find( s );
+  if ( f == fwd.end() || b == bwd.end() ) {
+    return false;
+  }
+  fwd_scores = f->second;
+  bwd_scores = b->second;
+  return true;
+}
+
+xmlDoc *AlpinoLookup( folia::Sentence * );
+void AlpinoLookupAdd( folia::Sentence *, const string & );
+xmlDoc *AlpinoServerParse( folia::Sentence * );
+
+/// @brief Returns the filename if this does not exist or otherwise it will suffix
+/// it with a number to make sure this file is unique
+/// @param filename filename to check
+/// @param extension extension which will be placed at the end of the filename, after the suffix
+/// @return a unique filename
+/// @brief Claims a file name that isn't in use yet: the file is created,
+/// empty, so another thread or process can't pick the same name.
+/// @param filename the base of the name
+/// @param extension the end of the name, after a ' (<n>)' when needed
+/// @return the name; when the file can't be created for another reason
+/// than that it exists, the name is returned anyway, and writing to it
+/// reports the problem
+string unique_filename( const string &filename, const string &extension ) {
+  int suffix = 0;
+  string outName = filename + extension;
+  while ( true ) {
+    int fd = open( outName.c_str(), O_WRONLY | O_CREAT | O_EXCL, 0666 );
+    if ( fd >= 0 ) {
+      close( fd );
+      return outName;
+    }
+    if ( errno != EEXIST ) {
+      return outName;
+    }
+    suffix++;
+    outName = filename + " (" + to_string( suffix ) + ")" + extension;
+  }
+}
+
+void fill_word_lemma_buffers( const sentStats *ss,
+                              vector<string> &wv,
+                              vector<string> &lv ) {
+  auto bv = ss->sv;
+  for ( size_t i = 0; i < bv.size(); ++i ) {
+    wordStats *w = dynamic_cast<wordStats *>( bv[i] );
+    if ( w->isOverlapCandidate() ) {
+      wv.push_back( w->l_word );
+      lv.push_back( w->l_lemma );
+    }
+  }
+}
+
+void np_length( folia::Sentence *s, const tokenTable &tokens, int &npcount, int &indefcount, int &size ) {
+  vector<folia::Chunk *> cv = s->select<folia::Chunk>();
+  size = 0;
+  for ( size_t i = 0; i < cv.size(); ++i ) {
+    if ( cv[i]->cls() == "NP" ) {
+      ++npcount;
+      size += cv[i]->size();
+      folia::FoliaElement *det = cv[i]->index( 0 );
+      if ( det ) {
+        const tokenInfo *token = tokens.find( det );
+        if ( !token || !token->pa )
+          throw folia::ValueError( "word doesn't have Frog POS tag info" );
+        if ( token->head == CGN::LID ) {
+          if ( Intern::toString( token->word_id ) == "een" )
+            ++indefcount;
+        }
+      }
+    }
+  }
+}
+
+sentStats::sentStats( const string &inName, int index, folia::Sentence *s, const sentStats *pred, const woprBatch *wopr, statsArena &arena ) :
+    structStats( index, s, "sent" ) {
+  text = TiCC::UnicodeToUTF8( s->toktext() );
+  TLOG( DEBUG ) << "analyse tokenized sentence=" << text;
+  vector<folia::Word *> w = s->words();
+  woprScores wopr_fwd( w.size() );
+  woprScores wopr_bwd( w.size() );
+  bool woprDone = wopr && wopr->find( s, wopr_fwd, wopr_bwd );
+  if ( wopr ) {
+    Profile::count( woprDone ? Profile::WOPR_BATCH_HIT : Profile::WOPR_BATCH_MISS );
+  }
+  xmlDoc *alpDoc = 0;
+  // decoded here, as the Alpino section below reads it concurrently
+  tokenTable tokens( s );
+  parseFailCnt = -1; // not parsed (yet)
+  Profile::report *prof = Profile::current();
+  sectionErrors errors;
+#pragma omp parallel sections
+  {
+#pragma omp section
+    {
+      Profile::scope scope( prof );
+      try {
+        if ( settings.doAlpino || settings.doAlpinoLookup || settings.doAlpinoServer ) {
+          bool alreadyParsed = false;
+          alpDoc = AlpinoLookup( s );
+          if ( alpDoc ) {
+            alreadyParsed = true;
+            TLOG( DEBUG ) << "pre-parsed alpino found!";
+          }
+          else if ( settings.doAlpinoServer ) {
+            TLOG( DEBUG ) << "calling Alpino Server";
+            Profile::timer timer( Profile::ALPINO );
+            alpDoc = AlpinoServerParse( s );
+            if ( !alpDoc ) {
+              TLOG( WARNING ) << "alpino parser failed!";
+            }
+            TLOG( DEBUG ) << "done with Alpino Server";
+          }
+          else if ( settings.doAlpino ) {
+            TLOG( DEBUG ) << "calling Alpino parser";
+            Profile::timer timer( Profile::ALPINO );
+            // the local parser works in the shared working dir
+            static mutex localAlpinoLock;
+            lock_guard<mutex> guard( localAlpinoLock );
+            alpDoc = AlpinoParse( s, workdir_name );
+            if ( !alpDoc ) {
+              TLOG( WARNING ) << "alpino parser failed!";
+            }
+            TLOG( DEBUG ) << "done with Alpino parser";
+          }
+
+          if ( alpDoc ) {
+            if ( !alreadyParsed && settings.saveAlpinoOutput ) {
+              string baseName;
+
+              if ( settings.saveAlpinoMetadata ) {
+                baseName = inName;
+              } else {
+                // hide parsed files from input
+                int inFilenameIndex = inName.find_last_of( "/\\" ) + 1;
+                string inDir = inName.substr( 0, inFilenameIndex );            
+                baseName = inDir + "." + inName.substr( inFilenameIndex );
+              }
+
+              // add a suffix if it already exists
+              // this can happen when restarting on a modified input
+              string outName = unique_filename( baseName + "." + to_string( index + 1 ),
+                                                ".alpino.xml" + Compress::extension( settings.compression ) );
+
+              TLOG( DEBUG ) << "saving parse: " << outName;
+
+              xmlChar *xmlbuf;
+              int xmlsize;
+              xmlDocDumpFormatMemoryEnc( alpDoc, &xmlbuf, &xmlsize, "UTF8", 1 );
+              string xml( reinterpret_cast<const char *>( xmlbuf ), xmlsize );
+              xmlFree( xmlbuf );
+              if ( !Compress::writeFile( outName, xml ) ) {
+                TLOG( ERROR ) << "saving parse: " << outName << " FAILED!";
+              }
+
+              if ( settings.saveAlpinoMetadata ) {
+                int filenameIndex = outName.find_last_of( "/\\" ) + 1;
+                string dirname = outName.substr( 0, filenameIndex );
+                string metadataFilename = dirname + "." + outName.substr( filenameIndex ) + ".METADATA";
+                ofstream metadataFile( metadataFilename.c_str() );
+
+                metadataFile << "<?xml version=\"1.0\" encoding=\"UTF-8\"?>" << endl;
+                metadataFile << "<CLAMMetaData format=\"AlpinoXMLFormat\" mimetype=\"application/xml\" inputtemplate=\"alpino\">" << endl;
+                metadataFile << "  <meta id=\"encoding\">utf-8</meta>" << endl;
+                metadataFile << "</CLAMMetaData>" << endl;
+                metadataFile.close();
+              }
+
+              // add the tokens and Alpino XML filename to the lookup
+              AlpinoLookupAdd( s, outName );
+            }
+
+            parseFailCnt = 0; // OK
+            for ( size_t i = 0; i < tokens.size(); ++i ) {
+              if ( !tokens[i].pa )
+                throw folia::ValueError( "word doesn't have Frog POS tag info" );
+            }
+            dLevel = get_d_level( tokens, alpDoc );
+            if ( dLevel > 4 )
+              dLevel_gt4() = 1;
+            mod_stats( alpDoc, adjNpModCnt(), npModCnt() );
+            resolveAdverbials( alpDoc );
+            resolveRelativeClauses( alpDoc );
+            resolveFiniteVerbs( alpDoc );
+            resolveConjunctions( alpDoc );
+            resolveSmallConjunctions( alpDoc );
+          }
+          else {
+            parseFailCnt = 1; // failed
+          }
+        }
+      }
+      catch ( ... ) {
+        errors.keep();
+      }
+    } // omp section
+
+#pragma omp section
+    {
+      Profile::scope scope( prof );
+      try {
+        if ( settings.doWopr && !woprDone ) {
+          Profile::timer timer( Profile::WOPR_FWD );
+          if ( ngram_fwd.isOpen() ) {
+            scoreNgram( ngram_fwd, text, wopr_fwd );
+          }
+          else {
+            orderWopr( "fwd", text, wopr_fwd );
+          }
+        }
+      }
+      catch ( ... ) {
+        errors.keep();
+      }
+    } // omp section
+#pragma omp section
+    {
+      Profile::scope scope( prof );
+      try {
+        if ( settings.doWopr && !woprDone ) {
+          Profile::timer timer( Profile::WOPR_BWD );
+          if ( ngram_bwd.isOpen() ) {
+            scoreNgram( ngram_bwd, text, wopr_bwd );
+          }
+          else {
+            orderWopr( "bwd", text, wopr_bwd );
+          }
+        }
+      }
+      catch ( ... ) {
+        errors.keep();
+      }
+    } // omp section
+  }   // omp sections
+  errors.rethrow();
+
+  sentCnt = 1; // so only count the sentence when not failed
+
+  bool question = false;
+  vector<string> wordbuffer;
+  vector<string> lemmabuffer;
+  if ( pred ) {
+    fill_word_lemma_buffers( pred, wordbuffer, lemmabuffer );
+#ifdef DEBUG_OL
+    cerr << "call sentenceOverlap, wordbuffer " << wordbuffer << endl;
+    cerr << "call sentenceOverlap, lemmabuffer " << lemmabuffer << endl;
+#endif
+  }
+  NER::sentenceNers nerTypes = NER::lookupNers( w, s );
+  words.first = arena.nextWord();
+  for ( size_t i = 0; i < w.size(); ++i ) {
+    xmlNode *alpWord = 0;
+    if ( alpDoc ) {
+      alpWord = getAlpNodeWord( alpDoc, w[i] );
+    }
+    wordStats *ws = 0;
+    {
+      Profile::timer timer( Profile::WORDS );
+      ws = arena.addWord( i, tokens, alpWord, parseFailCnt == 1 );
+    }
+    if ( parseFailCnt ) {
+      sv.push_back( ws );
+      continue;
+    }
+    if ( wopr_fwd.wordProbs[i] != -99 )
+      ws->logprob10_fwd = wopr_fwd.wordProbs[i];
+    if ( wopr_bwd.wordProbs[i] != -99 )
+      ws->logprob10_bwd = wopr_bwd.wordProbs[i];
+    if ( pred ) {
+      Profile::timer timer( Profile::OVERLAP );
+      ws->getSentenceOverlap( wordbuffer, lemmabuffer );
+    }
+
+    if ( ws->lemma[ws->lemma.length() - 1] == '?' ) {
+      question = true;
+    }
+    if ( ws->prop == CGN::ISLET ) {
+      letCnt()++;
+      sv.push_back( ws );
+      continue;
+    }
+    else if ( ws->on_stoplist ) {
+      sentStats::setCommonCounts( ws );
+      sv.push_back( ws );
+      continue;
+    }
+    else {
+      wordCnt()++;
+      if ( ws->prop == CGN::ISNAME ) nameCnt()++;
+      if ( ws->isContent ) contentCnt()++;
+      if ( ws->isContentStrict ) contentStrictCnt()++;
+      if ( ws->tag == CGN::N ) nounCnt()++;
+      if ( ws->tag == CGN::WW ) verbCnt()++;
+      if ( ws->tag == CGN::ADJ ) adjCnt()++;
+
+      NER::Type ner = nerTypes[i];
+      ws->nerProp = ner;
+
+      // If we did not find a SEM::Type for a noun, use the NER::Type to possibly find one.
+      if ( ws->sem_type == SEM::UNFOUND_NOUN ) {
+        ws->sem_type = NER::toSem( ner );
+      }
+
+      switch ( ner ) {
+        case NER::LOC_B:
+        case NER::EVE_B:
+        case NER::MISC_B:
+        case NER::ORG_B:
+        case NER::PER_B:
+        case NER::PRO_B:
+          ners[ner]++;
+          nerCnt()++;
+          break;
+        default:;
+      }
+
+      ws->isPersRef = ws->setPersRef(); // need NER Info for this
+
+      sentStats::setCommonCounts( ws );
+
+      heads[ws->tag]++;
+      charCnt += ws->charCnt;
+      charCntExNames += ws->charCntExNames;
+      morphCnt += ws->morphCnt;
+      morphCntExNames += ws->morphCntExNames;
+      aggregate( distances, ws->distances );
+
+      if ( ws->isContent ) {
+        word_freq() += ws->word_freq_log;
+        lemma_freq() += ws->lemma_freq_log;
+        avg_prob10_fwd_content() += ws->logprob10_fwd;
+        avg_prob10_bwd_content() += ws->logprob10_bwd;
+        if ( ws->prop != CGN::ISNAME ) {
+          word_freq_n() += ws->word_freq_log;
+          lemma_freq_n() += ws->lemma_freq_log;
+          avg_prob10_fwd_content_ex_names() += ws->logprob10_fwd;
+          avg_prob10_bwd_content_ex_names() += ws->logprob10_bwd;
+        }
+      }
+      if ( ws->isContentStrict ) {
+        word_freq_strict() += ws->word_freq_log;
+        lemma_freq_strict() += ws->lemma_freq_log;
+        if ( ws->prop != CGN::ISNAME ) {
+          word_freq_n_strict() += ws->word_freq_log;
+          lemma_freq_n_strict() += ws->lemma_freq_log;
+        }
+      }
+      if ( ws->prop != CGN::ISNAME ) {
+        avg_prob10_fwd_ex_names() += ws->logprob10_fwd;
+        avg_prob10_bwd_ex_names() += ws->logprob10_bwd;
+      }
+
+      if ( ws->isNominal ) nominalCnt()++;
+
+      if ( ws->f50 ) f50Cnt()++;
+      if ( ws->f65 ) f65Cnt()++;
+      if ( ws->f77 ) f77Cnt()++;
+      if ( ws->f80 ) f80Cnt()++;
+
+      switch ( ws->top_freq ) {
+          // NO BREAKS (being in top1000 means being in top2000 as well)
+        case top1000:
+          ++top1000Cnt();
+          if ( ws->isContent ) ++top1000ContentCnt();
+          if ( ws->isContentStrict ) ++top1000ContentStrictCnt();
+          // fallthrough
+        case top2000:
+          ++top2000Cnt();
+          if ( ws->isContent ) ++top2000ContentCnt();
+          if ( ws->isContentStrict ) ++top2000ContentStrictCnt();
+          // fallthrough
+        case top3000:
+          ++top3000Cnt();
+          if ( ws->isContent ) ++top3000ContentCnt();
+          if ( ws->isContentStrict ) ++top3000ContentStrictCnt();
+          // fallthrough
+        case top5000:
+          ++top5000Cnt();
+          if ( ws->isContent ) ++top5000ContentCnt();
+          if ( ws->isContentStrict ) ++top5000ContentStrictCnt();
+          // fallthrough
+        case top10000:
+          ++top10000Cnt();
+          if ( ws->isContent ) ++top10000ContentCnt();
+          if ( ws->isContentStrict ) ++top10000ContentStrictCnt();
+          // fallthrough
+        case top20000:
+          ++top20000Cnt();
+          if ( ws->isContent ) ++top20000ContentCnt();
+          if ( ws->isContentStrict ) ++top20000ContentStrictCnt();
+          // fallthrough
+        default:
+          break;
+      }
+
+      switch ( ws->sem_type ) {
+        case SEM::UNDEFINED_NOUN:
+          ++undefinedNounCnt();
+          break;
+        case SEM::UNDEFINED_ADJ:
+          ++undefinedAdjCnt();
+          break;
+        case SEM::UNFOUND_NOUN:
+          ++uncoveredNounCnt();
+          break;
+        case SEM::UNFOUND_ADJ:
+          ++uncoveredAdjCnt();
+          break;
+        case SEM::UNFOUND_VERB:
+          ++uncoveredVerbCnt();
+          break;
+        case SEM::CONCRETE_HUMAN_NOUN:
+          humanCnt()++;
+          strictNounCnt()++;
+          broadNounCnt()++;
+          break;
+        case SEM::CONCRETE_NONHUMAN_NOUN:
+          nonHumanCnt()++;
+          strictNounCnt()++;
+          broadNounCnt()++;
+          break;
+        case SEM::CONCRETE_ARTEFACT_NOUN:
+          artefactCnt()++;
+          strictNounCnt()++;
+          broadNounCnt()++;
+          break;
+        case SEM::CONCRETE_SUBSTANCE_NOUN:
+          substanceConcCnt()++;
+          strictNounCnt()++;
+          broadNounCnt()++;
+          break;
+        case SEM::CONCRETE_FOOD_CARE_NOUN:
+          foodcareCnt()++;
+          strictNounCnt()++;
+          broadNounCnt()++;
+          break;
+        case SEM::CONCRETE_OTHER_NOUN:
+          concrotherCnt()++;
+          strictNounCnt()++;
+          broadNounCnt()++;
+          break;
+        case SEM::BROAD_CONCRETE_PLACE_NOUN:
+          ++placeCnt();
+          broadNounCnt()++;
+          break;
+        case SEM::BROAD_CONCRETE_TIME_NOUN:
+          ++timeCnt();
+          broadNounCnt()++;
+          break;
+        case SEM::BROAD_CONCRETE_MEASURE_NOUN:
+          ++measureCnt();
+          broadNounCnt()++;
+          break;
+        case SEM::CONCRETE_DYNAMIC_NOUN:
+          ++dynamicConcCnt();
+          strictNounCnt()++;
+          broadNounCnt()++;
+          break;
+        case SEM::ABSTRACT_SUBSTANCE_NOUN:
+          ++substanceAbstrCnt();
+          break;
+        case SEM::ABSTRACT_DYNAMIC_NOUN:
+          ++dynamicAbstrCnt();
+          break;
+        case SEM::ABSTRACT_NONDYNAMIC_NOUN:
+          ++nonDynamicCnt();
+          break;
+        case SEM::INSTITUT_NOUN:
+          institutCnt()++;
+          break;
+        case SEM::HUMAN_ADJ:
+          humanAdjCnt()++;
+          broadAdjCnt()++;
+          strictAdjCnt()++;
+          break;
+        case SEM::EMO_ADJ:
+          emoAdjCnt()++;
+          broadAdjCnt()++;
+          strictAdjCnt()++;
+          break;
+        case SEM::NONHUMAN_SHAPE_ADJ:
+          nonhumanAdjCnt()++;
+          shapeAdjCnt()++;
+          broadAdjCnt()++;
+          strictAdjCnt()++;
+          break;
+        case SEM::NONHUMAN_COLOR_ADJ:
+          nonhumanAdjCnt()++;
+          colorAdjCnt()++;
+          broadAdjCnt()++;
+          strictAdjCnt()++;
+          break;
+        case SEM::NONHUMAN_MATTER_ADJ:
+          nonhumanAdjCnt()++;
+          matterAdjCnt()++;
+          broadAdjCnt()++;
+          strictAdjCnt()++;
+          break;
+        case SEM::NONHUMAN_SOUND_ADJ:
+          nonhumanAdjCnt()++;
+          soundAdjCnt()++;
+          broadAdjCnt()++;
+          strictAdjCnt()++;
+          break;
+        case SEM::NONHUMAN_OTHER_ADJ:
+          nonhumanAdjCnt()++;
+          nonhumanOtherAdjCnt()++;
+          broadAdjCnt()++;
+          strictAdjCnt()++;
+          break;
+        case SEM::TECH_ADJ:
+          techAdjCnt()++;
+          break;
+        case SEM::TIME_ADJ:
+          timeAdjCnt()++;
+          broadAdjCnt()++;
+          break;
+        case SEM::PLACE_ADJ:
+          placeAdjCnt()++;
+          broadAdjCnt()++;
+          break;
+        case SEM::SPEC_POS_ADJ:
+          specPosAdjCnt()++;
+          subjectiveAdjCnt()++;
+          break;
+        case SEM::SPEC_NEG_ADJ:
+          specNegAdjCnt()++;
+          subjectiveAdjCnt()++;
+          break;
+        case SEM::POS_ADJ:
+          posAdjCnt()++;
+          subjectiveAdjCnt()++;
+          break;
+        case SEM::NEG_ADJ:
+          negAdjCnt()++;
+          subjectiveAdjCnt()++;
+          break;
+        case SEM::EVALUATIVE_ADJ:
+          evaluativeAdjCnt()++;
+          subjectiveAdjCnt()++;
+          break;
+        case SEM::EPI_POS_ADJ:
+          epiPosAdjCnt()++;
+          subjectiveAdjCnt()++;
+          break;
+        case SEM::EPI_NEG_ADJ:
+          epiNegAdjCnt()++;
+          subjectiveAdjCnt()++;
+          break;
+        case SEM::ABSTRACT_ADJ:
+          abstractAdjCnt()++;
+          break;
+        case SEM::ABSTRACT_STATE:
+          abstractWwCnt()++;
+          stateCnt()++;
+          break;
+        case SEM::CONCRETE_STATE:
+          concreteWwCnt()++;
+          stateCnt()++;
+          break;
+        case SEM::UNDEFINED_STATE:
+          undefinedWwCnt()++;
+          stateCnt()++;
+          break;
+        case SEM::ABSTRACT_ACTION:
+          abstractWwCnt()++;
+          actionCnt()++;
+          break;
+        case SEM::CONCRETE_ACTION:
+          concreteWwCnt()++;
+          actionCnt()++;
+          break;
+        case SEM::UNDEFINED_ACTION:
+          undefinedWwCnt()++;
+          actionCnt()++;
+          break;
+        case SEM::ABSTRACT_PROCESS:
+          abstractWwCnt()++;
+          processCnt()++;
+          break;
+        case SEM::CONCRETE_PROCESS:
+          concreteWwCnt()++;
+          processCnt()++;
+          break;
+        case SEM::UNDEFINED_PROCESS:
+          undefinedWwCnt()++;
+          processCnt()++;
+          break;
+        case SEM::ABSTRACT_UNDEFINED:
+          abstractWwCnt()++;
+          break;
+        case SEM::CONCRETE_UNDEFINED:
+          concreteWwCnt()++;
+          break;
+        case SEM::UNDEFINED_VERB:
+          undefinedWwCnt()++;
+          undefinedATPCnt()++;
+          break;
+        default:;
+      }
+
+      // Counts for general nouns
+      if ( ws->general_noun_type != General::NO_GENERAL ) generalNounCnt()++;
+      if ( General::isSeparate( ws->general_noun_type ) ) generalNounSepCnt()++;
+      if ( General::isRelated( ws->general_noun_type ) ) generalNounRelCnt()++;
+      if ( General::isActing( ws->general_noun_type ) ) generalNounActCnt()++;
+      if ( General::isKnowledge( ws->general_noun_type ) ) generalNounKnowCnt()++;
+      if ( General::isDiscussion( ws->general_noun_type ) ) generalNounDiscCnt()++;
+      if ( General::isDevelopment( ws->general_noun_type ) ) generalNounDeveCnt()++;
+
+      // Counts for general verbs
+      if ( ws->general_verb_type != General::NO_GENERAL ) generalVerbCnt()++;
+      if ( General::isSeparate( ws->general_verb_type ) ) generalVerbSepCnt()++;
+      if ( General::isRelated( ws->general_verb_type ) ) generalVerbRelCnt()++;
+      if ( General::isActing( ws->general_verb_type ) ) generalVerbActCnt()++;
+      if ( General::isKnowledge( ws->general_verb_type ) ) generalVerbKnowCnt()++;
+      if ( General::isDiscussion( ws->general_verb_type ) ) generalVerbDiscCnt()++;
+      if ( General::isDevelopment( ws->general_verb_type ) ) generalVerbDeveCnt()++;
+
+      // Counts for compounds
+      if ( ws->tag == CGN::N ) {
+        charCntNoun() += ws->charCnt;
+        word_freq_log_noun() += ws->word_freq_log;
+        switch ( ws->top_freq ) {
+          case top1000:
+            top1000CntNoun()++;
+            // fallthrough
+          case top2000:
+          case top3000:
+          case top5000:
+            top5000CntNoun()++;
+            // fallthrough
+          case top10000:
+          case top20000:
+            top20000CntNoun()++;
+            // fallthrough
+          default:
+            break;
+        }
+
+        if ( ws->is_compound ) {
+          compoundCnt()++;
+          if ( ws->compound_parts == 3 ) {
+            compound3Cnt()++;
+          }
+
+          charCntComp() += ws->charCnt;
+          charCntHead() += ws->charCntHead;
+          charCntSat() += ws->charCntSat;
+          charCntNounCorr() += ws->charCntHead;
+          charCntCorr() += ws->charCntHead;
+
+          word_freq_log_comp() += ws->word_freq_log;
+          word_freq_log_head() += ws->word_freq_log_head;
+          word_freq_log_sat() += ws->word_freq_log_sat;
+          word_freq_log_head_sat() += ws->word_freq_log_head_sat;
+          word_freq_log_noun_corr() += ws->word_freq_log_head;
+          word_freq_log_corr() += ws->word_freq_log_head;
+          word_freq_log_n_corr() += ws->word_freq_log_head;
+          if ( ws->isContentStrict ) {
+            word_freq_log_corr_strict() += ws->word_freq_log_head;
+            word_freq_log_n_corr_strict() += ws->word_freq_log_head;
+          }
+
+          switch ( ws->top_freq ) {
+            case top1000:
+              top1000CntComp()++;
+              // fallthrough
+            case top2000:
+            case top3000:
+            case top5000:
+              top5000CntComp()++;
+              // fallthrough
+            case top10000:
+            // fallthrough
+            case top20000:
+              top20000CntComp()++;
+              // fallthrough
+            default:
+              break;
+          }
+          switch ( ws->top_freq_head ) {
+            case top1000:
+              top1000CntHead()++;
+              top1000CntNounCorr()++;
+              top1000CntCorr()++;
+              // fallthrough
+            case top2000:
+            case top3000:
+            case top5000:
+              top5000CntHead()++;
+              top5000CntNounCorr()++;
+              top5000CntCorr()++;
+              // fallthrough
+            case top10000:
+            case top20000:
+              top20000CntHead()++;
+              top20000CntNounCorr()++;
+              top20000CntCorr()++;
+              // fallthrough
+            default:
+              break;
+          }
+          switch ( ws->top_freq_sat ) {
+            case top1000:
+              top1000CntSat()++;
+              // fallthrough
+            case top2000:
+            case top3000:
+            case top5000:
+              top5000CntSat()++;
+              // fallthrough
+            case top10000:
+            case top20000:
+              top20000CntSat()++;
+              // fallthrough
+            default:
+              break;
+          }
+        }
+        else {
+          charCntNonComp() += ws->charCnt;
+          charCntNounCorr() += ws->charCnt;
+          charCntCorr() += ws->charCnt;
+
+          word_freq_log_non_comp() += ws->word_freq_log;
+          word_freq_log_noun_corr() += ws->word_freq_log;
+          word_freq_log_corr() += ws->word_freq_log;
+          word_freq_log_n_corr() += ws->word_freq_log;
+          if ( ws->isContentStrict ) {
+            word_freq_log_corr_strict() += ws->word_freq_log;
+            word_freq_log_n_corr_strict() += ws->word_freq_log;
+          }
+
+          switch ( ws->top_freq ) {
+            case top1000:
+              top1000CntNonComp()++;
+              top1000CntNounCorr()++;
+              top1000CntCorr()++;
+              // fallthrough
+            case top2000:
+            case top3000:
+            case top5000:
+              top5000CntNonComp()++;
+              top5000CntNounCorr()++;
+              top5000CntCorr()++;
+              // fallthrough
+            case top10000:
+            case top20000:
+              top20000CntNonComp()++;
+              top20000CntNounCorr()++;
+              top20000CntCorr()++;
+              // fallthrough
+            default:
+              break;
+          }
+        }
+      }
+      else {
+        charCntCorr() += ws->charCnt;
+
+        if ( ws->isContent ) {
+          word_freq_log_corr() += ws->word_freq_log;
+          if ( ws->prop != CGN::ISNAME ) {
+            word_freq_log_n_corr() += ws->word_freq_log;
+          }
+        }
+        if ( ws->isContentStrict ) {
+          word_freq_log_corr_strict() += ws->word_freq_log;
+          if ( ws->prop != CGN::ISNAME ) {
+            word_freq_log_n_corr_strict() += ws->word_freq_log;
+          }
+        }
+
+        switch ( ws->top_freq ) {
+          case top1000:
+            top1000CntCorr()++;
+            // fallthrough
+          case top5000:
+            top5000CntCorr()++;
+            // fallthrough
+          case top20000:
+            top20000CntCorr()++;
+            // fallthrough
+          default: break;
+        }
+      }
+
+      // Prevalences
+      if ( !std::isnan( ws->prevalenceP ) ) {
+        prevalenceP() += ws->prevalenceP;
+        prevalenceZ() += ws->prevalenceZ;
+        prevalenceCovered()++;
+
+        if ( ws->isContent ) {
+          prevalenceContentP() += ws->prevalenceP;
+          prevalenceContentZ() += ws->prevalenceZ;
+          prevalenceContentCovered()++;
+        }
+      }
+
+      sv.push_back( ws );
+    }
+  }
+  if ( alpDoc ) {
+    xmlFreeDoc( alpDoc );
+  }
+  words.last = arena.nextWord();
+  al_gem = getMeanAL();
+  al_max = getHighestAL();
+  resolveConnectives();
+  resolveSituations();
+  calculate_MTLDs();
+  if ( settings.groups.needs( Groups::INTENSIFIERS ) )
+    resolveMultiWordIntensify();
+  // Disabled for now
+  //  resolveMultiWordAfks();
+  if ( settings.groups.needs( Groups::FORMAL_WORDS ) )
+    resolveMultiWordFormal();
+  resolvePrepExpr();
+  if ( question )
+    questCnt() = 1;
+  if ( ( morphNegCnt() + propNegCnt() ) > 1 )
+    multiNegCnt() = 1;
+
+  word_freq_log = proportion( word_freq(), contentCnt() ).p;
+  lemma_freq_log = proportion( lemma_freq(), contentCnt() ).p;
+  word_freq_log_n = proportion( word_freq_n(), contentCnt() - nameCnt() ).p;
+  lemma_freq_log_n = proportion( lemma_freq_n(), contentCnt() - nameCnt() ).p;
+
+  word_freq_log_strict = proportion( word_freq_strict(), contentStrictCnt() ).p;
+  lemma_freq_log_strict = proportion( lemma_freq_strict(), contentStrictCnt() ).p;
+  word_freq_log_n_strict = proportion( word_freq_n_strict(), contentStrictCnt() - nameCnt() ).p;
+  lemma_freq_log_n_strict = proportion( lemma_freq_n_strict(), contentStrictCnt() - nameCnt() ).p;
+
+  np_length( s, tokens, npCnt(), indefNpCnt(), npSize() );
+  rarityLevel = settings.rarityLevel;
+  overlapSize = settings.overlapSize;
+
+  // Assign and normalize the values from Wopr
+  if ( wopr_fwd.sentProb != -99 ) {
+    avg_prob10_fwd() = wopr_fwd.sentProb;
+  }
+  if ( wopr_bwd.sentProb != -99 ) {
+    avg_prob10_bwd() = wopr_bwd.sentProb;
+  }
+  entropy_fwd() = wopr_fwd.entropy;
+  entropy_bwd() = wopr_bwd.entropy;
+  perplexity_fwd() = wopr_fwd.perplexity;
+  perplexity_bwd() = wopr_bwd.perplexity;
+
+  avg_prob10_fwd_content() = proportion( avg_prob10_fwd_content(), contentCnt() ).p;
+  avg_prob10_fwd_ex_names() = proportion( avg_prob10_fwd_ex_names(), wordCnt() - nameCnt() ).p;
+  avg_prob10_fwd_content_ex_names() = proportion( avg_prob10_fwd_content_ex_names(), contentCnt() - nameCnt() ).p;
+  avg_prob10_bwd_content() = proportion( avg_prob10_bwd_content(), contentCnt() ).p;
+  avg_prob10_bwd_ex_names() = proportion( avg_prob10_bwd_ex_names(), wordCnt() - nameCnt() ).p;
+  avg_prob10_bwd_content_ex_names() = proportion( avg_prob10_bwd_content_ex_names(), contentCnt() - nameCnt() ).p;
+  entropy_fwd_norm() = proportion( entropy_fwd(), w.size() ).p;
+  entropy_bwd_norm() = proportion( entropy_bwd(), w.size() ).p;
+  perplexity_fwd_norm() = proportion( perplexity_fwd(), pow( w.size(), 2 ) ).p;
+  perplexity_bwd_norm() = proportion( perplexity_bwd(), pow( w.size(), 2 ) ).p;
+}
+
+Conn::Type sentStats::checkMultiConnectives( const string &mword ) {
+  Conn::Type conn = Conn::NOCONN;
+  if ( settings.multi_temporals.find( mword ) != settings.multi_temporals.end() ) {
+    conn = Conn::TEMPOREEL;
+  }
+  else if ( settings.multi_opsommers_wg.find( mword ) != settings.multi_opsommers_wg.end() ) {
+    conn = Conn::OPSOMMEND_WG;
+  }
+  else if ( settings.multi_opsommers_zin.find( mword ) != settings.multi_opsommers_zin.end() ) {
+    conn = Conn::OPSOMMEND_ZIN;
+  }
+  else if ( settings.multi_contrast.find( mword ) != settings.multi_contrast.end() ) {
+    conn = Conn::CONTRASTIEF;
+  }
+  else if ( settings.multi_compars.find( mword ) != settings.multi_compars.end() ) {
+    conn = Conn::COMPARATIEF;
+  }
+  else if ( settings.multi_causals.find( mword ) != settings.multi_causals.end() ) {
+    conn = Conn::CAUSAAL;
+  }
+  //  cerr << "multi-conn " << mword << " = " << conn << endl;
+  return conn;
+}
+
+Situation::Type sentStats::checkMultiSituations( const string &mword ) {
+  //  cerr << "check multi-sit '" << mword << "'" << endl;
+  Situation::Type sit = Situation::NO_SIT;
+  if ( settings.multi_time_sits.find( mword ) != settings.multi_time_sits.end() ) {
+    sit = Situation::TIME_SIT;
+  }
+  else if ( settings.multi_space_sits.find( mword ) != settings.multi_space_sits.end() ) {
+    sit = Situation::SPACE_SIT;
+  }
+  else if ( settings.multi_causal_sits.find( mword ) != settings.multi_causal_sits.end() ) {
+    sit = Situation::CAUSAL_SIT;
+  }
+  else if ( settings.multi_emotion_sits.find( mword ) != settings.multi_emotion_sits.end() ) {
+    sit = Situation::EMO_SIT;
+  }
+  //  cerr << "multi-sit " << mword << " = " << sit << endl;
+  return sit;
+}
+
+void sentStats::resolveMultiWordIntensify() {
+  auto assign = [this]( wordStats *word, Intensify::Type type ) {
+    ++intensCombiCnt();
+    ++intensCnt();
+    word->intensify_type = type;
+  };
+
+  resolveMultiWord(sv, settings.intensify, max_length_intensify, assign);
+}
+
+void sentStats::resolveMultiWordFormal() {
+  auto assign = []( wordStats *word, Formal::Type type ) {
+    word->formal_type = type;
+  };
+
+  resolveMultiWord(sv, settings.formal, max_length_formal, assign);
+
+  for ( size_t i = 0; i < sv.size(); ++i ) {
+    sentStats::setFormalCounts( dynamic_cast<wordStats *>( sv[i] ) );
+  }
+}
+
+// void sentStats::resolveMultiWordAfks() {
+//   if ( sv.size() > 1 ) {
+//     for ( size_t i = 0; i < sv.size() - 2; ++i ) {
+//       string word = sv[i]->ltext();
+//       string multiword2 = word + " " + sv[i + 1]->ltext();
+//       string multiword3 = multiword2 + " " + sv[i + 2]->ltext();
+//       Afk::Type at = Afk::NO_A;
+//       map<string, Afk::Type>::const_iterator sit
+//           = settings.afkos.find( multiword3 );
+//       if ( sit == settings.afkos.end() ) {
+//         sit = settings.afkos.find( multiword2 );
+//       }
+//       else {
+//         cerr << "FOUND a 3-word AFK: '" << multiword3 << "'" << endl;
+//       }
+//       if ( sit != settings.afkos.end() ) {
+//         cerr << "FOUND a 2-word AFK: '" << multiword2 << "'" << endl;
+//         at = sit->second;
+//       }
+//       if ( at != Afk::NO_A ) {
+//         ++afks[at];
+//       }
+//     }
+//     // don't forget the last 2 words
+//     string multiword2 = sv[sv.size() - 2]->ltext() + " " + sv[sv.size() - 1]->ltext();
+//     map<string, Afk::Type>::const_iterator sit
+//         = settings.afkos.find( multiword2 );
+//     if ( sit != settings.afkos.end() ) {
+//       cerr << "FOUND a 2-word AFK: '" << multiword2 << "'" << endl;
+//       Afk::Type at = sit->second;
+//       ++afks[at];
+//     }
+//   }
+// }
+
+void sentStats::resolvePrepExpr() {
+  if ( sv.size() > 2 ) {
+    for ( size_t i = 0; i < sv.size() - 1; ++i ) {
+      string word = sv[i]->ltext();
+      string mw2 = word + " " + sv[i + 1]->ltext();
+      if ( settings.vzexpr2.find( mw2 ) != settings.vzexpr2.end() ) {
+        ++prepExprCnt();
+        i += 1;
+        continue;
+      }
+      if ( i < sv.size() - 2 ) {
+        string mw3 = mw2 + " " + sv[i + 2]->ltext();
+        if ( settings.vzexpr3.find( mw3 ) != settings.vzexpr3.end() ) {
+          ++prepExprCnt();
+          i += 2;
+          continue;
+        }
+        if ( i < sv.size() - 3 ) {
+          string mw4 = mw3 + " " + sv[i + 3]->ltext();
+          if ( settings.vzexpr4.find( mw4 ) != settings.vzexpr4.end() ) {
+            ++prepExprCnt();
+            i += 3;
+            continue;
+          }
+        }
+      }
+    }
+  }
+}
+
+// Finds nodes of adverbials and reports counts
+void sentStats::resolveAdverbials( xmlDoc *alpDoc ) {
+  list<xmlNode *> nodes = getAdverbialNodes( alpDoc );
+  vcModCnt() = nodes.size();
+
+  // Check for adverbials consisting of a single node that has the 'GENERAL' type.
+  for ( auto &node : nodes ) {
+    string word = TiCC::getAttribute( node, "word" );
+    if ( word != "" ) {
+      word = TiCC::lowercase( word );
+      if ( checkAdverbType( word, CGN::BW ) == Adverb::GENERAL ) {
+        vcModSingleCnt()++;
+      }
+    }
+  }
+}
+
+parStats::parStats( const string &inName, int index, folia::Paragraph *p, const woprBatch *wopr, statsArena &arena ) :
+    structStats( index, p, "par" ) {
+  sentCnt = 0;
+  vector<folia::Sentence *> sents = p->sentences();
+  woprBatch parWopr;
+  if ( settings.doWopr && settings.woprBatchLevel == WOPR_PARAGRAPH ) {
+    parWopr.order( sents );
+    wopr = &parWopr;
+  }
+  sentStats *prev = 0;
+  for ( size_t i = 0; i < sents.size(); ++i ) {
+    sentStats *ss = arena.addSentence( inName + "." + to_string( index + 1 ), i, sents[i], prev, wopr );
+    prev = ss;
+    merge( ss );
+  }
+  calculate_MTLDs();
+
+  word_freq_log = proportion( word_freq(), contentCnt() ).p;
+  lemma_freq_log = proportion( lemma_freq(), contentCnt() ).p;
+  word_freq_log_n = proportion( word_freq_n(), contentCnt() - nameCnt() ).p;
+  lemma_freq_log_n = proportion( lemma_freq_n(), contentCnt() - nameCnt() ).p;
+
+  word_freq_log_strict = proportion( word_freq_strict(), contentStrictCnt() ).p;
+  lemma_freq_log_strict = proportion( lemma_freq_strict(), contentStrictCnt() ).p;
+  word_freq_log_n_strict = proportion( word_freq_n_strict(), contentStrictCnt() - nameCnt() ).p;
+  lemma_freq_log_n_strict = proportion( lemma_freq_n_strict(), contentStrictCnt() - nameCnt() ).p;
+}
+
+//#define DEBUG_DOL
+
+void docStats::calculate_doc_overlap() {
+  Profile::timer timer( Profile::OVERLAP );
+  if ( words.size() < settings.overlapSize )
+    return;
+  overlapWindow wordbuffer( settings.overlapSize );
+  overlapWindow lemmabuffer( settings.overlapSize );
+  for ( const wordStats *it = words.begin(); it != words.end(); ++it ) {
+    if ( it->wordProperty() == CGN::ISLET )
+      continue;
+    unsigned int word_classes = pronoun_classes( it->l_word );
+    unsigned int lemma_classes = pronoun_classes( it->l_lemma );
+    if ( wordbuffer.full() ) {
+#ifdef DEBUG_DOL
+      cerr << "Document overlap" << endl;
+      cerr << "test overlap: << " << it->l_word << " " << it->l_lemma << endl;
+#endif
+      if ( it->isOverlapCandidate() ) {
+        if ( wordbuffer.overlaps( it->l_word_id, word_classes ) ) {
+          ++doc_word_overlapCnt;
+#ifdef DEBUG_DOL
+          cerr << "word OVERLAP " << it->l_word << endl;
+#endif
+        }
+        if ( lemmabuffer.overlaps( it->l_lemma_id, lemma_classes ) ) {
+          ++doc_lemma_overlapCnt;
+#ifdef DEBUG_DOL
+          cerr << "lemma OVERLAP " << it->l_lemma << endl;
+#endif
+        }
+      }
+#ifdef DEBUG_DOL
+      else {
+        cerr << "geen kandidaat" << endl;
+      }
+#endif
+    }
+    wordbuffer.push( it->l_word_id, word_classes );
+    lemmabuffer.push( it->l_lemma_id, lemma_classes );
+  }
+}
+
+/**
+ * @brief Counts the words that will be analysed, i.e. the words of all
+ * sentences in all paragraphs of the document.
+ * @param doc the FoLiA document
+ * @return the number of words
+ */
+size_t count_words( const folia::Document *doc ) {
+  size_t result = 0;
+  vector<folia::Paragraph *> pars = doc->paragraphs();
+  for ( size_t i = 0; i < pars.size(); ++i ) {
+    vector<folia::Sentence *> sents = pars[i]->sentences();
+    for ( size_t j = 0; j < sents.size(); ++j ) {
+      result += sents[j]->words().size();
+    }
+  }
+  return result;
+}
+
+docStats::docStats( const string &inName, folia::Document *doc ) :
+    structStats( 0, 0, "document" ),
+    arena( count_words( doc ) ),
+    doc_word_overlapCnt( 0 ), doc_lemma_overlapCnt( 0 ) {
+  sentCnt = 0;
+  doc->declare( folia::AnnotationType::METRIC,
+                "metricset",
+                "annotator='tscan'" );
+  doc->declare( folia::AnnotationType::POS,
+                "tscan-set",
+                "annotator='tscan'" );
+  if ( !settings.style.empty() ) {
+    doc->replaceStyle( "text/xsl", settings.style );
+  }
+  vector<folia::Paragraph *> pars = doc->paragraphs();
+  if ( pars.size() > 0 )
+    folia_node = pars[0]->parent();
+  woprBatch docWopr;
+  if ( settings.doWopr && settings.woprBatchLevel == WOPR_DOCUMENT ) {
+    docWopr.order( doc->sentences() );
+  }
+  for ( size_t i = 0; i != pars.size(); ++i ) {
+    parStats *ps = arena.addParagraph( inName, i, pars[i], &docWopr );
+    merge( ps );
+  }
+  calculate_MTLDs();
+
+  word_freq_log = proportion( word_freq(), contentCnt() ).p;
+  lemma_freq_log = proportion( lemma_freq(), contentCnt() ).p;
+  word_freq_log_n = proportion( word_freq_n(), contentCnt() - nameCnt() ).p;
+  lemma_freq_log_n = proportion( lemma_freq_n(), contentCnt() - nameCnt() ).p;
+
+  word_freq_log_strict = proportion( word_freq_strict(), contentStrictCnt() ).p;
+  lemma_freq_log_strict = proportion( lemma_freq_strict(), contentStrictCnt() ).p;
+  word_freq_log_n_strict = proportion( word_freq_n_strict(), contentStrictCnt() - nameCnt() ).p;
+  lemma_freq_log_n_strict = proportion( lemma_freq_n_strict(), contentStrictCnt() - nameCnt() ).p;
+
+  if ( settings.groups.needs( Groups::DOC_OVERLAP ) )
+    calculate_doc_overlap();
+
+  rarity_index = rarity( settings.rarityLevel );
+}
+
+//#define DEBUG_FROG
+
+namespace {
+
+/// @brief a Frog server, from the [[frog]] section of the config
+struct frogEndpoint {
+  string host;
+  string port;
+};
+
+} // namespace
+
+/// @brief Returns the configured Frog servers: the 'endpoints' list
+/// (host:port,host:port,...) when given, else the single host and port
+vector<frogEndpoint> getFrogEndpoints() {
+  vector<frogEndpoint> result;
+  string endpoints = config.lookUp( "endpoints", "frog" );
+  if ( !endpoints.empty() ) {
+    vector<string> parts;
+    TiCC::split_at( endpoints, parts, "," );
+    for ( size_t i = 0; i < parts.size(); ++i ) {
+      string part = TiCC::trim( parts[i] );
+      size_t pos = part.rfind( ':' );
+      if ( pos == string::npos || pos == 0 || pos + 1 == part.size() ) {
+        throw runtime_error( "invalid Frog endpoint '" + part + "', expected host:port" );
+      }
+      frogEndpoint ep;
+      ep.host = part.substr( 0, pos );
+      ep.port = part.substr( pos + 1 );
+      result.push_back( ep );
+    }
+  }
+  else {
+    frogEndpoint ep;
+    ep.host = config.lookUp( "host", "frog" );
+    ep.port = config.lookUp( "port", "frog" );
+    result.push_back( ep );
+  }
+  return result;
+}
+
+/// @brief Reads the input text and cleans it up for Frog: comments are
+/// skipped, and brackets and the utf-8 BOM are replaced
+/// @param is the input
+/// @param lines receives the cleaned lines
+/// @return false when the comments are not balanced
+bool readFrogInput( istream &is, vector<string> &lines ) {
+  bool incomment = false;
+  string line;
+  while ( safe_getline( is, line ) ) {
+#ifdef DEBUG_FROG
+    cerr << "read: '" << line << "'" << endl;
+#endif
+
+    // cut off line after ###
+    size_t match = line.find( "###" );
+    if ( match != string::npos ) {
+      line = line.substr( 0, match );
+    }
+
+    // replace utf-8 BOM
+    if ( line.compare( 0, 3, "\xEF\xBB\xBF" ) == 0 ) {
+      line.erase( 0, 3 );
+    }
+
+    // replace brackets
+    std::regex opening( "[\\{\\[]" );
+    line = regex_replace( line, opening, "(" );
+
+    std::regex closing( "[\\}\\]]" );
+    line = regex_replace( line, closing, ")" );
+
+    if ( line.length() > 2 ) {
+      string start = line.substr( 0, 3 );
+      if ( start == "<<<" ) {
+        if ( incomment ) {
+          TLOG( ERROR ) << "Nested comment (<<<) not allowed!";
+          return false;
+        }
+        else {
+          incomment = true;
+        }
+      }
+      else if ( start == ">>>" ) {
+        if ( !incomment ) {
+          TLOG( ERROR ) << "end of comment (>>>) found without start.";
+          return false;
+        }
+        else {
+          incomment = false;
+          continue;
+        }
+      }
+    }
+    if ( incomment )
+      continue;
+    lines.push_back( line );
+  }
+  return true;
+}
+
+/// @brief Sends lines [from, to) to a Frog server
+/// @return the FoLiA returned, or an empty string on failure
+string tagWithFrog( const frogEndpoint &ep, const vector<string> &lines,
+                    size_t from, size_t to ) {
+  Profile::timer timer( Profile::FROG );
+  Sockets::ClientSocket client;
+  if ( !client.connect( ep.host, ep.port ) ) {
+    TLOG( ERROR ) << "failed to open Frog connection: " << ep.host << ":" << ep.port;
+    TLOG( ERROR ) << "Reason: " << client.getMessage();
+    return "";
+  }
+#ifdef DEBUG_FROG
+  cerr << "start input loop" << endl;
+#endif
+  for ( size_t i = from; i < to; ++i ) {
+    if ( settings.sentencePerLine ) {
+      client.write( lines[i] + "\n\n" );
+    }
+    else {
+      client.write( lines[i] + "\n" );
+    }
+  }
+  client.write( "\nEOT\n" );
+  string result;
+  string s;
+  while ( client.read( s ) ) {
+    if ( s == "READY" )
+      break;
+    result += s + "\n";
+  }
+#ifdef DEBUG_FROG
+  cerr << "received data [" << result << "]" << endl;
+#endif
+  return result;
+}
+
+/// @brief Tags the input text with Frog. With several Frog servers
+/// configured, the text is split at paragraph boundaries and the parts
+/// are tagged concurrently.
+folia::Document *getFrogResult( istream &is ) {
+  vector<string> lines;
+  if ( !readFrogInput( is, lines ) ) {
+    return 0;
+  }
+  vector<frogEndpoint> endpoints = getFrogEndpoints();
+  vector<pair<size_t, size_t>> shards = Shards::split( lines, endpoints.size(),
+                                                          settings.sentencePerLine );
+  string result;
+  if ( shards.size() > 1 ) {
+    TLOG( INFO ) << "tagging " << shards.size() << " parts with Frog";
+    vector<string> parts( shards.size() );
+    vector<thread> taggers;
+    Profile::report *prof = Profile::current();
+    for ( size_t k = 0; k < shards.size(); ++k ) {
+      taggers.push_back( thread( [&, k]() {
+        Profile::scope scope( prof );
+        parts[k] = tagWithFrog( endpoints[k], lines, shards[k].first, shards[k].second );
+      } ) );
+    }
+    for ( size_t k = 0; k < taggers.size(); ++k ) {
+      taggers[k].join();
+    }
+    if ( find( parts.begin(), parts.end(), "" ) == parts.end() ) {
+      result = Shards::stitch( parts );
+    }
+    if ( result.empty() ) {
+      TLOG( WARNING ) << "combining the Frog parts failed, tagging the text at once";
+    }
+  }
+  if ( result.empty() ) {
+    result = tagWithFrog( endpoints[0], lines, 0, lines.size() );
+  }
+  folia::Document *doc = 0;
+  if ( !result.empty() && result.size() > min_file_length ) {
+#ifdef DEBUG_FROG
+    cerr << "start FoLiA parsing" << endl;
+#endif
+    doc = new folia::Document();
+    try {
+      doc->readFromString( result );
+#ifdef DEBUG_FROG
+      cerr << "finished" << endl;
+#endif
+    }
+    catch ( std::exception &e ) {
+      TLOG( ERROR ) << "FoLiaParsing failed:\n" << e.what();
+    }
+  } else {
+    TLOG( ERROR ) << "Empty result for FoLiaParsing ";
+  }
+  return doc;
+}
+
+/// @brief Checks whether the input is a FoLiA document rather than text,
+/// by looking at its start. The stream is rewound afterwards.
+/// @param is the input
+/// @return true for XML input
+bool isFoLiAInput( istream &is ) {
+  char buf[512];
+  is.read( buf, sizeof( buf ) );
+  string start( buf, is.gcount() );
+  is.clear();
+  is.seekg( 0 );
+  // skip the utf-8 BOM and leading white space
+  if ( start.compare( 0, 3, "\xEF\xBB\xBF" ) == 0 ) {
+    start.erase( 0, 3 );
+  }
+  size_t pos = start.find_first_not_of( " \t\r\n" );
+  if ( pos == string::npos ) {
+    return false;
+  }
+  return start.compare( pos, 5, "<?xml" ) == 0
+         || start.compare( pos, 6, "<FoLiA" ) == 0;
+}
+
+/// @brief Reads a FoLiA document that was tagged by Frog before, e.g. by
+/// an earlier pipeline stage or a previous tscan run, instead of sending
+/// the text to Frog. The document must hold all layers tscan needs.
+/// Metrics of a previous tscan run are removed.
+/// @param inName the FoLiA file
+/// @param content its (decompressed) content
+/// @param message receives the reason of a failure
+/// @return the document, or 0 on failure
+folia::Document *getTaggedFoLiA( const string &inName, const string &content,
+                                 string &message ) {
+  folia::Document *doc = new folia::Document();
+  try {
+    doc->readFromString( content );
+  }
+  catch ( std::exception &e ) {
+    message = "FoLiaParsing failed: " + string( e.what() );
+    delete doc;
+    return 0;
+  }
+  string missing;
+  if ( !doc->isDeclared( folia::AnnotationType::POS, frog_pos_set ) ) {
+    missing += " pos";
+  }
+  if ( !doc->isDeclared( folia::AnnotationType::LEMMA, frog_lemma_set ) ) {
+    missing += " lemma";
+  }
+  if ( !doc->isDeclared( folia::AnnotationType::MORPHOLOGICAL, frog_morph_set ) ) {
+    missing += " morphology";
+  }
+  if ( !doc->isDeclared( folia::AnnotationType::ENTITY, NER::frog_ner_set ) ) {
+    missing += " entities";
+  }
+  if ( !missing.empty() ) {
+    message = inName + " is not tagged by Frog, missing layer(s):" + missing;
+    delete doc;
+    return 0;
+  }
+  vector<folia::Word *> wv = doc->words();
+  for ( size_t i = 0; i < wv.size(); ++i ) {
+    if ( wv[i]->select<folia::PosAnnotation>( frog_pos_set ).size() != 1
+         || wv[i]->select<folia::LemmaAnnotation>( frog_lemma_set ).size() != 1 ) {
+      message = "word " + wv[i]->id() + " doesn't have Frog POS tag and lemma info";
+      delete doc;
+      return 0;
+    }
+  }
+  // the output of a previous tscan run
+  vector<folia::Metric *> mv = doc->doc()->select<folia::Metric>();
+  for ( size_t i = 0; i < mv.size(); ++i ) {
+    mv[i]->parent()->remove( mv[i] );
+  }
+  vector<folia::PosAnnotation *> pv = doc->doc()->select<folia::PosAnnotation>( "tscan-set" );
+  for ( size_t i = 0; i < pv.size(); ++i ) {
+    pv[i]->parent()->remove( pv[i] );
+  }
+  return doc;
+}
+
+/// @brief Lookup whether this sentence is available in the pre-parsed
+/// treebank
+/// @param sent
+/// @return the Alpino XML or 0 if not found
+xmlDoc *AlpinoLookup( folia::Sentence *sent ) {
+  string tokens = TiCC::UnicodeToUTF8( sent->toktext() );
+  TLOG( DEBUG ) << "LOOKING UP: " << tokens;
+  // lookup filename
+  pair<string, int> location;
+  if ( !alpinoLookup.find( tokens, location ) ) {
+    Profile::count( Profile::ALPINO_LOOKUP_MISS );
+  }
+  else {
+    Profile::count( Profile::ALPINO_LOOKUP_HIT );
+    // the treebank may be compressed
+    string data;
+    xmlDoc *xmldoc = 0;
+    if ( Compress::readFile( location.first, data ) ) {
+      xmldoc = xmlReadMemory( data.c_str(), data.length(), 0, 0,
+                              XML_PARSE_NOBLANKS );
+    }
+    if ( xmldoc ) {
+      if ( location.second == 0 ) {
+        // 0: file contains single treebank
+        return xmldoc;
+      }
+      auto trees = TiCC::FindNodes( xmldoc, "//alpino_ds[" + to_string( location.second ) + "]" );
+      auto tree = trees.begin();
+      if ( tree != trees.end() ) {
+        // point at the right tree (if it contains multiple)
+        xmlDocSetRootElement( xmldoc, *tree );
+        // open the file and return it
+        return xmldoc;
+      }
+    }
+  }
+
+  return 0;
+}
+
+void AlpinoLookupAdd( folia::Sentence *sent, const string &filename ) {
+  string tokens = TiCC::UnicodeToUTF8( sent->toktext() );
+  alpinoLookup.add( tokens, filename );
+}
+
+// #define DEBUG_ALPINO
+
+xmlDoc *AlpinoServerParse( folia::Sentence *sent ) {
+  string host = config.lookUp( "host", "alpino" );
+  string port = config.lookUp( "port", "alpino" );
+  Sockets::ClientSocket client;
+  if ( !client.connect( host, port ) ) {
+    throw runtime_error( "failed to open Alpino connection: " + host + ":" + port
+                         + ", reason: " + client.getMessage() );
+  }
+#ifdef DEBUG_ALPINO
+  cerr << "start input loop" << endl;
+#endif
+  string txt = TiCC::UnicodeToUTF8( sent->toktext() );
+  client.write( txt + "\n\n" );
+  string result;
+  string s;
+  while ( client.read( s ) ) {
+    result += s + "\n";
+  }
+#ifdef DEBUG_ALPINO
+  cerr << "received data [" << result << "]" << endl;
+#endif
+  return xmlReadMemory( result.c_str(), result.length(),
+                        0, 0, XML_PARSE_NOBLANKS );
+}
+
+
+/// @brief Reads the document to analyse: a text, which is tagged by Frog,
+/// or a FoLiA document tagged by Frog before.
+/// @param inName the name of the input
+/// @param content the input
+/// @param message receives the reason of a failure
+/// @return the document, or 0 on failure
+folia::Document *readInput( const string &inName, const string &content,
+                            string &message ) {
+  istringstream is( content );
+  if ( isFoLiAInput( is ) ) {
+    TLOG( INFO ) << "reading Frog tagged FoLiA from " << inName;
+    return getTaggedFoLiA( inName, content, message );
+  }
+  folia::Document *doc = getFrogResult( is );
+  if ( !doc ) {
+    message = "big trouble: no FoLiA document created ";
+  }
+  return doc;
+}
+
+/// @brief the callback that stores the results of an analysis
+typedef function<void( folia::Document *, const docStats & )> saver;
+
+/// @brief Analyses an input, with a profile report when profiling, and
+/// has the results stored.
+/// @param analyzer the analyzer
+/// @param inName the name of the input
+/// @param content the input
+/// @param save stores the results
+/// @param message receives the reason of a failure
+/// @return true on success
+bool analyseInput( const TScan::Analyzer &analyzer, const string &inName,
+                   const string &content, const saver &save,
+                   string &message ) {
+  unique_ptr<Profile::report> prof;
+  if ( Profile::enabled() ) {
+    prof.reset( new Profile::report( inName ) );
+  }
+  Profile::scope scope( prof.get() );
+  unique_ptr<folia::Document> doc( readInput( inName, content, message ) );
+  if ( !doc ) {
+    return false;
+  }
+  try {
+    unique_ptr<docStats> analyse = analyzer.analyse( doc.get(), inName );
+    if ( prof && profileMetadata ) {
+      // the saving isn't done yet, so it is missing from this copy
+      doc->set_metadata( "tscan-profile", prof->toJSON() );
+    }
+    save( doc.get(), *analyse );
+  }
+  catch ( ... ) {
+    Intern::clear();
+    throw;
+  }
+  // the interned ids are only meaningful within one document
+  Intern::clear();
+  Log::flush();
+  if ( prof ) {
+    Profile::write( *prof );
+  }
+  return true;
+}
+
+namespace TScan {
+
+  static atomic<bool> instance( false );
+
+  /// @brief Reads the configuration and applies the options, as tscan
+  /// did at startup.
+  /// @param name the configuration file
+  /// @param opts the changes to the configuration
+  Analyzer::Analyzer( const string &name, const options &opts ) :
+      configName( name ) {
+    if ( instance.exchange( true ) ) {
+      throw logic_error( "there can only be one TScan::Analyzer at a time" );
+    }
+    try {
+      init( opts );
+    }
+    catch ( ... ) {
+      instance = false;
+      throw;
+    }
+  }
+
+  void Analyzer::init( const options &opts ) {
+    if ( workdir_name.empty() ) {
+      // the working dir of the local Alpino parser
+      workdir_name = "/tmp/tscan-" + TiCC::toString( getpid() ) + "/";
+      struct stat sbuf;
+      int res = stat( workdir_name.c_str(), &sbuf );
+      if ( res == -1 || !S_ISDIR( sbuf.st_mode ) ) {
+        res = mkdir( workdir_name.c_str(), S_IRWXU | S_IRWXG );
+        if ( res ) {
+          string dir = workdir_name;
+          workdir_name.clear();
+          throw runtime_error( "problem creating working dir '" + dir
+                               + "' : " + TiCC::toString( res ) );
+        }
+      }
+      TLOG( INFO ) << "working dir " << workdir_name;
+    }
+    // nothing of an earlier Analyzer carries over
+    config = TiCC::Configuration();
+    alpinoLookup.clear();
+    ngram_fwd.close();
+    ngram_bwd.close();
+    if ( configName.empty() || !config.fill( configName ) ) {
+      throw runtime_error( "invalid configuration" );
+    }
+    // start afresh, as the lexicons are added to
+    writable_settings = settingData();
+    writable_settings.init( config );
+    if ( !opts.groups.empty() ) {
+      string error;
+      if ( !writable_settings.groups.parse( opts.groups, error ) ) {
+        throw runtime_error( "wrong value for 'groups' option: " + error );
+      }
+    }
+    // skip the analyses that none of the selected groups needs; all of
+    // them need Alpino
+    if ( !settings.groups.needs( Groups::WOPR ) && settings.doWopr ) {
+      TLOG( INFO ) << "the selected metric groups don't need word probabilities, Wopr is not used";
+      writable_settings.doWopr = false;
+      writable_settings.ngram_fwd_file.clear();
+      writable_settings.ngram_bwd_file.clear();
+    }
+    if ( !settings.ngram_fwd_file.empty() ) {
+      if ( !ngram_fwd.open( settings.ngram_fwd_file )
+           || !ngram_bwd.open( settings.ngram_bwd_file ) ) {
+        throw runtime_error( "unable to open the language models" );
+      }
+      if ( ngram_fwd.reversed() || !ngram_bwd.reversed() ) {
+        TLOG( WARNING ) << "'model_bwd' should be built with --reverse, and 'model_fwd' without";
+      }
+      // scoring in process is cheap, there is nothing to batch
+      writable_settings.woprBatchLevel = WOPR_SENTENCE;
+    }
+    if ( settings.showProblems ) {
+      if ( !Log::openProblems( probFilename, "missing,word,lemma,voll_lemma" ) ) {
+        throw runtime_error( "unable to open '" + probFilename + "'" );
+      }
+    }
+    if ( opts.sentencePerLine ) {
+      writable_settings.sentencePerLine = true;
+    }
+    if ( !Compress::available( opts.compression ) ) {
+      throw runtime_error( "this tscan is built without support for "
+                           + Compress::extension( opts.compression ) + " compression" );
+    }
+    writable_settings.compression = opts.compression;
+    if ( opts.skip.find_first_of( "wW" ) != string::npos ) {
+      writable_settings.doWopr = false;
+    }
+    if ( opts.skip.find_first_of( "aA" ) != string::npos ) {
+      writable_settings.doAlpino = false;
+      writable_settings.doAlpinoServer = false;
+    }
+    if ( opts.skip.find_first_of( "cC" ) != string::npos ) {
+      writable_settings.doXfiles = false;
+    }
+    columnsPrefix = opts.columnsPrefix;
+    profileMetadata = opts.profileMetadata;
+    if ( settings.saveAlpinoOutput && !alpinoLookup.openJournal( settings.alpinoJournal ) ) {
+      throw runtime_error( "unable to save the Alpino lookup" );
+    }
+  }
+
+  Analyzer::~Analyzer() {
+    if ( settings.saveAlpinoOutput ) {
+      alpinoLookup.save( "out" );
+    }
+    alpinoLookup.clear();
+    ngram_fwd.close();
+    ngram_bwd.close();
+    Log::flush();
+    instance = false;
+  }
+
+  /// @brief Adds the metrics to a document tagged by Frog.
+  /// @param doc the document
+  /// @param inName the name of the input, for the saved Alpino parses
+  /// @return the statistics of the document
+  unique_ptr<docStats> Analyzer::analyse( folia::Document *doc,
+                                          const string &inName ) const {
+    // the interned ids are only meaningful within one document
+    Intern::clear();
+    unique_ptr<docStats> analyse( new docStats( inName, doc ) );
+    Profile::timer timer( Profile::METRICS );
+    analyse->addMetrics(); // add metrics info to doc
+    return analyse;
+  }
+
+  /// @brief Analyses a text or FoLiA document in memory.
+  /// @param content the input
+  /// @param inName the name of the input, used in the tables
+  /// @param doCSV also make the tables
+  /// @param out receives the FoLiA and the tables
+  /// @param message receives the reason of a failure
+  /// @return true on success
+  bool Analyzer::analyse( const string &content, const string &inName,
+                          bool doCSV, result &out, string &message ) const {
+    auto save = [&]( folia::Document *doc, const docStats &analyse ) {
+      {
+        Profile::timer timer( Profile::SAVE_FOLIA );
+        ostringstream xml;
+        if ( !doc->save( xml ) ) {
+          throw runtime_error( "unable to serialise '" + inName + "'" );
+        }
+        out.folia = xml.str();
+      }
+      if ( doCSV ) {
+        Profile::timer timer( Profile::SAVE_CSV );
+        analyse.toCSV( inName, out.csv, settings.groups );
+      }
+    };
+    return analyseInput( *this, inName, content, save, message );
+  }
+
+  /// @brief Analyses one input file and saves the results.
+  /// @param inName the input file
+  /// @param outName the FoLiA output file
+  /// @param doCSV also save the CSV files
+  /// @param outputs receives the names of the files saved
+  /// @param message receives the reason of a failure
+  /// @return true on success
+  bool Analyzer::analyseFile( const string &inName, const string &outName,
+                              bool doCSV, vector<string> &outputs,
+                              string &message ) const {
+    // the input may be compressed
+    string content;
+    if ( !Compress::readFile( inName, content ) ) {
+      message = "failed to open file '" + inName + "'";
+      return false;
+    }
+    TLOG( INFO ) << "opened file " << inName;
+    auto save = [&]( folia::Document *doc, const docStats &analyse ) {
+      {
+        Profile::timer timer( Profile::SAVE_FOLIA );
+        // the output only gets its name when complete, see isUpToDate()
+        if ( Compress::byName( outName ) != Compress::NONE ) {
+          ostringstream xml;
+          if ( !doc->save( xml ) || !Compress::writeFile( outName, xml.str() ) ) {
+            throw runtime_error( "unable to save '" + outName + "'" );
+          }
+        }
+        else {
+          string tmpName = tempName( outName );
+          if ( !doc->save( tmpName )
+               || rename( tmpName.c_str(), outName.c_str() ) != 0 ) {
+            remove( tmpName.c_str() );
+            throw runtime_error( "unable to save '" + outName + "'" );
+          }
+        }
+      }
+      outputs.push_back( outName );
+      if ( doCSV ) {
+        Profile::timer timer( Profile::SAVE_CSV );
+        analyse.toCSV( inName, settings.compression, settings.groups );
+        for ( int i = 0; i < 4; ++i ) {
+          outputs.push_back( docStats::csvName( inName, i, settings.compression ) );
+        }
+      }
+      if ( !columnsPrefix.empty() ) {
+        Profile::timer timer( Profile::SAVE_COLUMNS );
+        if ( !analyse.toColumns( inName, columnsPrefix, settings.compression,
+                                 settings.groups ) ) {
+          throw runtime_error( "unable to append to '" + columnsPrefix + "'" );
+        }
+        for ( int i = 0; i < 4; ++i ) {
+          outputs.push_back( docStats::columnsName( columnsPrefix, i, settings.compression ) );
+        }
+      }
+      TLOG( INFO ) << "saved output in " << outName;
+    };
+    return analyseInput( *this, inName, content, save, message );
+  }
+
+  bool Analyzer::tablesWanted() const {
+    return settings.doXfiles;
+  }
+
+  Compress::Type Analyzer::compression() const {
+    return settings.compression;
+  }
+
+}
@@ -95,6 +95,17 @@ namespace CGN {
         }
     }
 
+    Position toPosition( const string& s ) {
+        if (s == "nom")
+            return NOMIN;
+        else if (s == "prenom")
+            return PRENOM;
+        else if (s == "vrij")
+            return VRIJ;
+        else
+            return NOPOS;
+    }
+
     string toString(Position w) {
         switch (w) {
             case NOMIN:
@@ -108,6 +119,41 @@ namespace CGN {
         }
     }
 
+    WVorm toWVorm( const string& s ) {
+        if (s == "pv")
+            return WV_PV;
+        else if (s == "inf")
+            return WV_INF;
+        else if (s == "vd")
+            return WV_VD;
+        else if (s == "od")
+            return WV_OD;
+        else if (s.empty())
+            return NO_WVORM;
+        else
+            return WV_UNKNOWN;
+    }
+
+    PvTijd toPvTijd( const string& s ) {
+        if (s == "tgw")
+            return TGW;
+        else if (s == "verl")
+            return VERL;
+        else if (s == "conj")
+            return CONJ;
+        else
+            return NO_PVTIJD;
+    }
+
+    ConjType toConjType( const string& s ) {
+        if (s == "neven")
+            return NEVEN;
+        else if (s == "onder")
+            return ONDER;
+        else
+            return NO_CONJTYPE;
+    }
+
     ostream& operator<<( ostream& os, const Type& t ){
         os << toString( t );
         return os;
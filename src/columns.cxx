@@ -0,0 +1,205 @@
+#include <cmath>
+#include <cerrno>
+#include <limits>
+#include <stdexcept>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/file.h>
+#include "tscan/columns.h"
+
+using namespace std;
+
+static const int64_t INT_NA = numeric_limits<int64_t>::min();
+static const uint32_t TEXT_NA = 0xFFFFFFFF;
+
+/**
+ * Starts the block of a document.
+ * @param name the file to append to
+ * @param document the name of the document
+ * @return false when the file can't be written
+ */
+bool columnFile::open( const string& name, const string& document ){
+  fname = name;
+  document_name = document;
+  cols.clear();
+  rows = 0;
+  cur = 0;
+  ofstream test( name.c_str(), ios::binary|ios::app );
+  return test.good();
+}
+
+/**
+ * The column the next value goes to.
+ */
+columnFile::colData& columnFile::next(){
+  if ( cur >= cols.size() ){
+    throw logic_error( "line in " + fname + " has more than the "
+		       + to_string( cols.size() ) + " columns of the header" );
+  }
+  return cols[cur++];
+}
+
+static void typeError( const string& col, const string& file ){
+  throw logic_error( "column " + col + " in " + file + " changes type" );
+}
+
+void columnFile::column( const char *name, colType type ){
+  colData c;
+  c.name = name;
+  c.type = type;
+  cols.push_back( c );
+}
+
+void columnFile::na(){
+  colData& c = next();
+  switch ( c.type ){
+  case INT_COL:
+    c.ints.push_back( INT_NA );
+    break;
+  case REAL_COL:
+    c.reals.push_back( NAN );
+    break;
+  case TEXT_COL:
+    c.codes.push_back( TEXT_NA );
+    break;
+  }
+}
+
+void columnFile::text( const string& val, bool ){
+  colData& c = next();
+  if ( c.type != TEXT_COL ){
+    typeError( c.name, fname );
+  }
+  auto it = c.dict.find( val );
+  if ( it == c.dict.end() ){
+    it = c.dict.insert( make_pair( val, uint32_t( c.words.size() ) ) ).first;
+    c.words.push_back( val );
+  }
+  c.codes.push_back( it->second );
+}
+
+void columnFile::real( double val ){
+  colData& c = next();
+  if ( c.type != REAL_COL ){
+    typeError( c.name, fname );
+  }
+  c.reals.push_back( val );
+}
+
+void columnFile::integer( long long val ){
+  colData& c = next();
+  if ( c.type == INT_COL ){
+    c.ints.push_back( val );
+  }
+  else if ( c.type == REAL_COL ){
+    c.reals.push_back( double( val ) );
+  }
+  else {
+    typeError( c.name, fname );
+  }
+}
+
+/**
+ * Finishes a line. A line that is shorter than the header is completed
+ * with NA's.
+ */
+void columnFile::endLine( size_t, bool header ){
+  if ( !header ){
+    while ( cur < cols.size() ){
+      na();
+    }
+    ++rows;
+  }
+  cur = 0;
+}
+
+template <typename T>
+static void put( string& buf, T val ){
+  buf.append( reinterpret_cast<const char*>( &val ), sizeof( T ) );
+}
+
+static void putString( string& buf, const string& s ){
+  put( buf, uint32_t( s.size() ) );
+  buf += s;
+}
+
+template <typename T>
+static void putVector( string& buf, const vector<T>& v ){
+  if ( !v.empty() ){
+    buf.append( reinterpret_cast<const char*>( &v[0] ), v.size() * sizeof( T ) );
+  }
+}
+
+/**
+ * Appends a block to a file, as a whole. Other threads and other tscan
+ * processes may append to the same file at the same time: the lock keeps
+ * their blocks apart, also when a write has to be split.
+ * @param name the file
+ * @param block the bytes to append
+ * @return false when writing failed
+ */
+static bool appendBlock( const string& name, const string& block ){
+  int fd = ::open( name.c_str(), O_WRONLY|O_APPEND|O_CREAT, 0666 );
+  if ( fd < 0 ){
+    return false;
+  }
+  bool ok = true;
+  while ( flock( fd, LOCK_EX ) != 0 ){
+    if ( errno != EINTR ){
+      ok = false;
+      break;
+    }
+  }
+  size_t done = 0;
+  while ( ok && done < block.size() ){
+    ssize_t n = ::write( fd, block.data() + done, block.size() - done );
+    if ( n < 0 && errno != EINTR ){
+      ok = false;
+    }
+    else if ( n > 0 ){
+      done += n;
+    }
+  }
+  // closing releases the lock
+  return ::close( fd ) == 0 && ok;
+}
+
+/**
+ * Appends the block of the document to the file.
+ * @return false when writing failed
+ */
+bool columnFile::close(){
+  string body;
+  putString( body, document_name );
+  put( body, rows );
+  put( body, uint32_t( cols.size() ) );
+  for ( const auto& c : cols ){
+    putString( body, c.name );
+    put( body, uint8_t( c.type ) );
+    switch ( c.type ){
+    case INT_COL:
+      putVector( body, c.ints );
+      break;
+    case REAL_COL:
+      putVector( body, c.reals );
+      break;
+    case TEXT_COL:
+      put( body, uint32_t( c.words.size() ) );
+      for ( const auto& w : c.words ){
+	putString( body, w );
+      }
+      putVector( body, c.codes );
+      break;
+    }
+  }
+  string block = "TSCB";
+  put( block, uint32_t( 1 ) );
+  put( block, uint64_t( body.size() ) );
+  block += body;
+  cols.clear();
+  Compress::compressor zip( Compress::byName( fname ) );
+  string packed;
+  zip.add( block.data(), block.size(), packed );
+  zip.finish( packed );
+  return appendBlock( fname, packed );
+}
@@ -0,0 +1,264 @@
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+#include <zlib.h>
+#include "config.h"
+#ifdef HAVE_ZSTD
+#include <zstd.h>
+#endif
+#include "tscan/utils.h"
+#include "tscan/compress.h"
+
+using namespace std;
+
+namespace Compress {
+
+  static const size_t CHUNK = 65536;
+
+  bool parse( const string& s, Type& t ){
+    if ( s == "none" ){
+      t = NONE;
+    }
+    else if ( s == "gz" || s == "gzip" ){
+      t = GZIP;
+    }
+    else if ( s == "zstd" || s == "zst" ){
+      t = ZSTD;
+    }
+    else {
+      return false;
+    }
+    return true;
+  }
+
+  bool available( Type t ){
+#ifndef HAVE_ZSTD
+    if ( t == ZSTD ){
+      return false;
+    }
+#endif
+    return true;
+  }
+
+  string extension( Type t ){
+    switch ( t ){
+    case GZIP:
+      return ".gz";
+    case ZSTD:
+      return ".zst";
+    default:
+      return "";
+    }
+  }
+
+  static bool endsWith( const string& s, const string& end ){
+    return s.size() >= end.size()
+      && s.compare( s.size() - end.size(), end.size(), end ) == 0;
+  }
+
+  Type byName( const string& name ){
+    if ( endsWith( name, ".gz" ) ){
+      return GZIP;
+    }
+    if ( endsWith( name, ".zst" ) ){
+      return ZSTD;
+    }
+    return NONE;
+  }
+
+  compressor::compressor( Type t ): type( t ), state( 0 ){
+    if ( type == GZIP ){
+      z_stream *z = new z_stream();
+      // 15 + 16: a gzip header instead of a zlib one
+      if ( deflateInit2( z, Z_DEFAULT_COMPRESSION, Z_DEFLATED,
+			 15 + 16, 8, Z_DEFAULT_STRATEGY ) != Z_OK ){
+	delete z;
+	throw runtime_error( "unable to start gzip compression" );
+      }
+      state = z;
+    }
+    else if ( type == ZSTD ){
+#ifdef HAVE_ZSTD
+      state = ZSTD_createCCtx();
+#endif
+      if ( !state ){
+	throw runtime_error( "unable to start zstd compression" );
+      }
+    }
+  }
+
+  compressor::~compressor(){
+    if ( type == GZIP ){
+      z_stream *z = static_cast<z_stream*>( state );
+      deflateEnd( z );
+      delete z;
+    }
+#ifdef HAVE_ZSTD
+    else if ( type == ZSTD ){
+      ZSTD_freeCCtx( static_cast<ZSTD_CCtx*>( state ) );
+    }
+#endif
+  }
+
+  void compressor::run( const char *data, size_t len, string& out,
+			bool last ){
+    char buf[CHUNK];
+    if ( type == NONE ){
+      out.append( data, len );
+    }
+    else if ( type == GZIP ){
+      z_stream *z = static_cast<z_stream*>( state );
+      z->next_in = reinterpret_cast<Bytef*>( const_cast<char*>( data ) );
+      z->avail_in = len;
+      int res;
+      do {
+	z->next_out = reinterpret_cast<Bytef*>( buf );
+	z->avail_out = CHUNK;
+	res = deflate( z, last ? Z_FINISH : Z_NO_FLUSH );
+	if ( res == Z_STREAM_ERROR ){
+	  throw runtime_error( "gzip compression failed" );
+	}
+	out.append( buf, CHUNK - z->avail_out );
+      } while ( z->avail_out == 0 || ( last && res != Z_STREAM_END ) );
+    }
+#ifdef HAVE_ZSTD
+    else if ( type == ZSTD ){
+      ZSTD_CCtx *c = static_cast<ZSTD_CCtx*>( state );
+      ZSTD_inBuffer in = { data, len, 0 };
+      size_t left;
+      do {
+	ZSTD_outBuffer zout = { buf, CHUNK, 0 };
+	left = ZSTD_compressStream2( c, &zout, &in,
+				     last ? ZSTD_e_end : ZSTD_e_continue );
+	if ( ZSTD_isError( left ) ){
+	  throw runtime_error( string( "zstd compression failed: " )
+			       + ZSTD_getErrorName( left ) );
+	}
+	out.append( buf, zout.pos );
+      } while ( last ? left != 0 : in.pos < in.size );
+    }
+#endif
+  }
+
+  void compressor::add( const char *data, size_t len, string& out ){
+    run( data, len, out, false );
+  }
+
+  void compressor::finish( string& out ){
+    run( 0, 0, out, true );
+  }
+
+  bool writeFile( const string& name, const string& data ){
+    string tmp = tempName( name );
+    ofstream out( tmp.c_str(), ios::binary );
+    if ( !out ){
+      return false;
+    }
+    compressor zip( byName( name ) );
+    string buf;
+    for ( size_t pos = 0; pos < data.size(); pos += CHUNK ){
+      zip.add( data.data() + pos, min( CHUNK, data.size() - pos ), buf );
+      out.write( buf.data(), buf.size() );
+      buf.clear();
+    }
+    zip.finish( buf );
+    out.write( buf.data(), buf.size() );
+    return commitFile( out, tmp, name );
+  }
+
+  static Type byMagic( const string& start ){
+    if ( start.compare( 0, 2, "\x1f\x8b" ) == 0 ){
+      return GZIP;
+    }
+    if ( start.compare( 0, 4, "\x28\xb5\x2f\xfd" ) == 0 ){
+      return ZSTD;
+    }
+    return NONE;
+  }
+
+  bool isCompressed( const string& name ){
+    ifstream is( name.c_str(), ios::binary );
+    char buf[4];
+    is.read( buf, sizeof( buf ) );
+    return byMagic( string( buf, is.gcount() ) ) != NONE;
+  }
+
+  static bool gunzip( const string& in, string& out ){
+    z_stream z = z_stream();
+    // 15 + 32: recognise the gzip header
+    if ( inflateInit2( &z, 15 + 32 ) != Z_OK ){
+      return false;
+    }
+    char buf[CHUNK];
+    z.next_in = reinterpret_cast<Bytef*>( const_cast<char*>( in.data() ) );
+    z.avail_in = in.size();
+    int res;
+    while ( true ){
+      z.next_out = reinterpret_cast<Bytef*>( buf );
+      z.avail_out = CHUNK;
+      res = inflate( &z, Z_NO_FLUSH );
+      out.append( buf, CHUNK - z.avail_out );
+      if ( res == Z_STREAM_END ){
+	if ( z.avail_in == 0 ){
+	  break;
+	}
+	// the next member
+	inflateReset( &z );
+      }
+      else if ( res != Z_OK || ( z.avail_in == 0 && z.avail_out > 0 ) ){
+	// an error, or the data is truncated
+	break;
+      }
+    }
+    inflateEnd( &z );
+    return res == Z_STREAM_END;
+  }
+
+  static bool unzstd( const string& in, string& out ){
+#ifdef HAVE_ZSTD
+    ZSTD_DCtx *d = ZSTD_createDCtx();
+    if ( !d ){
+      return false;
+    }
+    char buf[CHUNK];
+    ZSTD_inBuffer zin = { in.data(), in.size(), 0 };
+    ZSTD_outBuffer zout;
+    size_t res;
+    do {
+      zout = { buf, CHUNK, 0 };
+      res = ZSTD_decompressStream( d, &zout, &zin );
+      if ( ZSTD_isError( res ) ){
+	break;
+      }
+      out.append( buf, zout.pos );
+    } while ( zin.pos < zin.size || zout.pos == CHUNK );
+    ZSTD_freeDCtx( d );
+    return res == 0;
+#else
+    cerr << "tscan was built without zstd support" << endl;
+    return false;
+#endif
+  }
+
+  bool readFile( const string& name, string& data ){
+    ifstream is( name.c_str(), ios::binary );
+    if ( !is ){
+      return false;
+    }
+    stringstream ss;
+    ss << is.rdbuf();
+    string raw = ss.str();
+    data.clear();
+    switch ( byMagic( raw ) ){
+    case GZIP:
+      return gunzip( raw, data );
+    case ZSTD:
+      return unzstd( raw, data );
+    default:
+      data.swap( raw );
+      return true;
+    }
+  }
+
+}
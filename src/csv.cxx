@@ -0,0 +1,212 @@
+#include <cstdio>
+#include <cmath>
+#include <stdexcept>
+#include "tscan/csv.h"
+
+using namespace std;
+
+/*******
+ * LINE
+ *******/
+
+csvLine::csvLine( tableFile& f, bool h, const Groups::selection& g ):
+  file( f ), groups( g ), header( h ), skip( false ), cols( 0 ){
+}
+
+/**
+ * Starts a column.
+ * @param name the name of the column
+ * @param type the type of its values
+ * @return true when its value is to be written
+ */
+bool csvLine::next( const char *name, colType type ){
+  ++cols;
+  if ( header ){
+    file.column( name, type );
+    return false;
+  }
+  if ( skip ){
+    file.na();
+    return false;
+  }
+  return true;
+}
+
+void csvLine::na( const char *name ){
+  if ( next( name, REAL_COL ) ){
+    file.na();
+  }
+}
+
+void csvLine::col( const char *name, const string& val ){
+  if ( next( name, TEXT_COL ) ){
+    file.text( val, false );
+  }
+}
+
+void csvLine::col( const char *name, const char *val ){
+  if ( next( name, TEXT_COL ) ){
+    file.text( val, false );
+  }
+}
+
+/**
+ * Adds a text column, between quotes.
+ */
+void csvLine::quoted( const char *name, const string& val ){
+  if ( next( name, TEXT_COL ) ){
+    file.text( val, true );
+  }
+}
+
+void csvLine::real( const char *name, double val ){
+  if ( next( name, REAL_COL ) ){
+    file.real( val );
+  }
+}
+
+void csvLine::integer( const char *name, long long val ){
+  if ( next( name, INT_COL ) ){
+    file.integer( val );
+  }
+}
+
+void csvLine::end(){
+  file.endLine( cols, header );
+}
+
+/*******
+ * FILE
+ *******/
+
+/**
+ * Opens the file under its temporary name.
+ * @param name the final name of the file
+ * @return false when the file can't be opened
+ */
+bool csvFile::open( const string& name ){
+  fname = name;
+  target = 0;
+  columns = 0;
+  cols = 0;
+  buf.clear();
+  zip.reset( new Compress::compressor( Compress::byName( name ) ) );
+  tmpName = tempName( name );
+  out.open( tmpName.c_str(), ios::binary );
+  return out.good();
+}
+
+/**
+ * Collects the CSV text in a string, instead of writing a file.
+ * @param text the string, emptied first
+ */
+void csvFile::collect( string& text ){
+  fname.clear();
+  target = &text;
+  target->clear();
+  columns = 0;
+  cols = 0;
+  buf.clear();
+}
+
+void csvFile::column( const char *name, colType ){
+  separate();
+  buf += name;
+}
+
+void csvFile::na(){
+  separate();
+  buf += "NA";
+}
+
+void csvFile::text( const string& val, bool quoted ){
+  separate();
+  if ( quoted ){
+    buf += '"';
+    buf += escape_quotes( val );
+    buf += '"';
+  }
+  else {
+    buf += val;
+  }
+}
+
+/**
+ * Adds a number. All fractions are written with 6 significant digits,
+ * trailing zeros included, and as NA when unknown.
+ */
+void csvFile::real( double val ){
+  if ( std::isnan( val ) ){
+    na();
+    return;
+  }
+  separate();
+  char tmp[32];
+  int len = snprintf( tmp, sizeof( tmp ), "%#g", val );
+  buf.append( tmp, len );
+}
+
+void csvFile::integer( long long val ){
+  separate();
+  char tmp[32];
+  int len = snprintf( tmp, sizeof( tmp ), "%lld", val );
+  buf.append( tmp, len );
+}
+
+/**
+ * Finishes a line. A line that is shorter than the header is completed
+ * with NA's.
+ * @param n the number of columns in the line
+ * @param header true for the header line
+ */
+void csvFile::endLine( size_t n, bool header ){
+  if ( header ){
+    columns = n;
+  }
+  else if ( columns > 0 ){
+    if ( n > columns ){
+      throw logic_error( "csv line in " + fname + " has "
+			 + to_string( n ) + " columns, the header only "
+			 + to_string( columns ) );
+    }
+    for ( ; n < columns; ++n ){
+      na();
+    }
+  }
+  buf += '\n';
+  cols = 0;
+  if ( buf.size() >= 65536 ){
+    flush( false );
+  }
+}
+
+/**
+ * Writes the buffer.
+ * @param last true when nothing follows
+ */
+void csvFile::flush( bool last ){
+  if ( target ){
+    *target += buf;
+    buf.clear();
+    return;
+  }
+  string packed;
+  zip->add( buf.data(), buf.size(), packed );
+  if ( last ){
+    zip->finish( packed );
+  }
+  out.write( packed.data(), packed.size() );
+  buf.clear();
+}
+
+/**
+ * Writes what is left and gives the file its final name.
+ * @return false when writing failed
+ */
+bool csvFile::close(){
+  flush( true );
+  if ( target ){
+    return true;
+  }
+  return commitFile( out, tmpName, fname );
+}
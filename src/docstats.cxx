@@ -1,13 +1,52 @@
 #include "tscan/stats.h"
+#include "tscan/columns.h"
+#include "tscan/log.h"
 
 using namespace std;
 
+/*******
+ * ARENA
+ *******/
+
+/**
+ * Constructs a new wordStats at the end of the arena.
+ * The arguments are passed on to the wordStats constructor.
+ */
+wordStats *statsArena::addWord( int index,
+				const tokenTable& tokens,
+				const xmlNode *alpWord,
+				bool fail ){
+  if ( words.size() == words.capacity() ){
+    // growing would move the words and invalidate all pointers to them
+    throw logic_error( "statsArena::addWord(): capacity exceeded" );
+  }
+  words.emplace_back( index, tokens, alpWord, fail );
+  return &words.back();
+}
+
+sentStats *statsArena::addSentence( const string& inName,
+				    int index,
+				    folia::Sentence *s,
+				    const sentStats *pred,
+				    const woprBatch *wopr ){
+  sentences.emplace_back( inName, index, s, pred, wopr, *this );
+  return &sentences.back();
+}
+
+parStats *statsArena::addParagraph( const string& inName,
+				    int index,
+				    folia::Paragraph *p,
+				    const woprBatch *wopr ){
+  paragraphs.emplace_back( inName, index, p, wopr, *this );
+  return &paragraphs.back();
+}
+
 /********
  * RARITY
  ********/
 
 double docStats::rarity( int level ) const {
-  map<string,int>::const_iterator it = unique_lemmas.begin();
+  Intern::Counter::const_iterator it = unique_lemmas.begin();
   int rare = 0;
   while ( it != unique_lemmas.end() ){
     if ( it->second <= level )
@@ -21,76 +60,169 @@ double docStats::rarity( int level ) const {
  * CSV OUTPUT
  ************/
 
-void docStats::toCSV( const string& name, csvKind what ) const {
-  if ( what == DOC_CSV ){
-    string fname = name + ".document.csv";
-    ofstream out( fname.c_str() );
-    if ( out ){
-      // 20141003: New features: paragraphs/sentences/words per document
-      CSVheader( out, "Inputfile,Par_per_doc,Zin_per_doc,Word_per_doc" );
-      out << name << "," << sv.size() << ",";
-      structStats::toCSV( out );
-      cerr << "stored document statistics in " << fname << endl;
-    }
-    else {
-      cerr << "storing document statistics in " << fname << " FAILED!" << endl;
-    }
+static const char *levels[] = { "document", "paragraph", "sentence", "word" };
+
+/**
+ * Fills the document, paragraph, sentence and word tables, in one walk
+ * over the document.
+ * @param name the name of the input file
+ * @param files the four tables
+ * @param groups the metric groups to fill them with
+ */
+void docStats::fillTables( const string& name, tableFile *files[],
+			   const Groups::selection& groups ) const {
+  // the first line of each table is preceded by its header line, so
+  // h counts down from 1 to 0 there.
+  // 20141003: New features: paragraphs/sentences/words per document
+  for ( int h=1; h >= 0; --h ){
+    csvLine line( *files[0], h, groups );
+    line.col( "Inputfile", name );
+    line.col( "Par_per_doc", sv.size() );
+    CSVcolumns( line );
+    line.end();
   }
-  else if ( what == PAR_CSV ){
-    string fname = name + ".paragraphs.csv";
-    ofstream out( fname.c_str() );
-    if ( out ){
-      for ( size_t par=0; par < sv.size(); ++par ){
-	if ( par == 0 )
+  for ( size_t par=0; par < sv.size(); ++par ){
+    const basicStats *ps = sv[par];
     // 20141003: New features: sentences/words per paragraph
-	  sv[0]->CSVheader( out, "Inputfile,Segment,Zin_per_par,Wrd_per_par" );
-	out << name << "," << sv[par]->id << ",";
-	sv[par]->toCSV( out );
+    for ( int h=( par == 0 ); h >= 0; --h ){
+      csvLine line( *files[1], h, groups );
+      line.col( "Inputfile", name );
+      line.col( "Segment", ps->id );
+      ps->CSVcolumns( line );
+      line.end();
     }
-      cerr << "stored paragraph statistics in " << fname << endl;
-    }
-    else {
-      cerr << "storing paragraph statistics in " << fname << " FAILED!" << endl;
-    }
-  }
-  else if ( what == SENT_CSV ){
-    string fname = name + ".sentences.csv";
-    ofstream out( fname.c_str() );
-    if ( out ){
-      for ( size_t par=0; par < sv.size(); ++par ){
-	for ( size_t sent=0; sent < sv[par]->sv.size(); ++sent ){
-	  if ( par == 0 && sent == 0 )
-	    sv[0]->sv[0]->CSVheader( out, "Inputfile,Segment,Getokeniseerde_zin" );
-	  out << name << "," << sv[par]->sv[sent]->id << ",";
-	  sv[par]->sv[sent]->toCSV( out );
+    for ( size_t sent=0; sent < ps->sv.size(); ++sent ){
+      const basicStats *ss = ps->sv[sent];
+      for ( int h=( par == 0 && sent == 0 ); h >= 0; --h ){
+	csvLine line( *files[2], h, groups );
+	line.col( "Inputfile", name );
+	line.col( "Segment", ss->id );
+	ss->CSVcolumns( line );
+	line.end();
+      }
+      for ( size_t word=0; word < ss->sv.size(); ++word ){
+	const basicStats *ws = ss->sv[word];
+	for ( int h=( par == 0 && sent == 0 && word == 0 ); h >= 0; --h ){
+	  csvLine line( *files[3], h, groups );
+	  line.col( "InputFile", name );
+	  ws->CSVcolumns( line );
+	  line.end();
 	}
       }
-      cerr << "stored sentence statistics in " << fname << endl;
+    }
+  }
+}
+
+/**
+ * The name of a CSV file.
+ * @param name the name of the input file
+ * @param level 0 for documents, 1 for paragraphs, 2 for sentences and
+ * 3 for words
+ * @param zip the compression
+ */
+string docStats::csvName( const string& name, int level,
+			  Compress::Type zip ){
+  static const char *exts[] = { ".document.csv", ".paragraphs.csv",
+				".sentences.csv", ".words.csv" };
+  return name + exts[level] + Compress::extension( zip );
+}
+
+/**
+ * Writes the document, paragraph, sentence and word statistics to their
+ * CSV files.
+ * @param name the name of the input file, the files are named after it
+ * @param zip the compression
+ * @param groups the metric groups to write
+ */
+void docStats::toCSV( const string& name, Compress::Type zip,
+		      const Groups::selection& groups ) const {
+  csvFile files[4];
+  tableFile *tables[4];
+  bool ok[4];
+  for ( int i=0; i < 4; ++i ){
+    ok[i] = files[i].open( csvName( name, i, zip ) );
+    tables[i] = &files[i];
+  }
+  fillTables( name, tables, groups );
+  for ( int i=0; i < 4; ++i ){
+    if ( ok[i] && files[i].close() ){
+      TLOG( INFO ) << "stored " << levels[i] << " statistics in "
+		   << files[i].name();
     }
     else {
-      cerr << "storing sentence statistics in " << fname << " FAILED!" << endl;
+      TLOG( ERROR ) << "storing " << levels[i] << " statistics in "
+		    << files[i].name() << " FAILED!";
     }
   }
-  else if ( what == WORD_CSV ){
-    string fname = name + ".words.csv";
-    ofstream out( fname.c_str() );
-    if ( out ){
-      for ( size_t par=0; par < sv.size(); ++par ){
-	for ( size_t sent=0; sent < sv[par]->sv.size(); ++sent ){
-	  for ( size_t word=0; word < sv[par]->sv[sent]->sv.size(); ++word ){
-	    if ( par == 0 && sent == 0 && word == 0 )
-	      sv[0]->sv[0]->sv[0]->CSVheader( out );
-	    out << name << ",";
-	    sv[par]->sv[sent]->sv[word]->toCSV( out );
-	  }
-	}
-      }
-      cerr << "stored word statistics in " << fname << endl;
+}
+
+/**
+ * Makes the document, paragraph, sentence and word tables in memory, as
+ * CSV text.
+ * @param name the name of the input file, in the tables
+ * @param tables receives the four tables
+ * @param groups the metric groups to write
+ */
+void docStats::toCSV( const string& name, string tables[4],
+		      const Groups::selection& groups ) const {
+  csvFile files[4];
+  tableFile *ptrs[4];
+  for ( int i=0; i < 4; ++i ){
+    files[i].collect( tables[i] );
+    ptrs[i] = &files[i];
+  }
+  fillTables( name, ptrs, groups );
+  for ( int i=0; i < 4; ++i ){
+    files[i].close();
+  }
+}
+
+/**
+ * Appends the document, paragraph, sentence and word statistics to the
+ * columnar files, see columns.h.
+ * @param name the name of the input file
+ * @param prefix the start of the names of the files
+ * @param zip the compression
+ * @param groups the metric groups to write
+ * @return false when a file couldn't be written
+ */
+bool docStats::toColumns( const string& name, const string& prefix,
+			  Compress::Type zip,
+			  const Groups::selection& groups ) const {
+  columnFile files[4];
+  tableFile *tables[4];
+  bool ok = true;
+  for ( int i=0; i < 4; ++i ){
+    ok = files[i].open( columnsName( prefix, i, zip ), name ) && ok;
+    tables[i] = &files[i];
+  }
+  fillTables( name, tables, groups );
+  for ( int i=0; i < 4; ++i ){
+    if ( files[i].close() ){
+      TLOG( INFO ) << "appended " << levels[i] << " statistics to "
+		   << files[i].name();
     }
     else {
-      cerr << "storing word statistics in " << fname << " FAILED!" << endl;
+      TLOG( ERROR ) << "appending " << levels[i] << " statistics to "
+		    << files[i].name() << " FAILED!";
+      ok = false;
     }
   }
+  return ok;
+}
+
+/**
+ * The name of a columnar file.
+ * @param prefix the start of the name
+ * @param level 0 for documents, 1 for paragraphs, 2 for sentences and
+ * 3 for words
+ * @param zip the compression
+ */
+string docStats::columnsName( const string& prefix, int level,
+			      Compress::Type zip ){
+  static const char *exts[] = { ".document.tcol", ".paragraphs.tcol",
+				".sentences.tcol", ".words.tcol" };
+  return prefix + exts[level] + Compress::extension( zip );
 }
 
 /**************
@@ -101,121 +233,121 @@ void docStats::addMetrics() const {
   folia::FoliaElement *el = folia_node;
   structStats::addMetrics();
   addOneMetric( el->doc(), el,
-		"sentence_count", TiCC::toString( sentCnt ) );
+		"sentence_count", sentCnt );
   addOneMetric( el->doc(), el,
-		"paragraph_count", TiCC::toString( sv.size() ) );
+		"paragraph_count", sv.size() );
   addOneMetric( el->doc(), el,
-		"word_ttr", TiCC::toString( unique_words.size()/double(wordInclCnt) ) );
+		"word_ttr", unique_words.size()/double(wordInclCnt()) );
   addOneMetric( el->doc(), el,
-		"word_mtld", TiCC::toString( word_mtld ) );
+		"word_mtld", word_mtld );
   addOneMetric( el->doc(), el,
-		"lemma_ttr", TiCC::toString( unique_lemmas.size()/double(wordInclCnt) ) );
+		"lemma_ttr", unique_lemmas.size()/double(wordInclCnt()) );
   addOneMetric( el->doc(), el,
-		"lemma_mtld", TiCC::toString( lemma_mtld ) );
-  if ( nameCnt != 0 ){
+		"lemma_mtld", lemma_mtld );
+  if ( nameCnt() != 0 ){
     addOneMetric( el->doc(), el,
-		  "names_ttr", TiCC::toString( unique_names.size()/double(nameInclCnt) ) );
+		  "names_ttr", unique_names.size()/double(nameInclCnt()) );
   }
   addOneMetric( el->doc(), el,
-		"name_mtld", TiCC::toString( name_mtld ) );
+		"name_mtld", name_mtld );
 
-  if ( contentInclCnt != 0 ){
+  if ( contentInclCnt() != 0 ){
     addOneMetric( el->doc(), el,
-		  "content_word_ttr", TiCC::toString( unique_contents.size()/double(contentInclCnt) ) );
+		  "content_word_ttr", unique_contents.size()/double(contentInclCnt()) );
   }
-  if ( contentStrictInclCnt != 0 ){
+  if ( contentStrictInclCnt() != 0 ){
     addOneMetric( el->doc(), el,
-      "content_word_ttr_strict", TiCC::toString( unique_contents_strict.size()/double(contentStrictInclCnt) ) );
+      "content_word_ttr_strict", unique_contents_strict.size()/double(contentStrictInclCnt()) );
   }
 
   addOneMetric( el->doc(), el,
-		"content_mtld", TiCC::toString( content_mtld ) );
+		"content_mtld", content_mtld );
   addOneMetric( el->doc(), el,
-    "content_mtld_strict", TiCC::toString( content_mtld_strict ) );
+    "content_mtld_strict", content_mtld_strict );
 
-  if ( timeSitCnt != 0 ){
+  if ( timeSitCnt() != 0 ){
     addOneMetric( el->doc(), el,
-		  "time_sit_ttr", TiCC::toString( unique_tijd_sits.size()/double(timeSitCnt) ) );
+		  "time_sit_ttr", unique_tijd_sits.size()/double(timeSitCnt()) );
   }
   addOneMetric( el->doc(), el,
-		"tijd_sit_mtld", TiCC::toString( tijd_sit_mtld ) );
+		"tijd_sit_mtld", tijd_sit_mtld );
 
-  if ( spaceSitCnt != 0 ){
+  if ( spaceSitCnt() != 0 ){
     addOneMetric( el->doc(), el,
-		  "space_sit_ttr", TiCC::toString( unique_ruimte_sits.size()/double(spaceSitCnt) ) );
+		  "space_sit_ttr", unique_ruimte_sits.size()/double(spaceSitCnt()) );
   }
   addOneMetric( el->doc(), el,
-		"ruimte_sit_mtld", TiCC::toString( ruimte_sit_mtld ) );
+		"ruimte_sit_mtld", ruimte_sit_mtld );
 
-  if ( causeSitCnt != 0 ){
+  if ( causeSitCnt() != 0 ){
     addOneMetric( el->doc(), el,
-		  "cause_sit_ttr", TiCC::toString( unique_cause_sits.size()/double(causeSitCnt) ) );
+		  "cause_sit_ttr", unique_cause_sits.size()/double(causeSitCnt()) );
   }
   addOneMetric( el->doc(), el,
-		"cause_sit_mtld", TiCC::toString( cause_sit_mtld ) );
+		"cause_sit_mtld", cause_sit_mtld );
 
-  if ( emoSitCnt != 0 ){
+  if ( emoSitCnt() != 0 ){
     addOneMetric( el->doc(), el,
-		  "emotion_sit_ttr", TiCC::toString( unique_emotion_sits.size()/double(emoSitCnt) ) );
+		  "emotion_sit_ttr", unique_emotion_sits.size()/double(emoSitCnt()) );
   }
   addOneMetric( el->doc(), el,
-		"emotion_sit_mtld", TiCC::toString( emotion_sit_mtld ) );
+		"emotion_sit_mtld", emotion_sit_mtld );
 
-  if ( allConnCnt != 0 ){
+  if ( allConnCnt() != 0 ){
     addOneMetric( el->doc(), el,
-      "all_conn_ttr", TiCC::toString( unique_all_conn.size()/double(allConnCnt) ) );
+      "all_conn_ttr", unique_all_conn.size()/double(allConnCnt()) );
   }
   addOneMetric( el->doc(), el,
-    "all_conn_mtld", TiCC::toString(all_conn_mtld) );
+    "all_conn_mtld", all_conn_mtld );
 
-  if ( tempConnCnt != 0 ){
+  if ( tempConnCnt() != 0 ){
     addOneMetric( el->doc(), el,
-		  "temp_conn_ttr", TiCC::toString( unique_temp_conn.size()/double(tempConnCnt) ) );
+		  "temp_conn_ttr", unique_temp_conn.size()/double(tempConnCnt()) );
   }
   addOneMetric( el->doc(), el,
-		"temp_conn_mtld", TiCC::toString(temp_conn_mtld) );
+		"temp_conn_mtld", temp_conn_mtld );
 
-  if ( opsomWgConnCnt != 0 ){
+  if ( opsomWgConnCnt() != 0 ){
     addOneMetric( el->doc(), el,
-		  "opsom_wg_conn_ttr", TiCC::toString( unique_reeks_wg_conn.size()/double(opsomWgConnCnt) ) );
+		  "opsom_wg_conn_ttr", unique_reeks_wg_conn.size()/double(opsomWgConnCnt()) );
   }
   addOneMetric( el->doc(), el,
-		"opsom_wg_conn_mtld", TiCC::toString(reeks_wg_conn_mtld) );
+		"opsom_wg_conn_mtld", reeks_wg_conn_mtld );
 
-  if ( opsomZinConnCnt != 0 ){
+  if ( opsomZinConnCnt() != 0 ){
     addOneMetric( el->doc(), el,
-      "opsom_zin_conn_ttr", TiCC::toString( unique_reeks_zin_conn.size()/double(opsomZinConnCnt) ) );
+      "opsom_zin_conn_ttr", unique_reeks_zin_conn.size()/double(opsomZinConnCnt()) );
   }
   addOneMetric( el->doc(), el,
-    "opsom_zin_conn_mtld", TiCC::toString(reeks_zin_conn_mtld) );
+    "opsom_zin_conn_mtld", reeks_zin_conn_mtld );
 
-  if ( contrastConnCnt != 0 ){
+  if ( contrastConnCnt() != 0 ){
     addOneMetric( el->doc(), el,
-		  "contrast_conn_ttr", TiCC::toString( unique_contr_conn.size()/double(contrastConnCnt) ) );
+		  "contrast_conn_ttr", unique_contr_conn.size()/double(contrastConnCnt()) );
   }
   addOneMetric( el->doc(), el,
-		"contrast_conn_mtld", TiCC::toString(contr_conn_mtld) );
+		"contrast_conn_mtld", contr_conn_mtld );
 
-  if ( compConnCnt != 0 ){
+  if ( compConnCnt() != 0 ){
     addOneMetric( el->doc(), el,
-		  "comp_conn_ttr", TiCC::toString( unique_comp_conn.size()/double(compConnCnt) ) );
+		  "comp_conn_ttr", unique_comp_conn.size()/double(compConnCnt()) );
   }
   addOneMetric( el->doc(), el,
-		"comp_conn_mtld", TiCC::toString(comp_conn_mtld) );
+		"comp_conn_mtld", comp_conn_mtld );
 
 
-  if ( causeConnCnt != 0 ){
+  if ( causeConnCnt() != 0 ){
     addOneMetric( el->doc(), el,
-		  "cause_conn_ttr", TiCC::toString( unique_cause_conn.size()/double(causeConnCnt) ) );
+		  "cause_conn_ttr", unique_cause_conn.size()/double(causeConnCnt()) );
   }
   addOneMetric( el->doc(), el,
-		"cause_conn_mtld", TiCC::toString( cause_conn_mtld ) );
+		"cause_conn_mtld", cause_conn_mtld );
 
 
   addOneMetric( el->doc(), el,
-		"rar_index", TiCC::toString( rarity_index ) );
+		"rar_index", rarity_index );
   addOneMetric( el->doc(), el,
-		"document_word_argument_overlap_count", TiCC::toString( doc_word_overlapCnt ) );
+		"document_word_argument_overlap_count", doc_word_overlapCnt );
   addOneMetric( el->doc(), el,
-		"document_lemma_argument_overlap_count", TiCC::toString( doc_lemma_overlapCnt ) );
+		"document_lemma_argument_overlap_count", doc_lemma_overlapCnt );
 }
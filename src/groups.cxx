@@ -0,0 +1,109 @@
+#include <vector>
+#include "ticcutils/StringOps.h"
+#include "tscan/groups.h"
+
+using namespace std;
+
+namespace Groups {
+
+  static const char *names[N_GROUPS] = {
+    "topPredictors", "wordDifficulties", "compound", "sentDifficulties",
+    "informationDensity", "coherence", "concreet", "persoonlijkheid",
+    "verb", "imperative", "wordSort", "prepPhrase", "intens", "formal",
+    "misc" };
+
+  // What each group needs besides Frog, Alpino and the lexicons. Alpino
+  // is needed by all of them: besides the clause based measures, the
+  // parse gives the full lemma of separable verbs and tells the head
+  // verbs, which are content words, apart. A compound that isn't in the
+  // noun lexicon gets its semantic type and its corrected frequency from
+  // the head that the compound splitter finds. The semantic types of
+  // names, adjectives and verbs, the intensifiers, the formal and the
+  // general words are only counted for the groups that show them, as is
+  // the argument overlap of the whole document.
+  static const int dependencies[N_GROUPS] = {
+    COMPOUND_SPLITTER | SEM_TYPES | GENERAL_WORDS, // topPredictors
+    COMPOUND_SPLITTER,          // wordDifficulties: Wrd_freq_log_corr
+    COMPOUND_SPLITTER,          // compound
+    0,                          // sentDifficulties
+    DOC_OVERLAP,                // informationDensity: Arg_over_buf
+    0,                          // coherence
+    COMPOUND_SPLITTER | SEM_TYPES | GENERAL_WORDS, // concreet
+    COMPOUND_SPLITTER | SEM_TYPES, // persoonlijkheid: Pers_ref
+    SEM_TYPES,                  // verb: Actieww, Toestww, Procesww
+    0,                          // imperative
+    0,                          // wordSort
+    0,                          // prepPhrase
+    INTENSIFIERS,               // intens
+    FORMAL_WORDS,               // formal
+    WOPR | COMPOUND_SPLITTER | SEM_TYPES | INTENSIFIERS | FORMAL_WORDS
+    | GENERAL_WORDS             // misc: probabilities, formulas, the words
+  };
+
+  string toString( Group g ){
+    return names[g];
+  }
+
+  selection::selection(){
+    for ( int i=0; i < N_GROUPS; ++i ){
+      groups[i] = true;
+    }
+  }
+
+  /**
+   * Parses a selection.
+   * @param s the names of the groups, separated by commas, or 'all'
+   * @param error receives the reason of a failure
+   * @return false for an unknown group
+   */
+  bool selection::parse( const string& s, string& error ){
+    bool result[N_GROUPS] = { false };
+    vector<string> parts;
+    TiCC::split_at( s, parts, "," );
+    for ( const auto& p : parts ){
+      string name = TiCC::trim( p );
+      if ( name == "all" ){
+	for ( int i=0; i < N_GROUPS; ++i ){
+	  result[i] = true;
+	}
+	continue;
+      }
+      int i = 0;
+      while ( i < N_GROUPS && name != names[i] ){
+	++i;
+      }
+      if ( i == N_GROUPS ){
+	error = "unknown metric group '" + name + "'";
+	return false;
+      }
+      result[i] = true;
+    }
+    for ( int i=0; i < N_GROUPS; ++i ){
+      groups[i] = result[i];
+    }
+    return true;
+  }
+
+  bool selection::needs( Analysis a ) const {
+    for ( int i=0; i < N_GROUPS; ++i ){
+      if ( groups[i] && ( dependencies[i] & a ) ){
+	return true;
+      }
+    }
+    return false;
+  }
+
+  string selection::toString() const {
+    string result;
+    for ( int i=0; i < N_GROUPS; ++i ){
+      if ( groups[i] ){
+	if ( !result.empty() ){
+	  result += ",";
+	}
+	result += names[i];
+      }
+    }
+    return result;
+  }
+
+}
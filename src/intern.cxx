@@ -0,0 +1,49 @@
+#include "tscan/intern.h"
+
+using namespace std;
+
+namespace Intern {
+
+  /*
+   * The pool keeps the strings as keys of an unordered_map (whose nodes
+   * never move) and a vector of pointers to those keys for the reverse
+   * lookup. There is one pool per thread that analyses a document, so
+   * the documents of the server's workers don't share ids. Within a
+   * document it is only used outside of the parallel sections.
+   */
+  static thread_local unordered_map<string,Id> ids;
+  static thread_local vector<const string*> strings;
+
+  Id intern( const string& s ){
+    if ( strings.empty() ){
+      clear();
+    }
+    unordered_map<string,Id>::const_iterator it = ids.find( s );
+    if ( it != ids.end() ){
+      return it->second;
+    }
+    Id id = strings.size();
+    it = ids.insert( make_pair( s, id ) ).first;
+    strings.push_back( &it->first );
+    return id;
+  }
+
+  const string& toString( Id id ){
+    if ( strings.empty() ){
+      clear();
+    }
+    return *strings.at( id );
+  }
+
+  size_t size(){
+    return strings.size();
+  }
+
+  void clear(){
+    ids.clear();
+    strings.clear();
+    unordered_map<string,Id>::const_iterator it = ids.insert( make_pair( string(), EMPTY ) ).first;
+    strings.push_back( &it->first );
+  }
+
+}
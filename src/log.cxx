@@ -0,0 +1,118 @@
+#include <cstdio>
+#include <mutex>
+#include <set>
+#include "tscan/log.h"
+
+using namespace std;
+
+namespace Log {
+
+  Level level = INFO;
+
+  static const char *names[] = { "error", "warning", "info", "debug", "trace" };
+
+  // the buffer of a thread is written when it grows beyond this
+  static const size_t BUFFER_SIZE = 16384;
+
+  enum Sink { RUN, PROBLEMS, N_SINKS };
+
+  static FILE *sinks[N_SINKS] = { stderr, 0 };
+  static mutex writeLock;
+
+  static void write( Sink s, const string& text ){
+    if ( text.empty() || !sinks[s] ){
+      return;
+    }
+    lock_guard<mutex> guard( writeLock );
+    fwrite( text.data(), 1, text.size(), sinks[s] );
+    fflush( sinks[s] );
+  }
+
+  // The lines of one thread that aren't written yet. Log::flush() may
+  // write them from another thread, hence the lock.
+  struct buffer {
+    mutex lock;
+    string text[N_SINKS];
+    void add( Sink s, const string& line, bool now ){
+      lock_guard<mutex> guard( lock );
+      text[s] += line;
+      text[s] += '\n';
+      if ( now || text[s].size() >= BUFFER_SIZE ){
+	write( s, text[s] );
+	text[s].clear();
+      }
+    }
+    void flush(){
+      lock_guard<mutex> guard( lock );
+      for ( int i=0; i < N_SINKS; ++i ){
+	write( Sink( i ), text[i] );
+	text[i].clear();
+      }
+    }
+  };
+
+  static mutex registryLock;
+  static set<buffer*> registry;
+
+  // writes the buffers of the threads that are still running at exit
+  static struct flushAtExit {
+    ~flushAtExit(){ flush(); };
+  } atExit;
+
+  // the buffer of this thread, written when the thread ends
+  struct threadBuffer {
+    buffer *buf;
+    threadBuffer(): buf( new buffer ){
+      lock_guard<mutex> guard( registryLock );
+      registry.insert( buf );
+    }
+    ~threadBuffer(){
+      {
+	lock_guard<mutex> guard( registryLock );
+	registry.erase( buf );
+      }
+      buf->flush();
+      delete buf;
+    }
+  };
+
+  static buffer& ownBuffer(){
+    static thread_local threadBuffer own;
+    return *own.buf;
+  }
+
+  bool parse( const string& s, Level& l ){
+    for ( int i=ERROR; i <= TRACE; ++i ){
+      if ( s == names[i] ){
+	l = Level( i );
+	return true;
+      }
+    }
+    return false;
+  }
+
+  line::~line(){
+    ownBuffer().add( RUN, os.str(), lvl <= WARNING );
+  }
+
+  bool openProblems( const string& name, const string& header ){
+    sinks[PROBLEMS] = fopen( name.c_str(), "w" );
+    if ( !sinks[PROBLEMS] ){
+      return false;
+    }
+    write( PROBLEMS, header + '\n' );
+    return true;
+  }
+
+  void problem( const string& line ){
+    ownBuffer().add( PROBLEMS, line, false );
+  }
+
+  void flush(){
+    lock_guard<mutex> guard( registryLock );
+    for ( auto b : registry ){
+      b->flush();
+    }
+  }
+
+}
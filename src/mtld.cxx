@@ -0,0 +1,93 @@
+#include <algorithm>
+#include <iostream>
+#include "tscan/mtld.h"
+
+using namespace std;
+
+//#define DEBUG_MTLD
+
+void mtldEngine::next_epoch() {
+  if ( ++epoch == 0 ) {
+    // wrapped around: old stamps might match again
+    fill( seen.begin(), seen.end(), 0 );
+    epoch = 1;
+  }
+}
+
+double mtldEngine::calculate( const vector<Intern::Id> &v, bool backward,
+                              double threshold ) {
+  if ( v.size() == 0 ) {
+    return 0.0;
+  }
+  if ( seen.size() < Intern::size() ) {
+    seen.resize( Intern::size(), 0 );
+  }
+  next_epoch();
+  int token_count = 0;
+  int unique_count = 0;
+  double token_factor = 0.0;
+  for ( size_t i = 0; i < v.size(); ++i ) {
+    Intern::Id token = backward ? v[v.size() - 1 - i] : v[i];
+    ++token_count;
+    if ( seen[token] != epoch ) {
+      seen[token] = epoch;
+      ++unique_count;
+    }
+    double token_ttr = unique_count / double( token_count );
+#ifdef DEBUG_MTLD
+    cerr << Intern::toString( token ) << "\t [" << unique_count << "/"
+         << token_count << "] >> ttr " << token_ttr << endl;
+#endif
+    if ( token_ttr <= threshold ) {
+#ifdef KOIZUMI
+      if ( token_count >= 10 ) {
+        token_factor += 1.0;
+      }
+#else
+      token_factor += 1.0;
+#endif
+      token_count = 0;
+      unique_count = 0;
+      next_epoch();
+#ifdef DEBUG_MTLD
+      cerr << "\treset: token_factor = " << token_factor << endl
+           << endl;
+#endif
+    }
+    else if ( i == v.size() - 1 ) {
+#ifdef DEBUG_MTLD
+      cerr << "\trestje: huidige token_ttr= " << token_ttr;
+#endif
+      // partial result
+      double partial = ( 1 - token_ttr ) / ( 1 - threshold );
+#ifdef DEBUG_MTLD
+      cerr << " dus verhoog de factor met " << ( 1 - token_ttr )
+           << "/" << ( 1 - threshold ) << endl;
+#endif
+      token_factor += partial;
+    }
+  }
+  if ( token_factor == 0.0 )
+    token_factor = 1.0;
+#ifdef DEBUG_MTLD
+  cerr << "Factor = " << token_factor << " #words = " << v.size() << endl;
+#endif
+  return v.size() / token_factor;
+}
+
+double mtldEngine::average( const vector<Intern::Id> &tokens,
+                            double threshold ) {
+  double mtld1 = calculate( tokens, false, threshold );
+#ifdef DEBUG_MTLD
+  cerr << "VOORUIT = " << mtld1 << endl;
+#endif
+  double mtld2 = calculate( tokens, true, threshold );
+#ifdef DEBUG_MTLD
+  cerr << "ACHTERUIT = " << mtld2 << endl;
+#endif
+  double result = ( mtld1 + mtld2 ) / 2.0;
+#ifdef DEBUG_MTLD
+  cerr << "average mtld = " << result << endl;
+#endif
+  return result;
+}
@@ -1,3 +1,4 @@
+#include <unordered_map>
 #include "tscan/ner.h"
 
 using namespace std;
@@ -5,34 +6,69 @@ using namespace std;
 namespace NER {
   const string frog_ner_set = "http://ilk.uvt.nl/folia/sets/frog-ner-nl";
 
-  Type lookupNer(const folia::Word *w, const folia::Sentence *s) {
-    Type result = NONER;
+  static Type toType(const string& cls, bool first) {
+    if ( cls == "org" ) {
+      return first ? ORG_B : ORG_I;
+    }
+    else if ( cls == "eve" ) {
+      return first ? EVE_B : EVE_I;
+    }
+    else if ( cls == "loc" ) {
+      return first ? LOC_B : LOC_I;
+    }
+    else if ( cls == "misc" ) {
+      return first ? MISC_B : MISC_I;
+    }
+    else if ( cls == "per" ) {
+      return first ? PER_B : PER_I;
+    }
+    else if ( cls == "pro" ) {
+      return first ? PRO_B : PRO_I;
+    }
+    else {
+      return NONER;
+    }
+  }
+
+  /**
+   * Returns the NER::Type of a word. As before the index, the error on an
+   * unknown entity class only concerns the words that are looked up.
+   * @param i the position of the word in the sentence
+   */
+  Type sentenceNers::operator[]( size_t i ) const {
+    if ( !unknown[i].empty() ) {
+      throw folia::ValueError( "unknown NER class: " + unknown[i] );
+    }
+    return types[i];
+  }
+
+  /**
+   * Decodes the entity layer of a sentence once. The result holds the
+   * NER::Type of every word in w, by position; words outside any entity
+   * stay NONER. When a word occurs in several entities, the last one wins.
+   * @param w the words of the sentence, as returned by s->words()
+   * @param s the sentence
+   */
+  sentenceNers lookupNers(const vector<folia::Word*>& w, const folia::Sentence *s) {
+    sentenceNers result( w.size() );
     vector<folia::Entity*> v = s->select<folia::Entity>(frog_ner_set);
+    if ( v.empty() ) {
+      return result;
+    }
+    unordered_map<const folia::FoliaElement*,size_t> positions;
+    for ( size_t i=0; i < w.size(); ++i ) {
+      positions[w[i]] = i;
+    }
     for ( size_t i=0; i < v.size(); ++i ) {
       folia::FoliaElement *e = v[i];
+      string cls = e->cls();
       for ( size_t j=0; j < e->size(); ++j ) {
-        if ( e->index(j) == w ){
-          string cls = v[i]->cls();
-          if ( cls == "org" ) {
-            result = j == 0 ? ORG_B : ORG_I;
-          }
-          else if ( cls == "eve" ) {
-            result = j == 0 ? EVE_B : EVE_I;
-          }
-          else if ( cls == "loc" ) {
-            result = j == 0 ? LOC_B : LOC_I;
-          }
-          else if ( cls == "misc" ) {
-            result = j == 0 ? MISC_B : MISC_I;
-          }
-          else if ( cls == "per" ) {
-            result = j == 0 ? PER_B : PER_I;
-          }
-          else if ( cls == "pro" ) {
-            result = j == 0 ? PRO_B : PRO_I;
-          }
-          else {
-            throw folia::ValueError( "unknown NER class: " + cls );
+        unordered_map<const folia::FoliaElement*,size_t>::const_iterator it = positions.find( e->index(j) );
+        if ( it != positions.end() ) {
+          Type type = toType( cls, j == 0 );
+          result.types[it->second] = type;
+          if ( type == NONER && result.unknown[it->second].empty() ) {
+            result.unknown[it->second] = cls;
           }
         }
       }
@@ -0,0 +1,339 @@
+#include <cmath>
+#include <cstring>
+#include <algorithm>
+#include <fstream>
+#include <iostream>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include "tscan/ngram.h"
+
+using namespace std;
+
+namespace NGram {
+
+  const char MAGIC[8] = { 'T', 'S', 'C', 'A', 'N', 'L', 'M', '1' };
+  const string BOS = "<s>";
+
+  /**
+   * FNV-1a over the words [from, to), with a separator between words.
+   */
+  uint64_t hash( const vector<string>& words, size_t from, size_t to ){
+    uint64_t h = 14695981039346656037ULL;
+    for ( size_t i = from; i < to; ++i ){
+      const string& w = words[i];
+      for ( size_t j = 0; j < w.size(); ++j ){
+	h ^= static_cast<unsigned char>( w[j] );
+	h *= 1099511628211ULL;
+      }
+      h ^= 0x1f;
+      h *= 1099511628211ULL;
+    }
+    return h;
+  }
+
+  /**
+   * Computes the sentence metrics from the word probabilities.
+   * @param lprob10 the log10 probability of each word
+   * @param avg_prob10 receives their mean
+   * @param entropy receives the mean -log2 probability, in bits per word
+   * @param perplexity receives 2 to the power of the entropy
+   */
+  void summarize( const vector<double>& lprob10, double& avg_prob10,
+		  double& entropy, double& perplexity ){
+    avg_prob10 = entropy = perplexity = NAN;
+    if ( lprob10.empty() ){
+      return;
+    }
+    double sum = 0;
+    for ( size_t i = 0; i < lprob10.size(); ++i ){
+      sum += lprob10[i];
+    }
+    avg_prob10 = sum / lprob10.size();
+    entropy = -avg_prob10 * log2( 10.0 );
+    perplexity = pow( 2.0, entropy );
+  }
+
+  static bool keyLess( const entry& e, uint64_t key ){
+    return e.key < key;
+  }
+
+  /*******
+   * MODEL
+   *******/
+
+  model::model(): base( 0 ), length( 0 ), head( 0 ){
+    fill( tables, tables + MAX_ORDER, static_cast<const entry*>( 0 ) );
+  }
+
+  model::~model(){
+    close();
+  }
+
+  /**
+   * Maps a count file into memory.
+   * @param file the file made by tscan-lm-build
+   * @return false, with a message on cerr, when the file is not usable
+   */
+  bool model::open( const string& file ){
+    close();
+    int fd = ::open( file.c_str(), O_RDONLY );
+    if ( fd < 0 ){
+      cerr << "unable to open language model '" << file << "'" << endl;
+      return false;
+    }
+    struct stat sbuf;
+    if ( fstat( fd, &sbuf ) != 0
+	 || static_cast<size_t>( sbuf.st_size ) < sizeof( header ) ){
+      cerr << "language model '" << file << "' is too small" << endl;
+      ::close( fd );
+      return false;
+    }
+    length = sbuf.st_size;
+    void *p = mmap( 0, length, PROT_READ, MAP_SHARED, fd, 0 );
+    ::close( fd );
+    if ( p == MAP_FAILED ){
+      cerr << "unable to map language model '" << file << "'" << endl;
+      length = 0;
+      return false;
+    }
+    base = p;
+    head = static_cast<const header*>( base );
+    size_t expected = sizeof( header );
+    if ( memcmp( head->magic, MAGIC, sizeof( MAGIC ) ) == 0
+	 && head->order > 0 && head->order <= MAX_ORDER ){
+      const entry *e = reinterpret_cast<const entry*>( head + 1 );
+      for ( size_t k = 0; k < head->order; ++k ){
+	tables[k] = e;
+	e += head->sizes[k];
+	expected += head->sizes[k] * sizeof( entry );
+      }
+    }
+    else {
+      expected = 0;
+    }
+    if ( expected != length ){
+      cerr << "language model '" << file << "' is not a valid count file"
+	   << endl;
+      close();
+      return false;
+    }
+    return true;
+  }
+
+  void model::close(){
+    if ( base ){
+      munmap( base, length );
+    }
+    base = 0;
+    length = 0;
+    head = 0;
+    fill( tables, tables + MAX_ORDER, static_cast<const entry*>( 0 ) );
+  }
+
+  size_t model::order() const {
+    return head ? head->order : 0;
+  }
+
+  bool model::reversed() const {
+    return head && head->reversed;
+  }
+
+  const entry *model::find( size_t k, uint64_t key ) const {
+    const entry *first = tables[k-1];
+    const entry *last = first + head->sizes[k-1];
+    const entry *it = lower_bound( first, last, key, keyLess );
+    if ( it != last && it->key == key ){
+      return it;
+    }
+    return 0;
+  }
+
+  /**
+   * The interpolated Kneser-Ney probability of t[i] given the words
+   * before it, built up from the unigram to the longest known context.
+   * Unknown words get a share of the unigram discount mass.
+   */
+  double model::prob( const vector<string>& t, size_t i ) const {
+    double p = 1.0 / ( head->vocab + 1 );
+    size_t n = head->order;
+    size_t max_k = min( n, i + 1 );
+    for ( size_t k = 1; k <= max_k; ++k ){
+      double denom;
+      double followers;
+      if ( k == 1 ){
+	denom = head->unigram_denom;
+	followers = head->vocab;
+      }
+      else {
+	const entry *h = find( k - 1, hash( t, i - k + 1, i ) );
+	if ( !h || h->ctx == 0 ){
+	  // no longer context was seen either
+	  break;
+	}
+	denom = h->ctx;
+	followers = h->followers;
+      }
+      if ( denom == 0 ){
+	break;
+      }
+      const entry *g = find( k, hash( t, i - k + 1, i + 1 ) );
+      double num = 0;
+      if ( g ){
+	num = ( k == n ) ? g->count : g->cont;
+      }
+      double d = head->discount[k-1];
+      p = max( num - d, 0.0 ) / denom + d * followers / denom * p;
+    }
+    return p;
+  }
+
+  /**
+   * Scores a tokenized sentence.
+   * @param words the words, in text order
+   * @param lprob10 receives the log10 probability of each word, in text
+   * order, also for a reversed model
+   */
+  void model::score( const vector<string>& words,
+		     vector<double>& lprob10 ) const {
+    lprob10.assign( words.size(), NAN );
+    if ( !head ){
+      return;
+    }
+    vector<string> t;
+    t.reserve( words.size() + 1 );
+    t.push_back( BOS );
+    if ( head->reversed ){
+      t.insert( t.end(), words.rbegin(), words.rend() );
+    }
+    else {
+      t.insert( t.end(), words.begin(), words.end() );
+    }
+    for ( size_t i = 1; i < t.size(); ++i ){
+      double lp = log10( prob( t, i ) );
+      if ( head->reversed ){
+	lprob10[words.size() - i] = lp;
+      }
+      else {
+	lprob10[i - 1] = lp;
+      }
+    }
+  }
+
+  /*********
+   * BUILDER
+   *********/
+
+  builder::builder( size_t order, bool reversed ):
+    n( order ), reverse( reversed ), grams( order ){
+    if ( n == 0 || n > MAX_ORDER ){
+      throw invalid_argument( "NGram::builder: order must be between 1 and "
+			      + to_string( MAX_ORDER ) );
+    }
+  }
+
+  /**
+   * Counts all n-grams of one sentence, up to the order of the model.
+   */
+  void builder::add( const vector<string>& words ){
+    if ( words.empty() ){
+      return;
+    }
+    vector<string> t;
+    t.reserve( words.size() + 1 );
+    t.push_back( BOS );
+    if ( reverse ){
+      t.insert( t.end(), words.rbegin(), words.rend() );
+    }
+    else {
+      t.insert( t.end(), words.begin(), words.end() );
+    }
+    // <s> is only counted as a context, never as a word
+    for ( size_t i = 1; i < t.size(); ++i ){
+      for ( size_t k = 1; k <= n && k <= i + 1; ++k ){
+	stats& g = grams[k-1][hash( t, i - k + 1, i + 1 )];
+	if ( i + 1 == k && k < n ){
+	  // nothing can precede <s>, so these use their plain counts
+	  ++g.cont;
+	}
+	if ( g.count++ == 0 && k > 1 ){
+	  // a new n-gram: one more distinct successor of its prefix, and
+	  // one more distinct predecessor of its suffix
+	  g.prefix = hash( t, i - k + 1, i );
+	  ++grams[k-2][g.prefix].followers;
+	  ++grams[k-2][hash( t, i - k + 2, i + 1 )].cont;
+	}
+      }
+    }
+  }
+
+  /**
+   * Writes the count file.
+   * @param file the file to write
+   * @return false, with a message on cerr, when writing failed
+   */
+  bool builder::save( const string& file ) const {
+    vector<vector<entry> > tabs( n );
+    vector<unordered_map<uint64_t,stats> > g = grams;
+    for ( size_t k = n; k > 1; --k ){
+      for ( const auto& it : g[k-1] ){
+	uint32_t num = ( k == n ) ? it.second.count : it.second.cont;
+	g[k-2][it.second.prefix].ctx += num;
+      }
+    }
+    header h;
+    memset( &h, 0, sizeof( h ) );
+    memcpy( h.magic, MAGIC, sizeof( MAGIC ) );
+    h.order = n;
+    h.reversed = reverse;
+    for ( size_t k = 1; k <= n; ++k ){
+      size_t n1 = 0;
+      size_t n2 = 0;
+      vector<entry>& tab = tabs[k-1];
+      tab.reserve( g[k-1].size() );
+      for ( const auto& it : g[k-1] ){
+	entry e;
+	e.key = it.first;
+	e.count = it.second.count;
+	e.cont = it.second.cont;
+	e.followers = it.second.followers;
+	e.ctx = it.second.ctx;
+	tab.push_back( e );
+	uint32_t num = ( k == n ) ? e.count : e.cont;
+	if ( num == 1 )
+	  ++n1;
+	else if ( num == 2 )
+	  ++n2;
+	if ( k == 1 && num > 0 ){
+	  h.unigram_denom += num;
+	  ++h.vocab;
+	}
+      }
+      sort( tab.begin(), tab.end(),
+	    []( const entry& a, const entry& b ){ return a.key < b.key; } );
+      h.sizes[k-1] = tab.size();
+      double d = 0.75;
+      if ( n1 > 0 && n2 > 0 ){
+	d = min( max( double( n1 ) / ( n1 + 2.0 * n2 ), 0.1 ), 0.9 );
+      }
+      h.discount[k-1] = d;
+    }
+    ofstream os( file, ios::binary );
+    if ( !os ){
+      cerr << "unable to open '" << file << "' for writing" << endl;
+      return false;
+    }
+    os.write( reinterpret_cast<const char*>( &h ), sizeof( h ) );
+    for ( size_t k = 0; k < n; ++k ){
+      os.write( reinterpret_cast<const char*>( tabs[k].data() ),
+		tabs[k].size() * sizeof( entry ) );
+    }
+    if ( !os ){
+      cerr << "writing '" << file << "' failed" << endl;
+      return false;
+    }
+    return true;
+  }
+
+}
@@ -10,5 +10,5 @@ void parStats::addMetrics() const {
   folia::FoliaElement *el = folia_node;
   structStats::addMetrics();
   addOneMetric( el->doc(), el,
-		"sentence_count", TiCC::toString(sentCnt) );
+		"sentence_count", sentCnt );
 }
@@ -0,0 +1,197 @@
+#include <cstdio>
+#include <iostream>
+#include <fstream>
+#include <mutex>
+#include "tscan/profile.h"
+
+using namespace std;
+
+namespace Profile {
+
+  static const char *stageNames[N_STAGES] = {
+    "frog", "alpino", "wopr_fwd", "wopr_bwd", "compound_splitter",
+    "lemmatize", "words", "overlap", "mtld", "metrics", "save_folia",
+    "save_csv", "save_columns" };
+
+  static thread_local report *currentReport = 0;
+
+  static ofstream reportFile;
+  static bool toStderr = false;
+  static mutex writeLock;
+
+  report::report( const string& name ):
+    file( name ), start( chrono::steady_clock::now() ){
+    for ( int i=0; i < N_STAGES; ++i ){
+      nanos[i] = 0;
+      calls[i] = 0;
+      for ( int j=0; j < N_BUCKETS; ++j ){
+	buckets[i][j] = 0;
+      }
+    }
+    for ( int i=0; i < N_COUNTERS; ++i ){
+      counters[i] = 0;
+    }
+  }
+
+  /**
+   * Adds a call of a stage.
+   * @param s the stage
+   * @param d how long the call took
+   */
+  void report::add( Stage s, chrono::steady_clock::duration d ){
+    long long ns = chrono::duration_cast<chrono::nanoseconds>( d ).count();
+    nanos[s] += ns;
+    ++calls[s];
+    long long ms = ns / 1000000;
+    int b = 0;
+    while ( ms > 0 && b < N_BUCKETS - 1 ){
+      ms >>= 1;
+      ++b;
+    }
+    ++buckets[s][b];
+  }
+
+  static string jsonString( const string& s ){
+    string result = "\"";
+    for ( const auto& c : s ){
+      if ( c == '"' || c == '\\' ){
+	result += '\\';
+	result += c;
+      }
+      else if ( (unsigned char)c < 0x20 ){
+	char tmp[8];
+	snprintf( tmp, sizeof( tmp ), "\\u%04x", c );
+	result += tmp;
+      }
+      else {
+	result += c;
+      }
+    }
+    return result + "\"";
+  }
+
+  static string jsonNumber( double d ){
+    char tmp[32];
+    snprintf( tmp, sizeof( tmp ), "%.6g", d );
+    return tmp;
+  }
+
+  static string hitRate( const char *name, long long hits, long long misses ){
+    string result = jsonString( name ) + ":{\"hits\":" + to_string( hits )
+      + ",\"misses\":" + to_string( misses );
+    if ( hits + misses > 0 ){
+      result += ",\"hit_rate\":" + jsonNumber( double( hits ) / ( hits + misses ) );
+    }
+    return result + "}";
+  }
+
+  /**
+   * The report as one line of JSON. Only the stages that were entered
+   * are listed. The words are the calls of the 'words' stage.
+   */
+  string report::toJSON() const {
+    double seconds = chrono::duration<double>( chrono::steady_clock::now()
+					       - start ).count();
+    long long words = calls[WORDS];
+    string result = "{\"file\":" + jsonString( file )
+      + ",\"seconds\":" + jsonNumber( seconds )
+      + ",\"words\":" + to_string( words )
+      + ",\"words_per_second\":"
+      + jsonNumber( seconds > 0 ? words / seconds : 0 )
+      + ",\"stages\":{";
+    bool first = true;
+    for ( int i=0; i < N_STAGES; ++i ){
+      if ( calls[i] == 0 ){
+	continue;
+      }
+      if ( !first ){
+	result += ",";
+      }
+      first = false;
+      result += jsonString( stageNames[i] ) + ":{\"calls\":"
+	+ to_string( calls[i] ) + ",\"seconds\":"
+	+ jsonNumber( nanos[i] / 1e9 ) + ",\"latency_ms\":{";
+      bool firstBucket = true;
+      for ( int j=0; j < N_BUCKETS; ++j ){
+	if ( buckets[i][j] == 0 ){
+	  continue;
+	}
+	if ( !firstBucket ){
+	  result += ",";
+	}
+	firstBucket = false;
+	string bound = ( j < N_BUCKETS - 1 ) ? "<" + to_string( 1LL << j )
+	  : ">=" + to_string( 1LL << ( j - 1 ) );
+	result += jsonString( bound ) + ":" + to_string( buckets[i][j] );
+      }
+      result += "}}";
+    }
+    result += "},\"caches\":{"
+      + hitRate( "alpino_lookup", counters[ALPINO_LOOKUP_HIT],
+		 counters[ALPINO_LOOKUP_MISS] ) + ","
+      + hitRate( "wopr_batch", counters[WOPR_BATCH_HIT],
+		 counters[WOPR_BATCH_MISS] )
+      + "}}";
+    return result;
+  }
+
+  report *current(){
+    return currentReport;
+  }
+
+  scope::scope( report *r ): prev( currentReport ){
+    currentReport = r;
+  }
+
+  scope::~scope(){
+    currentReport = prev;
+  }
+
+  timer::timer( Stage s ): rep( currentReport ), stage( s ){
+    if ( rep ){
+      begin = chrono::steady_clock::now();
+    }
+  }
+
+  timer::~timer(){
+    if ( rep ){
+      rep->add( stage, chrono::steady_clock::now() - begin );
+    }
+  }
+
+  void count( Counter c ){
+    if ( currentReport ){
+      currentReport->count( c );
+    }
+  }
+
+  /**
+   * Sets where the reports go.
+   * @param name the file to append to, or "-" for stderr
+   * @return false when the file can't be opened
+   */
+  bool open( const string& name ){
+    if ( name == "-" ){
+      toStderr = true;
+      return true;
+    }
+    reportFile.open( name.c_str(), ios::app );
+    return reportFile.good();
+  }
+
+  bool enabled(){
+    return toStderr || reportFile.is_open();
+  }
+
+  void write( const report& r ){
+    string line = r.toJSON();
+    lock_guard<mutex> guard( writeLock );
+    if ( toStderr ){
+      cerr << line << endl;
+    }
+    else if ( reportFile.is_open() ){
+      reportFile << line << endl;
+    }
+  }
+
+}
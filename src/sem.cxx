@@ -1,4 +1,5 @@
 #include "tscan/sem.h"
+#include "tscan/log.h"
 
 using namespace std;
 
@@ -268,7 +269,7 @@ namespace SEM {
             result = ABSTRACT_ADJ;
         }
         if (result == UNFOUND_ADJ) {
-            cerr << "classify ADJ " << s << "," << sub << endl;
+            TLOG( DEBUG ) << "classify ADJ " << s << "," << sub;
         }
         return result;
     }
@@ -1,4 +1,5 @@
 #include "tscan/stats.h"
+#include "tscan/log.h"
 
 using namespace std;
 
@@ -7,23 +8,23 @@ using namespace std;
  * @param ws
  */
 void sentStats::setCommonCounts(wordStats *ws) {
-  wordInclCnt++;
+  wordInclCnt()++;
 
   switch (ws->prop) {
     case CGN::ISNAME:
-      nameInclCnt++;
-      unique_names[ws->l_word] += 1;
+      nameInclCnt()++;
+      unique_names[ws->l_word_id] += 1;
       break;
     case CGN::ISVD:
       switch (ws->position) {
         case CGN::NOMIN:
-          vdNwCnt++;
+          vdNwCnt()++;
           break;
         case CGN::PRENOM:
-          vdBvCnt++;
+          vdBvCnt()++;
           break;
         case CGN::VRIJ:
-          vdVrijCnt++;
+          vdVrijCnt()++;
           break;
         default:
           break;
@@ -32,13 +33,13 @@ void sentStats::setCommonCounts(wordStats *ws) {
     case CGN::ISINF:
       switch (ws->position) {
         case CGN::NOMIN:
-          infNwCnt++;
+          infNwCnt()++;
           break;
         case CGN::PRENOM:
-          infBvCnt++;
+          infBvCnt()++;
           break;
         case CGN::VRIJ:
-          infVrijCnt++;
+          infVrijCnt()++;
           break;
         default:
           break;
@@ -47,105 +48,105 @@ void sentStats::setCommonCounts(wordStats *ws) {
     case CGN::ISOD:
       switch (ws->position) {
         case CGN::NOMIN:
-          odNwCnt++;
+          odNwCnt()++;
           break;
         case CGN::PRENOM:
-          odBvCnt++;
+          odBvCnt()++;
           break;
         case CGN::VRIJ:
-          odVrijCnt++;
+          odVrijCnt()++;
           break;
         default:
           break;
       }
       break;
     case CGN::ISPVVERL:
-      pastCnt++;
+      pastCnt()++;
       break;
     case CGN::ISPVTGW:
-      presentCnt++;
+      presentCnt()++;
       break;
     case CGN::ISSUBJ:
-      subjonctCnt++;
+      subjonctCnt()++;
       break;
     case CGN::ISPPRON1:
-      pron1Cnt++;
+      pron1Cnt()++;
       break;
     case CGN::ISPPRON2:
-      pron2Cnt++;
+      pron2Cnt()++;
       break;
     case CGN::ISPPRON3:
-      pron3Cnt++;
+      pron3Cnt()++;
       break;
     default:;  // ignore JUSTAWORD and ISAANW
   }
 
   switch (ws->tag) {
     case CGN::N:
-      nounInclCnt++;
+      nounInclCnt()++;
       break;
     case CGN::ADJ:
-      adjInclCnt++;
+      adjInclCnt()++;
       break;
     case CGN::WW:
-      verbInclCnt++;
+      verbInclCnt()++;
       break;
     case CGN::VG:
-      vgCnt++;
+      vgCnt()++;
       break;
     case CGN::TSW:
-      tswCnt++;
+      tswCnt()++;
       break;
     case CGN::LET:
-      letCnt++;
+      letCnt()++;
       break;
     case CGN::SPEC:
-      specCnt++;
+      specCnt()++;
       break;
     case CGN::BW:
-      bwCnt++;
+      bwCnt()++;
       break;
     case CGN::VNW:
-      vnwCnt++;
+      vnwCnt()++;
       break;
     case CGN::LID:
-      lidCnt++;
+      lidCnt()++;
       break;
     case CGN::TW:
-      twCnt++;
+      twCnt()++;
       break;
     case CGN::VZ:
-      vzCnt++;
+      vzCnt()++;
       break;
     default:
       break;
   }
 
-  if (ws->wwform == PASSIVE_VERB) passiveCnt++;
-  if (ws->wwform == MODAL_VERB) modalCnt++;
-  if (ws->wwform == TIME_VERB) timeVCnt++;
-  if (ws->wwform == COPULA) koppelCnt++;
+  if (ws->wwform == PASSIVE_VERB) passiveCnt()++;
+  if (ws->wwform == MODAL_VERB) modalCnt()++;
+  if (ws->wwform == TIME_VERB) timeVCnt()++;
+  if (ws->wwform == COPULA) koppelCnt()++;
 
-  if (ws->isPropNeg) propNegCnt++;
-  if (ws->isMorphNeg) morphNegCnt++;
-  if (ws->isPersRef) persRefCnt++;
-  if (ws->isPronRef) pronRefCnt++;
-  if (ws->archaic) archaicsCnt++;
-  if (ws->isImperative) impCnt++;
+  if (ws->isPropNeg) propNegCnt()++;
+  if (ws->isMorphNeg) morphNegCnt()++;
+  if (ws->isPersRef) persRefCnt()++;
+  if (ws->isPronRef) pronRefCnt()++;
+  if (ws->archaic) archaicsCnt()++;
+  if (ws->isImperative) impCnt()++;
 
-  unique_words[ws->l_word] += 1;
-  unique_lemmas[ws->lemma] += 1;
+  unique_words[ws->l_word_id] += 1;
+  unique_lemmas[ws->lemma_id] += 1;
 
-  wordOverlapCnt += ws->wordOverlapCnt;
-  lemmaOverlapCnt += ws->lemmaOverlapCnt;
+  wordOverlapCnt() += ws->wordOverlapCnt;
+  lemmaOverlapCnt() += ws->lemmaOverlapCnt;
 
   if (ws->isContent) {
-    contentInclCnt++;
-    unique_contents[ws->l_word] += 1;
+    contentInclCnt()++;
+    unique_contents[ws->l_word_id] += 1;
   }
   if (ws->isContentStrict) {
-    contentStrictInclCnt++;
-    unique_contents_strict[ws->l_word] += 1;
+    contentStrictInclCnt()++;
+    unique_contents_strict[ws->l_word_id] += 1;
   }
 
   // Counts for abbreviations
@@ -154,38 +155,38 @@ void sentStats::setCommonCounts(wordStats *ws) {
   }
 
   // Counts for adverbs
-  if (ws->adverb_type == Adverb::GENERAL) generalAdverbCnt++;
-  if (ws->adverb_type == Adverb::SPECIFIC) specificAdverbCnt++;
+  if (ws->adverb_type == Adverb::GENERAL) generalAdverbCnt()++;
+  if (ws->adverb_type == Adverb::SPECIFIC) specificAdverbCnt()++;
 
   // Counts for intensifying words
   switch (ws->intensify_type) {
     case Intensify::BVNW:
-      intensBvnwCnt++;
-      intensCnt++;
+      intensBvnwCnt()++;
+      intensCnt()++;
       break;
     case Intensify::BVBW:
-      intensBvbwCnt++;
-      intensCnt++;
+      intensBvbwCnt()++;
+      intensCnt()++;
       break;
     case Intensify::BW:
-      intensBwCnt++;
-      intensCnt++;
+      intensBwCnt()++;
+      intensCnt()++;
       break;
     case Intensify::COMBI:
-      intensCombiCnt++;
-      intensCnt++;
+      intensCombiCnt()++;
+      intensCnt()++;
       break;
     case Intensify::NW:
-      intensNwCnt++;
-      intensCnt++;
+      intensNwCnt()++;
+      intensCnt()++;
       break;
     case Intensify::TUSS:
-      intensTussCnt++;
-      intensCnt++;
+      intensTussCnt()++;
+      intensCnt()++;
       break;
     case Intensify::WW:
-      intensWwCnt++;
-      intensCnt++;
+      intensWwCnt()++;
+      intensCnt()++;
       break;
     default:
       break;
@@ -201,36 +202,36 @@ void sentStats::setFormalCounts(wordStats *ws) {
   // Counts for formal words
   switch (ws->formal_type) {
     case Formal::BVNW:
-      formalBvnwCnt++;
-      formalCnt++;
+      formalBvnwCnt()++;
+      formalCnt()++;
       break;
     case Formal::BW:
-      formalBwCnt++;
-      formalCnt++;
+      formalBwCnt()++;
+      formalCnt()++;
       break;
     case Formal::VGW:
-      formalVgwCnt++;
-      formalCnt++;
+      formalVgwCnt()++;
+      formalCnt()++;
       break;
     case Formal::VNW:
-      formalVnwCnt++;
-      formalCnt++;
+      formalVnwCnt()++;
+      formalCnt()++;
       break;
     case Formal::VZ:
-      formalVzCnt++;
-      formalCnt++;
+      formalVzCnt()++;
+      formalCnt()++;
       break;
     case Formal::VZG:
-      formalVzgCnt++;
-      formalCnt++;
+      formalVzgCnt()++;
+      formalCnt()++;
       break;
     case Formal::WW:
-      formalWwCnt++;
-      formalCnt++;
+      formalWwCnt()++;
+      formalCnt()++;
       break;
     case Formal::ZNW:
-      formalZnwCnt++;
-      formalCnt++;
+      formalZnwCnt()++;
+      formalCnt()++;
       break;
     default:
       break;
@@ -289,7 +290,7 @@ void sentStats::resolveConnectives() {
 	}
       }
       if ( negatives_long.find( multiword2 ) != negatives_long.end() ){
-	propNegCnt++;
+	propNegCnt()++;
       }
       string multiword3 = multiword2 + " " + sv[i+2]->ltext();
       //      cerr << "zoek op " << multiword3 << endl;
@@ -303,7 +304,7 @@ void sentStats::resolveConnectives() {
 	sv[i+2]->setConnType( Conn::NOCONN );
       }
       if ( negatives_long.find( multiword3 ) != negatives_long.end() )
-	propNegCnt++;
+	propNegCnt()++;
     }
     // don't forget the last 2 words
     string multiword2 = sv[sv.size()-2]->ltext() + " "
@@ -317,45 +318,45 @@ void sentStats::resolveConnectives() {
       sv[sv.size()-1]->setConnType( Conn::NOCONN );
     }
     if ( negatives_long.find( multiword2 ) != negatives_long.end() ){
-      propNegCnt++;
+      propNegCnt()++;
     }
   }
   for ( size_t i=0; i < sv.size(); ++i ){
     switch( sv[i]->getConnType() ){
     case Conn::TEMPOREEL:
-      unique_temp_conn[sv[i]->ltext()]++;
-      unique_all_conn[sv[i]->ltext()]++;
-      tempConnCnt++;
-      allConnCnt++;
+      unique_temp_conn[sv[i]->ltextId()]++;
+      unique_all_conn[sv[i]->ltextId()]++;
+      tempConnCnt()++;
+      allConnCnt()++;
       break;
     case Conn::OPSOMMEND_WG:
-      unique_reeks_wg_conn[sv[i]->ltext()]++;
-      opsomWgConnCnt++;
+      unique_reeks_wg_conn[sv[i]->ltextId()]++;
+      opsomWgConnCnt()++;
       // Don't add OPSOMMEND_WG to allContCnt/unique_all_conn
       break;
     case Conn::OPSOMMEND_ZIN:
-      unique_reeks_zin_conn[sv[i]->ltext()]++;
-      unique_all_conn[sv[i]->ltext()]++;
-      opsomZinConnCnt++;
-      allConnCnt++;
+      unique_reeks_zin_conn[sv[i]->ltextId()]++;
+      unique_all_conn[sv[i]->ltextId()]++;
+      opsomZinConnCnt()++;
+      allConnCnt()++;
       break;
     case Conn::CONTRASTIEF:
-      unique_contr_conn[sv[i]->ltext()]++;
-      unique_all_conn[sv[i]->ltext()]++;
-      contrastConnCnt++;
-      allConnCnt++;
+      unique_contr_conn[sv[i]->ltextId()]++;
+      unique_all_conn[sv[i]->ltextId()]++;
+      contrastConnCnt()++;
+      allConnCnt()++;
       break;
     case Conn::COMPARATIEF:
-      unique_comp_conn[sv[i]->ltext()]++;
-      unique_all_conn[sv[i]->ltext()]++;
-      compConnCnt++;
-      allConnCnt++;
+      unique_comp_conn[sv[i]->ltextId()]++;
+      unique_all_conn[sv[i]->ltextId()]++;
+      compConnCnt()++;
+      allConnCnt()++;
       break;
     case Conn::CAUSAAL:
-      unique_cause_conn[sv[i]->ltext()]++;
-      unique_all_conn[sv[i]->ltext()]++;
-      causeConnCnt++;
-      allConnCnt++;
+      unique_cause_conn[sv[i]->ltextId()]++;
+      unique_all_conn[sv[i]->ltextId()]++;
+      causeConnCnt()++;
+      allConnCnt()++;
       break;
     default:
       break;
@@ -379,7 +380,7 @@ bool sentStats::checkAls( size_t index ) {
     }
     else {
       for ( size_t i = index - 1;; --i ) {
-        cerr << i << endl;
+        TLOG( TRACE ) << i;
         string word = sv[i]->ltext();
         if ( compAlsSet.find( word ) != compAlsSet.end() ) {
             // kijk naar "evenmin ... als" constructies
@@ -515,20 +516,20 @@ void sentStats::resolveSituations() {
   for ( size_t i=0; i < sv.size(); ++i ){
     switch( sv[i]->getSitType() ){
     case Situation::TIME_SIT:
-      unique_tijd_sits[sv[i]->Lemma()]++;
-      timeSitCnt++;
+      unique_tijd_sits[sv[i]->lemmaId()]++;
+      timeSitCnt()++;
       break;
     case Situation::CAUSAL_SIT:
-      unique_cause_sits[sv[i]->Lemma()]++;
-      causeSitCnt++;
+      unique_cause_sits[sv[i]->lemmaId()]++;
+      causeSitCnt()++;
       break;
     case Situation::SPACE_SIT:
-      unique_ruimte_sits[sv[i]->Lemma()]++;
-      spaceSitCnt++;
+      unique_ruimte_sits[sv[i]->lemmaId()]++;
+      spaceSitCnt()++;
       break;
     case Situation::EMO_SIT:
-      unique_emotion_sits[sv[i]->Lemma()]++;
-      emoSitCnt++;
+      unique_emotion_sits[sv[i]->lemmaId()]++;
+      emoSitCnt()++;
       break;
     default:
       break;
@@ -614,10 +615,10 @@ void sentStats::resolveRelativeClauses( xmlDoc *alpDoc ) {
   list<xmlNode*> tiBepNodes = TiCC::FindNodes(alpDoc, infinComplBepPath);
 
   // Save counts
-  betrCnt = relNodes.size();
-  bijwCnt = cpNodes.size();
-  complCnt = complNodes.size();
-  infinComplBepCnt = tiBepNodes.size();
+  betrCnt() = relNodes.size();
+  bijwCnt() = cpNodes.size();
+  complCnt() = complNodes.size();
+  infinComplBepCnt() = tiBepNodes.size();
 
   // Checks for embedded finite clauses
   list<xmlNode*> allRelNodes (relNodes);
@@ -642,7 +643,7 @@ void sentStats::resolveRelativeClauses( xmlDoc *alpDoc ) {
     ids.merge(getNodeIds(complementNodes(TiCC::FindNodes(node, complCpPath), embedCpNodes)));
   }
   set<string> mvFinEmbedIds(ids.begin(), ids.end());
-  mvFinInbedCnt = mvFinEmbedIds.size();
+  mvFinInbedCnt() = mvFinEmbedIds.size();
 
   // Checks for all embedded clauses
   allRelNodes.merge(tiBepNodes);
@@ -667,13 +668,13 @@ void sentStats::resolveRelativeClauses( xmlDoc *alpDoc ) {
     ids.merge(getNodeIds(getNodesByCat(node, "ti")));
   }
   set<string> mvInbedIds(ids.begin(), ids.end());
-  mvInbedCnt = mvInbedIds.size();
+  mvInbedCnt() = mvInbedIds.size();
 
   // Count 'loose' (directly under top node) relative clauses
   string losBetr = "//node[@cat='top']/node[@cat='rel' or @cat='whrel']" + hasFiniteVerb;
-  losBetrCnt = TiCC::FindNodes(alpDoc, losBetr).size();
+  losBetrCnt() = TiCC::FindNodes(alpDoc, losBetr).size();
   string losBijw = "//node[@cat='top']/node[@cat='cp']" + hasFiniteVerb;
-  losBijwCnt = TiCC::FindNodes(alpDoc, losBijw).size();
+  losBijwCnt() = TiCC::FindNodes(alpDoc, losBijw).size();
 }
 
 /**************
@@ -682,12 +683,12 @@ void sentStats::resolveRelativeClauses( xmlDoc *alpDoc ) {
 
 // Finds nodes of finite verbs and reports counts
 void sentStats::resolveFiniteVerbs( xmlDoc *alpDoc ) {
-  smainCnt = getNodesByCat(alpDoc, "smain").size();
-  ssubCnt = getNodesByCat(alpDoc, "ssub").size();
-  sv1Cnt = getNodesByCat(alpDoc, "sv1").size();
+  smainCnt() = getNodesByCat(alpDoc, "smain").size();
+  ssubCnt() = getNodesByCat(alpDoc, "ssub").size();
+  sv1Cnt() = getNodesByCat(alpDoc, "sv1").size();
 
-  clauseCnt = smainCnt + ssubCnt + sv1Cnt;
-  correctedClauseCnt = clauseCnt > 0 ? clauseCnt : 1; // Correct clause count to 1 if there are no verbs in the sentence
+  clauseCnt() = smainCnt() + ssubCnt() + sv1Cnt();
+  correctedClauseCnt() = clauseCnt() > 0 ? clauseCnt() : 1; // Correct clause count to 1 if there are no verbs in the sentence
 }
 
 /**************
@@ -696,10 +697,10 @@ void sentStats::resolveFiniteVerbs( xmlDoc *alpDoc ) {
 
 // Finds nodes of coordinating conjunctions and reports counts
 void sentStats::resolveConjunctions( xmlDoc *alpDoc ) {
-  smainCnjCnt = getNodesByRelCat(alpDoc, "cnj", "smain").size();
+  smainCnjCnt() = getNodesByRelCat(alpDoc, "cnj", "smain").size();
   // For cnj-ssub, also allow that the cnj node dominates the ssub node
-  ssubCnjCnt = TiCC::FindNodes(alpDoc, ".//node[@rel='cnj'][descendant-or-self::node[@cat='ssub']]").size();
-  sv1CnjCnt = getNodesByRelCat(alpDoc, "cnj", "sv1").size();
+  ssubCnjCnt() = TiCC::FindNodes(alpDoc, ".//node[@rel='cnj'][descendant-or-self::node[@cat='ssub']]").size();
+  sv1CnjCnt() = getNodesByRelCat(alpDoc, "cnj", "sv1").size();
 }
 
 // Finds nodes of small conjunctions and reports counts
@@ -707,12 +708,12 @@ void sentStats::resolveSmallConjunctions( xmlDoc *alpDoc ) {
   // Small conjunctions have 'cnj' as relation and do not form a "bigger" sentence
   string cats = "|smain|ssub|sv1|rel|whrel|cp|oti|ti|whsub|";
   string smallCnjPath = ".//node[@rel='cnj' and not(contains('" + cats + "', concat('|', @cat, '|')))]";
-  smallCnjCnt = TiCC::FindNodes(alpDoc, smallCnjPath).size();
+  smallCnjCnt() = TiCC::FindNodes(alpDoc, smallCnjPath).size();
 
   // smallCnjExtraCnt count elements that have 'conj' as a category and do not govern a "bigger" sentence
   // This amount is then substracted from the number of small conjunctions.
   string smallCnjExtraPath = ".//node[@cat='conj' and not(descendant::node[contains('" + cats + "', concat('|', @cat, '|'))])]";
-  smallCnjExtraCnt = smallCnjCnt - TiCC::FindNodes(alpDoc, smallCnjExtraPath).size();
+  smallCnjExtraCnt() = smallCnjCnt() - TiCC::FindNodes(alpDoc, smallCnjExtraPath).size();
 }
 
 /**************
@@ -723,10 +724,10 @@ void sentStats::addMetrics() const {
   structStats::addMetrics();
   folia::FoliaElement *el = folia_node;
   folia::Document *doc = el->doc();
-  if ( passiveCnt > 0 )
+  if ( passiveCnt() > 0 )
     addOneMetric( doc, el, "isPassive", "true" );
-  if ( questCnt > 0 )
+  if ( questCnt() > 0 )
     addOneMetric( doc, el, "isQuestion", "true" );
-  if ( impCnt > 0 )
+  if ( impCnt() > 0 )
     addOneMetric( doc, el, "isImperative", "true" );
 }
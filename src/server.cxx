@@ -0,0 +1,292 @@
+#include <iostream>
+#include <deque>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <chrono>
+#include <cstring>
+#include <cstdlib>
+#include <cerrno>
+#include <csignal>
+#include <sys/types.h>
+#include <sys/socket.h>
+#include <sys/time.h>
+#include <sys/un.h>
+#include <netinet/in.h>
+#include <unistd.h>
+#include "tscan/server.h"
+#include "tscan/log.h"
+
+using namespace std;
+
+namespace Server {
+
+  /**
+   * The accepted connections, waiting for a free worker.
+   */
+  class connectionQueue {
+  public:
+    void push( int fd ){
+      lock_guard<mutex> guard( lock );
+      fds.push_back( fd );
+      ready.notify_one();
+    }
+    int pop(){
+      unique_lock<mutex> guard( lock );
+      while ( fds.empty() ){
+	ready.wait( guard );
+      }
+      int fd = fds.front();
+      fds.pop_front();
+      return fd;
+    }
+  private:
+    mutex lock;
+    condition_variable ready;
+    deque<int> fds;
+  };
+
+  // how long a client may keep a worker waiting for the next bytes of
+  // its request, or for taking in the reply
+  static const int clientTimeout = 30;
+
+  /**
+   * Reads the lines of a request, a chunk of the socket at a time.
+   */
+  class lineReader {
+  public:
+    explicit lineReader( int fd ): fd( fd ), begin( 0 ), end( 0 ),
+				   timedOut( false ){};
+    /**
+     * Reads the next line, without its line end.
+     * @return false when the client closed the connection or kept it
+     * waiting too long, and there was nothing left to read
+     */
+    bool getline( string& line ){
+      line.clear();
+      while ( true ){
+	if ( begin == end ){
+	  ssize_t n = recv( fd, buffer, sizeof( buffer ), 0 );
+	  if ( n < 0 && errno == EINTR ){
+	    continue;
+	  }
+	  if ( n <= 0 ){
+	    timedOut = n < 0 && ( errno == EAGAIN || errno == EWOULDBLOCK );
+	    return !line.empty();
+	  }
+	  begin = 0;
+	  end = n;
+	}
+	const char *nl = static_cast<const char*>( memchr( buffer + begin, '\n',
+							   end - begin ) );
+	size_t stop = nl ? nl - buffer : end;
+	line.append( buffer + begin, stop - begin );
+	begin = nl ? stop + 1 : end;
+	if ( nl ){
+	  break;
+	}
+      }
+      if ( !line.empty() && line[line.size()-1] == '\r' ){
+	line.resize( line.size() - 1 );
+      }
+      return true;
+    }
+    int fd;
+    char buffer[4096];
+    size_t begin;
+    size_t end;
+    bool timedOut;
+  };
+
+  static void writeAll( int fd, const string& s ){
+    size_t done = 0;
+    while ( done < s.size() ){
+      ssize_t n = send( fd, s.data() + done, s.size() - done, 0 );
+      if ( n <= 0 ){
+	return;
+      }
+      done += n;
+    }
+  }
+
+  static void handle( int fd, const handler& analyse ){
+    struct timeval timeout;
+    timeout.tv_sec = clientTimeout;
+    timeout.tv_usec = 0;
+    setsockopt( fd, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof( timeout ) );
+    setsockopt( fd, SOL_SOCKET, SO_SNDTIMEO, &timeout, sizeof( timeout ) );
+    lineReader reader( fd );
+    request req;
+    string line;
+    string reply;
+    while ( reader.getline( line ) && !line.empty() ){
+      if ( !reply.empty() ){
+	// read the rest of an invalid request, so closing the connection
+	// doesn't reset it before the client has the reply
+	continue;
+      }
+      string::size_type pos = line.find( '=' );
+      if ( pos == string::npos ){
+	reply = "ERROR invalid request line '" + line + "'\n\n";
+	continue;
+      }
+      req[line.substr( 0, pos )] = line.substr( pos + 1 );
+    }
+    if ( reply.empty() && reader.timedOut ){
+      reply = "ERROR no complete request within "
+	+ to_string( clientTimeout ) + " seconds\n\n";
+    }
+    if ( reply.empty() ){
+      vector<string> outputs;
+      string message;
+      bool ok = false;
+      try {
+	ok = analyse( req, outputs, message );
+      }
+      catch ( const exception& e ){
+	message = e.what();
+      }
+      catch ( ... ){
+	// a worker must survive whatever the analysis throws
+	message = "unknown error";
+      }
+      if ( ok ){
+	reply = "OK\n";
+	for ( size_t i = 0; i < outputs.size(); ++i ){
+	  reply += "output=" + outputs[i] + "\n";
+	}
+	reply += "\n";
+      }
+      else {
+	reply = "ERROR " + message + "\n\n";
+      }
+    }
+    writeAll( fd, reply );
+    close( fd );
+  }
+
+  /**
+   * Reads a TCP port number.
+   * @return false when it isn't a number from 1 to 65535
+   */
+  static bool parsePort( const string& address, int& port ){
+    errno = 0;
+    char *end = 0;
+    long value = strtol( address.c_str(), &end, 10 );
+    if ( errno != 0 || *end != '\0' || value < 1 || value > 65535 ){
+      return false;
+    }
+    port = value;
+    return true;
+  }
+
+  static int listenOn( const string& address ){
+    bool tcp = !address.empty()
+      && address.find_first_not_of( "0123456789" ) == string::npos;
+    int fd = -1;
+    if ( tcp ){
+      int port = 0;
+      if ( !parsePort( address, port ) ){
+	errno = EINVAL;
+	return -1;
+      }
+      fd = socket( AF_INET, SOCK_STREAM, 0 );
+      if ( fd < 0 ){
+	return -1;
+      }
+      int on = 1;
+      setsockopt( fd, SOL_SOCKET, SO_REUSEADDR, &on, sizeof( on ) );
+      struct sockaddr_in addr;
+      memset( &addr, 0, sizeof( addr ) );
+      addr.sin_family = AF_INET;
+      // a request names the files to read and write, so only clients
+      // on this machine may connect
+      addr.sin_addr.s_addr = htonl( INADDR_LOOPBACK );
+      addr.sin_port = htons( port );
+      if ( ::bind( fd, reinterpret_cast<struct sockaddr*>( &addr ),
+		   sizeof( addr ) ) < 0 ){
+	close( fd );
+	return -1;
+      }
+    }
+    else {
+      struct sockaddr_un addr;
+      if ( address.empty() || address.size() >= sizeof( addr.sun_path ) ){
+	return -1;
+      }
+      fd = socket( AF_UNIX, SOCK_STREAM, 0 );
+      if ( fd < 0 ){
+	return -1;
+      }
+      memset( &addr, 0, sizeof( addr ) );
+      addr.sun_family = AF_UNIX;
+      strncpy( addr.sun_path, address.c_str(), sizeof( addr.sun_path ) - 1 );
+      unlink( address.c_str() );
+      if ( ::bind( fd, reinterpret_cast<struct sockaddr*>( &addr ),
+		   sizeof( addr ) ) < 0 ){
+	close( fd );
+	return -1;
+      }
+    }
+    if ( listen( fd, 16 ) < 0 ){
+      close( fd );
+      return -1;
+    }
+    return fd;
+  }
+
+  /**
+   * Serves requests until the process is stopped.
+   * @param address a port number, or the path of a unix socket
+   * @param workers the number of requests handled at the same time
+   * @param analyse the function that handles a request
+   * @return false when the address could not be listened on
+   */
+  bool serve( const string& address, size_t workers, const handler& analyse ){
+    int sock = listenOn( address );
+    if ( sock < 0 ){
+      TLOG( ERROR ) << "unable to listen on '" << address << "': "
+		    << strerror( errno );
+      return false;
+    }
+    // a client that hangs up shouldn't take the server down
+    signal( SIGPIPE, SIG_IGN );
+    TLOG( INFO ) << "tscan server listening on " << address
+		 << " with " << workers << " worker(s)";
+    connectionQueue queue;
+    vector<thread> pool;
+    for ( size_t i = 0; i < workers; ++i ){
+      pool.push_back( thread( [&queue, &analyse](){
+	    while ( true ){
+	      handle( queue.pop(), analyse );
+	    }
+	  } ) );
+    }
+    size_t failures = 0;
+    while ( true ){
+      int fd = accept( sock, 0, 0 );
+      if ( fd < 0 ){
+	if ( errno == EINTR || errno == ECONNABORTED ){
+	  continue;
+	}
+	// e.g. out of file descriptors: this won't clear up at once, so
+	// wait ever longer, up to 5 seconds, and only log the first failure
+	if ( failures == 0 ){
+	  TLOG( ERROR ) << "accept failed: " << strerror( errno )
+			<< ", retrying";
+	}
+	++failures;
+	size_t ms = failures < 7 ? 100 << ( failures - 1 ) : 5000;
+	this_thread::sleep_for( chrono::milliseconds( ms ) );
+	continue;
+      }
+      if ( failures > 0 ){
+	TLOG( INFO ) << "accept works again, after " << failures
+		     << " failure(s)";
+	failures = 0;
+      }
+      queue.push( fd );
+    }
+  }
+
+}
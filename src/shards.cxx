@@ -0,0 +1,324 @@
+#include <map>
+#include <cstdlib>
+#include "tscan/shards.h"
+
+using namespace std;
+
+namespace Shards {
+
+  /**
+   * Splits the lines in at most n parts of about the same size.
+   * @param lines the lines of the text
+   * @param n the number of parts wanted
+   * @param sentencePerLine whether every line is a paragraph
+   * @return the [from, to) ranges of the parts
+   */
+  vector<pair<size_t,size_t> > split( const vector<string>& lines, size_t n,
+				      bool sentencePerLine ){
+    size_t total = 0;
+    for ( size_t i = 0; i < lines.size(); ++i ){
+      total += lines[i].size() + 1;
+    }
+    vector<pair<size_t,size_t> > result;
+    size_t from = 0;
+    size_t done = 0;
+    for ( size_t i = 0; i < lines.size(); ++i ){
+      done += lines[i].size() + 1;
+      bool boundary = sentencePerLine
+	|| lines[i].find_first_not_of( " \t\r" ) == string::npos;
+      if ( boundary && result.size() + 1 < n
+	   && done * n >= total * ( result.size() + 1 ) ){
+	result.push_back( make_pair( from, i + 1 ) );
+	from = i + 1;
+      }
+    }
+    if ( from < lines.size() ){
+      result.push_back( make_pair( from, lines.size() ) );
+    }
+    return result;
+  }
+
+  /**
+   * Returns the value of an attribute of the start tag at pos, or "".
+   */
+  static string attribute( const string& xml, size_t pos, const string& name ){
+    size_t close = xml.find( '>', pos );
+    size_t at = xml.find( " " + name + "=\"", pos );
+    if ( close == string::npos || at == string::npos || at > close ){
+      return "";
+    }
+    at += name.size() + 3;
+    size_t end = xml.find( '"', at );
+    if ( end == string::npos || end > close ){
+      return "";
+    }
+    return xml.substr( at, end - at );
+  }
+
+  /**
+   * Finds the next start tag of an element, not one of a longer name.
+   */
+  static size_t findStart( const string& xml, const string& name, size_t pos ){
+    while ( ( pos = xml.find( "<" + name, pos ) ) != string::npos ){
+      char next = xml[pos + name.size() + 1];
+      if ( next == ' ' || next == '>' || next == '/'
+	   || next == '\n' || next == '\t' || next == '\r' ){
+	return pos;
+      }
+      ++pos;
+    }
+    return string::npos;
+  }
+
+  /**
+   * Lists the elements in [from, to), as [begin, end) ranges, without
+   * looking into them.
+   * @return false when the XML there is not a list of elements
+   */
+  static bool elements( const string& xml, size_t from, size_t to,
+			vector<pair<size_t,size_t> >& result ){
+    size_t pos = from;
+    while ( ( pos = xml.find( '<', pos ) ) != string::npos && pos < to ){
+      if ( xml.compare( pos, 4, "<!--" ) == 0 ){
+	pos = xml.find( "-->", pos );
+	if ( pos == string::npos ){
+	  return false;
+	}
+	pos += 3;
+	continue;
+      }
+      size_t name_end = xml.find_first_of( " \t\r\n/>", pos + 1 );
+      if ( xml[pos + 1] == '/' || name_end == string::npos ){
+	return false;
+      }
+      string name = xml.substr( pos + 1, name_end - pos - 1 );
+      size_t end = xml.find( '>', pos );
+      if ( end == string::npos ){
+	return false;
+      }
+      ++end;
+      if ( xml[end - 2] != '/' ){
+	// find the matching end tag
+	int depth = 1;
+	while ( depth > 0 ){
+	  size_t open = findStart( xml, name, end );
+	  size_t close = xml.find( "</" + name + ">", end );
+	  if ( close == string::npos ){
+	    return false;
+	  }
+	  if ( open < close ){
+	    end = xml.find( '>', open ) + 1;
+	    if ( xml[end - 2] != '/' ){
+	      ++depth;
+	    }
+	  }
+	  else {
+	    end = close + name.size() + 3;
+	    --depth;
+	  }
+	}
+      }
+      if ( end > to ){
+	return false;
+      }
+      result.push_back( make_pair( pos, end ) );
+      pos = end;
+    }
+    return true;
+  }
+
+  /**
+   * Finds the contents of the first element of this name before 'to'.
+   * @return false when it isn't there
+   */
+  static bool contents( const string& xml, const string& name, size_t to,
+			size_t& begin, size_t& end ){
+    size_t pos = findStart( xml, name, 0 );
+    if ( pos == string::npos || pos > to ){
+      return false;
+    }
+    begin = xml.find( '>', pos );
+    end = xml.find( "</" + name + ">", pos );
+    if ( begin == string::npos || end == string::npos || end > to ){
+      return false;
+    }
+    ++begin;
+    return true;
+  }
+
+  /**
+   * What identifies a declaration or processor: its element name and its
+   * id, or else its set.
+   */
+  static string declarationKey( const string& xml, size_t pos ){
+    size_t name_end = xml.find_first_of( " \t\r\n/>", pos + 1 );
+    string key = xml.substr( pos + 1, name_end - pos - 1 );
+    string id = attribute( xml, pos, "xml:id" );
+    if ( !id.empty() ){
+      return key + " id " + id;
+    }
+    return key + " set " + attribute( xml, pos, "set" );
+  }
+
+  /**
+   * Adds the children of a metadata element of a later part, that the
+   * combined document doesn't have yet.
+   * @param result the combined document so far
+   * @param part the later part
+   * @param name the element: 'annotations' or 'provenance'
+   * @return false when the element can't be merged
+   */
+  static bool mergeMetadata( string& result, const string& part,
+			     const string& name ){
+    size_t part_text = findStart( part, "text", 0 );
+    size_t result_text = findStart( result, "text", 0 );
+    size_t part_begin, part_end;
+    if ( !contents( part, name, part_text, part_begin, part_end ) ){
+      return true;
+    }
+    size_t begin, end;
+    if ( !contents( result, name, result_text, begin, end ) ){
+      return false;
+    }
+    vector<pair<size_t,size_t> > have;
+    vector<pair<size_t,size_t> > add;
+    if ( !elements( result, begin, end, have )
+	 || !elements( part, part_begin, part_end, add ) ){
+      return false;
+    }
+    map<string,bool> keys;
+    for ( size_t i = 0; i < have.size(); ++i ){
+      keys[declarationKey( result, have[i].first )] = true;
+    }
+    string indent = "\n";
+    size_t at = begin;
+    if ( !have.empty() ){
+      size_t line = result.rfind( '\n', have[0].first );
+      if ( line != string::npos && line >= begin ){
+	indent = result.substr( line, have[0].first - line );
+      }
+      at = have.back().second;
+    }
+    string extra;
+    for ( size_t i = 0; i < add.size(); ++i ){
+      string key = declarationKey( part, add[i].first );
+      if ( !keys[key] ){
+	keys[key] = true;
+	extra += indent + part.substr( add[i].first,
+				       add[i].second - add[i].first );
+      }
+    }
+    result.insert( at, extra );
+    return true;
+  }
+
+  /**
+   * Rewrites the ids in the text of a part. Every id must start with
+   * the document id and a top level element name and number, as in
+   * "doc.p.3.s.1".
+   * @param part the FoLiA document of the part
+   * @param begin, end the text of the part
+   * @param id the document id of the part
+   * @param docid the document id of the combined document
+   * @param offsets the numbers taken by the earlier parts, per name
+   * @param out receives the rewritten text
+   * @param maxima receives the highest number of this part, per name
+   * @return false for another id
+   */
+  static bool renumber( const string& part, size_t begin, size_t end,
+			const string& id, const string& docid,
+			const map<string,size_t>& offsets, string& out,
+			map<string,size_t>& maxima ){
+    const string prefix = "\"" + id + ".";
+    size_t last = begin;
+    size_t pos = begin;
+    while ( ( pos = part.find( prefix, pos ) ) != string::npos && pos < end ){
+      size_t name = pos + prefix.size();
+      size_t dot = part.find( '.', name );
+      if ( dot == string::npos || dot == name || dot >= end ){
+	return false;
+      }
+      size_t digits = dot + 1;
+      size_t after = part.find_first_not_of( "0123456789", digits );
+      if ( after == digits || after == string::npos
+	   || ( part[after] != '.' && part[after] != '"' ) ){
+	return false;
+      }
+      string type = part.substr( name, dot - name );
+      size_t number = strtoul( part.c_str() + digits, 0, 10 );
+      if ( number > maxima[type] ){
+	maxima[type] = number;
+      }
+      map<string,size_t>::const_iterator it = offsets.find( type );
+      if ( it != offsets.end() ){
+	number += it->second;
+      }
+      out.append( part, last, pos - last );
+      out += "\"" + docid + "." + type + "." + to_string( number );
+      last = pos = after;
+    }
+    out.append( part, last, end - last );
+    return true;
+  }
+
+  /**
+   * Combines the FoLiA documents that Frog returned for consecutive
+   * parts of one text into one document.
+   * @param parts the FoLiA documents, in text order
+   * @return the combined document, or an empty string when a part
+   * doesn't look as expected
+   */
+  string stitch( const vector<string>& parts ){
+    string result;
+    string body;
+    string docid;
+    map<string,size_t> offsets;
+    for ( size_t k = 0; k < parts.size(); ++k ){
+      const string& part = parts[k];
+      size_t root = findStart( part, "FoLiA", 0 );
+      if ( root == string::npos ){
+	return "";
+      }
+      string id = attribute( part, root, "xml:id" );
+      size_t text = findStart( part, "text", root );
+      size_t end = part.rfind( "</text>" );
+      if ( id.empty() || text == string::npos || end == string::npos ){
+	return "";
+      }
+      size_t begin = part.find( '>', text ) + 1;
+      if ( end < begin ){
+	return "";
+      }
+      if ( k == 0 ){
+	docid = id;
+      }
+      string out;
+      map<string,size_t> maxima;
+      if ( !renumber( part, begin, end, id, docid, offsets, out, maxima ) ){
+	return "";
+      }
+      for ( map<string,size_t>::const_iterator it = maxima.begin();
+	    it != maxima.end();
+	    ++it ){
+	offsets[it->first] += it->second;
+      }
+      if ( k == 0 ){
+	result = part.substr( 0, begin ) + out + part.substr( end );
+      }
+      else {
+	body += out;
+	if ( !mergeMetadata( result, part, "annotations" )
+	     || !mergeMetadata( result, part, "provenance" ) ){
+	  return "";
+	}
+      }
+    }
+    size_t pos = result.rfind( "</text>" );
+    if ( pos == string::npos ){
+      return "";
+    }
+    result.insert( pos, body );
+    return result;
+  }
+
+}
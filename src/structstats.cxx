@@ -2,23 +2,13 @@
 
 using namespace std;
 
-structStats::~structStats(){
-  vector<basicStats *>::iterator it = sv.begin();
-  while ( it != sv.end() ){
-    delete( *it );
-    ++it;
-  }
+namespace Counters {
+  const char *intNames[N_INT_SUMS] = { STRUCT_INT_SUMS(COUNTER_NAME) };
+  const char *doubleNames[N_DOUBLE_SUMS] = { STRUCT_DOUBLE_SUMS(COUNTER_NAME) };
 }
 
-vector<const wordStats*> structStats::collectWords() const {
-  vector<const wordStats*> result;
-  vector<basicStats *>::const_iterator it = sv.begin();
-  while ( it != sv.end() ){
-    vector<const wordStats*> tmp = (*it)->collectWords();
-    result.insert( result.end(), tmp.begin(), tmp.end() );
-    ++it;
-  }
-  return result;
+wordSpan structStats::collectWords() const {
+  return words;
 }
 
 /****
@@ -58,848 +48,566 @@ double structStats::getHighestAL() const {
  ************/
 
 /**
- * Sets all headers of the structStats .csv-output.
- * @param os    the current outputstream
- * @param intro specific columns per struct (document, paragraph, sentence)
- */
-void structStats::CSVheader( ostream& os, const string& intro ) const {
-  os << intro << ",Alpino_status,";
-  topPredictorsHeader( os );
-  wordDifficultiesHeader( os );
-  compoundHeader( os );
-  sentDifficultiesHeader( os );
-  infoHeader( os );
-  coherenceHeader( os );
-  concreetHeader( os );
-  persoonlijkheidHeader( os );
-  verbHeader( os );
-  imperativeHeader( os );
-  wordSortHeader( os );
-  prepPhraseHeader( os );
-  intensHeader( os );
-  formalHeader( os );
-  miscHeader( os );
-  os << endl;
-}
-
-/**
- * Sets all .csv-output for structStats.
- * @param os the current outputstream
+ * Fills the columns of a paragraph, sentence or document line.
+ * @param line the line to fill
  */
-void structStats::toCSV( ostream& os ) const {
-  if (!isSentence())
-  {
-    // For paragraphs and documents, add a sentence and word count.
-    os << sentCnt << ",";
-    os << wordCnt << ",";
+void structStats::CSVcolumns( csvLine& line ) const {
+  if ( isSentence() ){
+    // the original sentence
+    line.quoted( "Getokeniseerde_zin", text );
   }
-  else
-  {
-    // For sentences, add the original sentence (quoted)
-    os << "\"" << escape_quotes(text) << "\",";
+  else if ( isDocument() ){
+    line.col( "Zin_per_doc", sentCnt );
+    line.col( "Word_per_doc", wordCnt() );
   }
-
-  os << parseFailCnt << ","; // Alpino_status
-
-  topPredictorsToCSV( os );
-  wordDifficultiesToCSV( os );
-  compoundToCSV( os );
-  sentDifficultiesToCSV( os );
-  informationDensityToCSV( os );
-  coherenceToCSV( os );
-  concreetToCSV( os );
-  persoonlijkheidToCSV( os );
-  verbToCSV( os );
-  imperativeToCSV( os );
-  wordSortToCSV( os );
-  prepPhraseToCSV( os );
-  intensToCSV( os );
-  formalToCSV( os );
-  miscToCSV( os );
-
-  os << endl;
-}
-
-void structStats::topPredictorsHeader( ostream& os ) const { 
-  os << "wrd_freq_log_zn_corr,wrd_freq_zn_log,"
-     << "Conc_nw_ruim_p,Conc_nw_strikt_p," 
-     << "Alg_nw_d,"
-     << "Pers_ref_d,"
-     << "Pers_vnw_d,"
-     << "Wrd_per_zin,"
-     << "Wrd_per_dz,"
-     << "Inhwrd_dz_zonder_abw,"
-     << "AL_max,"
-     << "Bijzin_per_zin,"
-     << "Bijv_bep_dz_zbijzin,"
-     << "Extra_KConj_dz,"
-     << "MTLD_inhwrd_zonder_abw,";
-}
-
-void structStats::topPredictorsToCSV( ostream& os ) const { 
-  os << proportion(word_freq_log_n_corr, contentCnt-nameCnt) << ","; //wrd_freq_log_zn_corr
-  os << word_freq_log_n << ","; //wrd_freq_zn_log
-
-  int coveredNouns = nounCnt+nameCnt-uncoveredNounCnt;
-  os << proportion( broadNounCnt, coveredNouns ) << ",";  //Conc_nw_ruim_p
-  os << proportion( strictNounCnt, coveredNouns ) << ","; //Conc_nw_strikt_p
-
-  os << density( generalNounCnt, wordCnt ) << ","; //Alg_nw_d
-  os << density( persRefCnt, wordInclCnt ) << ",";  //Pers_ref_d
-  os << density( pron1Cnt+pron2Cnt+pron3Cnt, wordInclCnt ) << ","; //Pers_vnw_d
-  os << proportion( wordInclCnt, sentCnt ) << ","; //Wrd_per_zin
-  os << proportion( wordInclCnt, correctedClauseCnt ) << ","; //Wrd_per_dz
-  os << proportion( contentStrictInclCnt, correctedClauseCnt ) << ",";  //Inhwrd_dz_zonder_abw
-  os << toMString( al_max ) << ","; //AL_max
-
-  double bijzinCnt = betrCnt + bijwCnt + complCnt;
-  os << proportion( bijzinCnt + infinComplBepCnt, sentCnt ) << ","; //Bijzin_per_zin
-
-  int npModCorrectedCnt = max(0, npModCnt - betrCnt);
-  os << proportion( npModCorrectedCnt, correctedClauseCnt ) << ",";  //Bijv_bep_dz_zbijzin
-
-  os << proportion( smallCnjExtraCnt, correctedClauseCnt ) << ",";  //Extra_KConj_dz
-  os << content_mtld_strict << ","; //MTLD_inhwrd_zonder_abw
-}
-
-void structStats::wordDifficultiesHeader( ostream& os ) const {
-  os << "Let_per_wrd,Wrd_per_let,Let_per_wrd_zn,Wrd_per_let_zn,"
-     << "Morf_per_wrd,Wrd_per_morf,Morf_per_wrd_zn,Wrd_per_morf_zn,"
-     << "Namen_p,Namen_d,"
-     << "Wrd_prev,Wrd_prev_z,Inhwrd_prev,Inhwrd_prev_z,Dekking_inhwrd_prev,"
-     << "Freq50_staph,Freq65_Staph,Freq77_Staph,Freq80_Staph,"
-     << "Wrd_freq_log,Lem_freq_log,Lem_freq_zn_log,"
-     << "Wrd_freq_log_zonder_abw,Wrd_freq_zn_log_zonder_abw,Lem_freq_log_zonder_abw,Lem_freq_zn_log_zonder_abw,"
-     << "Freq1000,Freq2000,Freq3000,"
-     << "Freq5000,Freq10000,Freq20000,"
-     << "Freq1000_inhwrd,Freq2000_inhwrd,Freq3000_inhwrd,"
-     << "Freq5000_inhwrd,Freq10000_inhwrd,Freq20000_inhwrd,"
-     << "Freq1000_inhwrd_zonder_abw,Freq2000_inhwrd_zonder_abw,Freq3000_inhwrd_zonder_abw,"
-     << "Freq5000_inhwrd_zonder_abw,Freq10000_inhwrd_zonder_abw,Freq20000_inhwrd_zonder_abw,";
-}
-
-void structStats::wordDifficultiesToCSV( ostream& os ) const {
-  os << std::showpoint
-     << proportion( charCnt, wordCnt ) << ","
-     << proportion( wordCnt, charCnt ) <<  ","
-     << proportion( charCntExNames, (wordCnt-nameCnt) ) << ","
-     << proportion( (wordCnt - nameCnt), charCntExNames ) <<  "," //Wrd_per_let_zn
-     << proportion( morphCnt, wordCnt ) << ","
-     << proportion( wordCnt, morphCnt ) << ","
-     << proportion( morphCntExNames, (wordCnt-nameCnt) ) << ","
-     << proportion( (wordCnt-nameCnt), morphCntExNames ) << "," //Wrd_per_morf_zn
-
-     << proportion( nameCnt, (nameCnt+nounCnt) ) << ","
-     << density( nameCnt, wordCnt ) << ","; //Namen_d
-
-  os << proportion( prevalenceP, prevalenceCovered ) << ",";
-  os << proportion( prevalenceZ, prevalenceCovered ) << ",";
-  os << proportion( prevalenceContentP, prevalenceContentCovered ) << ",";
-  os << proportion( prevalenceContentZ, prevalenceContentCovered ) << ",";
-  os << proportion( prevalenceContentCovered, contentCnt ) << ","; //Dekking_inhwrd_prev
-
-  os << proportion( f50Cnt, wordCnt ) << ",";
-  os << proportion( f65Cnt, wordCnt ) << ",";
-  os << proportion( f77Cnt, wordCnt ) << ",";
-  os << proportion( f80Cnt, wordCnt ) << ","; //Freq80_Staph
-
-  os << word_freq_log << ","; //Wrd_freq_log
-  os << lemma_freq_log << ","; //Lem_freq_log
-  os << lemma_freq_log_n << ","; //Lem_freq_zn_log
-
-  os << word_freq_log_strict << ","; //Wrd_freq_log_zonder_abw
-  os << word_freq_log_n_strict << ","; //Wrd_freq_zn_log_zonder_abw
-  os << lemma_freq_log_strict << ","; //Lem_freq_log_zonder_abw
-  os << lemma_freq_log_n_strict << ","; //Lem_freq_zn_log_zonder_abw
-
-  os << proportion( top1000Cnt, wordCnt ) << ",";
-  os << proportion( top2000Cnt, wordCnt ) << ",";
-  os << proportion( top3000Cnt, wordCnt ) << ",";
-  os << proportion( top5000Cnt, wordCnt ) << ",";
-  os << proportion( top10000Cnt, wordCnt ) << ",";
-  os << proportion( top20000Cnt, wordCnt ) << ",";
-
-  os << proportion( top1000ContentCnt, contentCnt ) << ",";
-  os << proportion( top2000ContentCnt, contentCnt ) << ",";
-  os << proportion( top3000ContentCnt, contentCnt ) << ",";
-  os << proportion( top5000ContentCnt, contentCnt ) << ",";
-  os << proportion( top10000ContentCnt, contentCnt ) << ",";
-  os << proportion( top20000ContentCnt, contentCnt ) << ",";
-
-  os << proportion( top1000ContentStrictCnt, contentStrictCnt ) << ",";
-  os << proportion( top2000ContentStrictCnt, contentStrictCnt ) << ",";
-  os << proportion( top3000ContentStrictCnt, contentStrictCnt ) << ",";
-  os << proportion( top5000ContentStrictCnt, contentStrictCnt ) << ",";
-  os << proportion( top10000ContentStrictCnt, contentStrictCnt ) << ",";
-  os << proportion( top20000ContentStrictCnt, contentStrictCnt ) << ",";
+  else {
+    line.col( "Zin_per_par", sentCnt );
+    line.col( "Wrd_per_par", wordCnt() );
+  }
+  line.col( "Alpino_status", parseFailCnt );
+
+  if ( line.wants( Groups::TOP_PREDICTORS ) )
+    topPredictorsCSV( line );
+  if ( line.wants( Groups::WORD_DIFFICULTIES ) )
+    wordDifficultiesCSV( line );
+  if ( line.wants( Groups::COMPOUND ) )
+    compoundCSV( line );
+  if ( line.wants( Groups::SENT_DIFFICULTIES ) )
+    sentDifficultiesCSV( line );
+  if ( line.wants( Groups::INFORMATION_DENSITY ) )
+    informationDensityCSV( line );
+  if ( line.wants( Groups::COHERENCE ) )
+    coherenceCSV( line );
+  if ( line.wants( Groups::CONCREET ) )
+    concreetCSV( line );
+  if ( line.wants( Groups::PERSOONLIJKHEID ) )
+    persoonlijkheidCSV( line );
+  if ( line.wants( Groups::VERB ) )
+    verbCSV( line );
+  if ( line.wants( Groups::IMPERATIVE ) )
+    imperativeCSV( line );
+  if ( line.wants( Groups::WORD_SORT ) )
+    wordSortCSV( line );
+  if ( line.wants( Groups::PREP_PHRASE ) )
+    prepPhraseCSV( line );
+  if ( line.wants( Groups::INTENS ) )
+    intensCSV( line );
+  if ( line.wants( Groups::FORMAL ) )
+    formalCSV( line );
+  if ( line.wants( Groups::MISC ) )
+    miscCSV( line );
 }
 
-void structStats::compoundHeader( ostream& os ) const {
-  os << "Samenst_d,Samenst_p,Samenst3_d,Samenst3_p,";
-  os << "Let_per_wrd_nw,Let_per_wrd_nsam,Let_per_wrd_sam,";
-  os << "Let_per_wrd_hfdwrd,Let_per_wrd_satwrd,";
-  os << "Let_per_wrd_nw_corr,Let_per_wrd_corr,";
-  os << "Wrd_freq_log_nw,Wrd_freq_log_ong_nw,Wrd_freq_log_sam_nw,";
-  os << "Wrd_freq_log_hfdwrd,Wrd_freq_log_satwrd,Wrd_freq_log_(hfd_sat),";
-  os << "Wrd_freq_log_nw_corr,Wrd_freq_log_corr,";
-  os << "Wrd_freq_log_corr_zonder_abw,";
-  os << "Wrd_freq_log_zn_corr_zonder_abw,";
-  os << "Freq1000_nw,Freq5000_nw,Freq20000_nw,";
-  os << "Freq1000_nsam_nw,Freq5000_nsam_nw,Freq20000_nsam_nw,";
-  os << "Freq1000_sam_nw,Freq5000_sam_nw,Freq20000_sam_nw,";
-  os << "Freq1000_hfdwrd_nw,Freq5000_hfdwrd_nw,Freq20000_hfdwrd_nw,";
-  os << "Freq1000_satwrd_nw,Freq5000_satwrd_nw,Freq20000_satwrd_nw,";
-  os << "Freq1000_nw_corr,Freq5000_nw_corr,Freq20000_nw_corr,";
-  os << "Freq1000_corr,Freq5000_corr,Freq20000_corr,";
+void structStats::topPredictorsCSV( csvLine& line ) const {
+  line.col( "wrd_freq_log_zn_corr", proportion(word_freq_log_n_corr(), contentCnt()-nameCnt()) );
+  line.col( "wrd_freq_zn_log", word_freq_log_n );
+  int coveredNouns = nounCnt()+nameCnt()-uncoveredNounCnt();
+  line.col( "Conc_nw_ruim_p", proportion( broadNounCnt(), coveredNouns ) );
+  line.col( "Conc_nw_strikt_p", proportion( strictNounCnt(), coveredNouns ) );
+  line.col( "Alg_nw_d", density( generalNounCnt(), wordCnt() ) );
+  line.col( "Pers_ref_d", density( persRefCnt(), wordInclCnt() ) );
+  line.col( "Pers_vnw_d", density( pron1Cnt()+pron2Cnt()+pron3Cnt(), wordInclCnt() ) );
+  line.col( "Wrd_per_zin", proportion( wordInclCnt(), sentCnt ) );
+  line.col( "Wrd_per_dz", proportion( wordInclCnt(), correctedClauseCnt() ) );
+  line.col( "Inhwrd_dz_zonder_abw", proportion( contentStrictInclCnt(), correctedClauseCnt() ) );
+  line.col( "AL_max", al_max );
+  double bijzinCnt = betrCnt() + bijwCnt() + complCnt();
+  line.col( "Bijzin_per_zin", proportion( bijzinCnt + infinComplBepCnt(), sentCnt ) );
+  int npModCorrectedCnt = max(0, npModCnt() - betrCnt());
+  line.col( "Bijv_bep_dz_zbijzin", proportion( npModCorrectedCnt, correctedClauseCnt() ) );
+  line.col( "Extra_KConj_dz", proportion( smallCnjExtraCnt(), correctedClauseCnt() ) );
+  line.col( "MTLD_inhwrd_zonder_abw", content_mtld_strict );
 }
 
-void structStats::compoundToCSV( ostream& os ) const {
-  int nonCompoundCnt = nounCnt - compoundCnt;
-  os << density(compoundCnt, wordCnt) << ",";
-  os << proportion(compoundCnt, nounCnt) << ",";
-  os << density(compound3Cnt, wordCnt) << ",";
-  os << proportion(compound3Cnt, nounCnt) << ","; //Samenst3_p
-  os << proportion(charCntNoun, nounCnt) << ",";
-  os << proportion(charCntNonComp, nonCompoundCnt) << ",";
-  os << proportion(charCntComp, compoundCnt) << ","; //Let_per_wrd_sam
-  os << proportion(charCntHead, compoundCnt) << ",";
-  os << proportion(charCntSat, compoundCnt) << ","; //Let_per_wrd_satwrd
-  os << proportion(charCntNounCorr, nounCnt) << ",";
-  os << proportion(charCntCorr, wordCnt) << ","; //Let_per_wrd_corr
-  os << proportion(word_freq_log_noun, nounCnt) << ",";
-  os << proportion(word_freq_log_non_comp, nonCompoundCnt) << ",";
-  os << proportion(word_freq_log_comp, compoundCnt) << ","; //Wrd_freq_log_sam_nw
-  os << proportion(word_freq_log_head, compoundCnt) << ",";
-  os << proportion(word_freq_log_sat, compoundCnt) << ",";
-  os << proportion(word_freq_log_head_sat, compoundCnt) << ","; //Wrd_freq_log_(hfd_sat)
-  os << proportion(word_freq_log_noun_corr, nounCnt) << ",";
-  os << proportion(word_freq_log_corr, contentCnt) << ","; //Wrd_freq_log_corr
-
-  os << proportion(word_freq_log_corr_strict, contentStrictCnt) << ","; //Wrd_freq_log_corr_zonder_abw
-  os << proportion(word_freq_log_n_corr_strict, contentStrictCnt-nameCnt) << ","; //Wrd_freq_log_zn_corr_zonder_abw
-
-  os << proportion(top1000CntNoun, nounCnt) << ",";
-  os << proportion(top5000CntNoun, nounCnt) << ",";
-  os << proportion(top20000CntNoun, nounCnt) << ","; //Freq20000_nw
-  os << proportion(top1000CntNonComp, nonCompoundCnt) << ",";
-  os << proportion(top5000CntNonComp, nonCompoundCnt) << ",";
-  os << proportion(top20000CntNonComp, nonCompoundCnt) << ",";
-  os << proportion(top1000CntComp, compoundCnt) << ",";
-  os << proportion(top5000CntComp, compoundCnt) << ",";
-  os << proportion(top20000CntComp, compoundCnt) << ",";
-  os << proportion(top1000CntHead, compoundCnt) << ",";
-  os << proportion(top5000CntHead, compoundCnt) << ",";
-  os << proportion(top20000CntHead, compoundCnt) << ",";
-  os << proportion(top1000CntSat, compoundCnt) << ",";
-  os << proportion(top5000CntSat, compoundCnt) << ",";
-  os << proportion(top20000CntSat, compoundCnt) << ",";
-  os << proportion(top1000CntNounCorr, nounCnt) << ",";
-  os << proportion(top5000CntNounCorr, nounCnt) << ",";
-  os << proportion(top20000CntNounCorr, nounCnt) << ",";
-  os << proportion(top1000CntCorr, wordCnt) << ",";
-  os << proportion(top5000CntCorr, wordCnt) << ",";
-  os << proportion(top20000CntCorr, wordCnt) << ",";
+void structStats::wordDifficultiesCSV( csvLine& line ) const {
+  line.col( "Let_per_wrd", proportion( charCnt, wordCnt() ) );
+  line.col( "Wrd_per_let", proportion( wordCnt(), charCnt ) );
+  line.col( "Let_per_wrd_zn", proportion( charCntExNames, (wordCnt()-nameCnt()) ) );
+  line.col( "Wrd_per_let_zn", proportion( (wordCnt() - nameCnt()), charCntExNames ) );
+  line.col( "Morf_per_wrd", proportion( morphCnt, wordCnt() ) );
+  line.col( "Wrd_per_morf", proportion( wordCnt(), morphCnt ) );
+  line.col( "Morf_per_wrd_zn", proportion( morphCntExNames, (wordCnt()-nameCnt()) ) );
+  line.col( "Wrd_per_morf_zn", proportion( (wordCnt()-nameCnt()), morphCntExNames ) );
+  line.col( "Namen_p", proportion( nameCnt(), (nameCnt()+nounCnt()) ) );
+  line.col( "Namen_d", density( nameCnt(), wordCnt() ) );
+  line.col( "Wrd_prev", proportion( prevalenceP(), prevalenceCovered() ) );
+  line.col( "Wrd_prev_z", proportion( prevalenceZ(), prevalenceCovered() ) );
+  line.col( "Inhwrd_prev", proportion( prevalenceContentP(), prevalenceContentCovered() ) );
+  line.col( "Inhwrd_prev_z", proportion( prevalenceContentZ(), prevalenceContentCovered() ) );
+  line.col( "Dekking_inhwrd_prev", proportion( prevalenceContentCovered(), contentCnt() ) );
+  line.col( "Freq50_staph", proportion( f50Cnt(), wordCnt() ) );
+  line.col( "Freq65_Staph", proportion( f65Cnt(), wordCnt() ) );
+  line.col( "Freq77_Staph", proportion( f77Cnt(), wordCnt() ) );
+  line.col( "Freq80_Staph", proportion( f80Cnt(), wordCnt() ) );
+  line.col( "Wrd_freq_log", word_freq_log );
+  line.col( "Lem_freq_log", lemma_freq_log );
+  line.col( "Lem_freq_zn_log", lemma_freq_log_n );
+  line.col( "Wrd_freq_log_zonder_abw", word_freq_log_strict );
+  line.col( "Wrd_freq_zn_log_zonder_abw", word_freq_log_n_strict );
+  line.col( "Lem_freq_log_zonder_abw", lemma_freq_log_strict );
+  line.col( "Lem_freq_zn_log_zonder_abw", lemma_freq_log_n_strict );
+  line.col( "Freq1000", proportion( top1000Cnt(), wordCnt() ) );
+  line.col( "Freq2000", proportion( top2000Cnt(), wordCnt() ) );
+  line.col( "Freq3000", proportion( top3000Cnt(), wordCnt() ) );
+  line.col( "Freq5000", proportion( top5000Cnt(), wordCnt() ) );
+  line.col( "Freq10000", proportion( top10000Cnt(), wordCnt() ) );
+  line.col( "Freq20000", proportion( top20000Cnt(), wordCnt() ) );
+  line.col( "Freq1000_inhwrd", proportion( top1000ContentCnt(), contentCnt() ) );
+  line.col( "Freq2000_inhwrd", proportion( top2000ContentCnt(), contentCnt() ) );
+  line.col( "Freq3000_inhwrd", proportion( top3000ContentCnt(), contentCnt() ) );
+  line.col( "Freq5000_inhwrd", proportion( top5000ContentCnt(), contentCnt() ) );
+  line.col( "Freq10000_inhwrd", proportion( top10000ContentCnt(), contentCnt() ) );
+  line.col( "Freq20000_inhwrd", proportion( top20000ContentCnt(), contentCnt() ) );
+  line.col( "Freq1000_inhwrd_zonder_abw", proportion( top1000ContentStrictCnt(), contentStrictCnt() ) );
+  line.col( "Freq2000_inhwrd_zonder_abw", proportion( top2000ContentStrictCnt(), contentStrictCnt() ) );
+  line.col( "Freq3000_inhwrd_zonder_abw", proportion( top3000ContentStrictCnt(), contentStrictCnt() ) );
+  line.col( "Freq5000_inhwrd_zonder_abw", proportion( top5000ContentStrictCnt(), contentStrictCnt() ) );
+  line.col( "Freq10000_inhwrd_zonder_abw", proportion( top10000ContentStrictCnt(), contentStrictCnt() ) );
+  line.col( "Freq20000_inhwrd_zonder_abw", proportion( top20000ContentStrictCnt(), contentStrictCnt() ) );
 }
 
-void structStats::sentDifficultiesHeader( ostream& os ) const {
-  os << "Zin_per_wrd,Dzin_per_wrd,"
-     << "Wrd_per_nwg,"
-     << "Betr_bijzin_per_zin,Bijw_bijzin_per_zin,"
-     << "Compl_bijzin_per_zin,Fin_bijzin_per_zin,"
-     << "Mv_fin_inbed_per_zin,"
-     << "Infin_compl_bep_per_zin,"
-     << "Mv_inbed_per_zin,"
-     << "Betr_bijzin_los,Bijw_compl_bijzin_los,"
-     << "Pv_hzin_per_zin,Pv_bijzin_per_zin,Pv_ww1_per_zin,"
-     << "Hzin_conj,Bijzin_conj,Ww1_conj,"
-     << "Pv_Alpino_per_zin,"
-     << "Pv_Frog_d,Pv_Frog_per_zin,";
-  if ( isSentence() ){
-    os << "D_level,";
-  }
-  else {
-    os  << "D_level,D_level_gt4_p,";
-  }
-  os << "Nom_d,Lijdv_d,Lijdv_dz,Ontk_zin_d,Ontk_zin_dz,"
-     << "Ontk_morf_d,Ontk_morf_dz,Ontk_tot_d,Ontk_tot_dz,"
-     << "Meerv_ontk_d,Meerv_ontk_dz,"
-     << "AL_sub_ww,AL_ob_ww,AL_indirob_ww,AL_ww_vzg,"
-     << "AL_lidw_znw,AL_vz_znw,AL_ww_wwvc,"
-     << "AL_vg_wwbijzin,AL_vg_conj,AL_vg_wwhoofdzin,AL_znw_bijzin,AL_ww_schdw,"
-     << "AL_ww_znwpred,AL_ww_bnwpred,AL_ww_bnwbwp,AL_ww_bwbwp,AL_ww_znwbwp,"
-     << "AL_gem,";
+void structStats::compoundCSV( csvLine& line ) const {
+  int nonCompoundCnt = nounCnt() - compoundCnt();
+  line.col( "Samenst_d", density(compoundCnt(), wordCnt()) );
+  line.col( "Samenst_p", proportion(compoundCnt(), nounCnt()) );
+  line.col( "Samenst3_d", density(compound3Cnt(), wordCnt()) );
+  line.col( "Samenst3_p", proportion(compound3Cnt(), nounCnt()) );
+  line.col( "Let_per_wrd_nw", proportion(charCntNoun(), nounCnt()) );
+  line.col( "Let_per_wrd_nsam", proportion(charCntNonComp(), nonCompoundCnt) );
+  line.col( "Let_per_wrd_sam", proportion(charCntComp(), compoundCnt()) );
+  line.col( "Let_per_wrd_hfdwrd", proportion(charCntHead(), compoundCnt()) );
+  line.col( "Let_per_wrd_satwrd", proportion(charCntSat(), compoundCnt()) );
+  line.col( "Let_per_wrd_nw_corr", proportion(charCntNounCorr(), nounCnt()) );
+  line.col( "Let_per_wrd_corr", proportion(charCntCorr(), wordCnt()) );
+  line.col( "Wrd_freq_log_nw", proportion(word_freq_log_noun(), nounCnt()) );
+  line.col( "Wrd_freq_log_ong_nw", proportion(word_freq_log_non_comp(), nonCompoundCnt) );
+  line.col( "Wrd_freq_log_sam_nw", proportion(word_freq_log_comp(), compoundCnt()) );
+  line.col( "Wrd_freq_log_hfdwrd", proportion(word_freq_log_head(), compoundCnt()) );
+  line.col( "Wrd_freq_log_satwrd", proportion(word_freq_log_sat(), compoundCnt()) );
+  line.col( "Wrd_freq_log_(hfd_sat)", proportion(word_freq_log_head_sat(), compoundCnt()) );
+  line.col( "Wrd_freq_log_nw_corr", proportion(word_freq_log_noun_corr(), nounCnt()) );
+  line.col( "Wrd_freq_log_corr", proportion(word_freq_log_corr(), contentCnt()) );
+  line.col( "Wrd_freq_log_corr_zonder_abw", proportion(word_freq_log_corr_strict(), contentStrictCnt()) );
+  line.col( "Wrd_freq_log_zn_corr_zonder_abw", proportion(word_freq_log_n_corr_strict(), contentStrictCnt()-nameCnt()) );
+  line.col( "Freq1000_nw", proportion(top1000CntNoun(), nounCnt()) );
+  line.col( "Freq5000_nw", proportion(top5000CntNoun(), nounCnt()) );
+  line.col( "Freq20000_nw", proportion(top20000CntNoun(), nounCnt()) );
+  line.col( "Freq1000_nsam_nw", proportion(top1000CntNonComp(), nonCompoundCnt) );
+  line.col( "Freq5000_nsam_nw", proportion(top5000CntNonComp(), nonCompoundCnt) );
+  line.col( "Freq20000_nsam_nw", proportion(top20000CntNonComp(), nonCompoundCnt) );
+  line.col( "Freq1000_sam_nw", proportion(top1000CntComp(), compoundCnt()) );
+  line.col( "Freq5000_sam_nw", proportion(top5000CntComp(), compoundCnt()) );
+  line.col( "Freq20000_sam_nw", proportion(top20000CntComp(), compoundCnt()) );
+  line.col( "Freq1000_hfdwrd_nw", proportion(top1000CntHead(), compoundCnt()) );
+  line.col( "Freq5000_hfdwrd_nw", proportion(top5000CntHead(), compoundCnt()) );
+  line.col( "Freq20000_hfdwrd_nw", proportion(top20000CntHead(), compoundCnt()) );
+  line.col( "Freq1000_satwrd_nw", proportion(top1000CntSat(), compoundCnt()) );
+  line.col( "Freq5000_satwrd_nw", proportion(top5000CntSat(), compoundCnt()) );
+  line.col( "Freq20000_satwrd_nw", proportion(top20000CntSat(), compoundCnt()) );
+  line.col( "Freq1000_nw_corr", proportion(top1000CntNounCorr(), nounCnt()) );
+  line.col( "Freq5000_nw_corr", proportion(top5000CntNounCorr(), nounCnt()) );
+  line.col( "Freq20000_nw_corr", proportion(top20000CntNounCorr(), nounCnt()) );
+  line.col( "Freq1000_corr", proportion(top1000CntCorr(), wordCnt()) );
+  line.col( "Freq5000_corr", proportion(top5000CntCorr(), wordCnt()) );
+  line.col( "Freq20000_corr", proportion(top20000CntCorr(), wordCnt()) );
 }
 
-void structStats::sentDifficultiesToCSV( ostream& os ) const {
-  os << proportion( sentCnt, wordInclCnt )  << ","; //Zin_per_wrd
-  os << proportion( correctedClauseCnt, wordInclCnt )  << ","; //Dzin_per_wrd
-  if ( isSentence() && parseFailCnt > 0 ) {
-    os << "NA,";
-  }
-  else {
-    os << proportion( wordInclCnt, sentCnt ) << ","; //Wrd_per_nwg
-  }
-
-  double bijzinCnt = betrCnt + bijwCnt + complCnt;
-  if ( isSentence() && parseFailCnt > 0 ) {
-    os << "NA,NA,NA,NA,NA,NA,NA,NA,NA,NA,";
-  }
-  else {
-    os << proportion( betrCnt, sentCnt ) << ","; //Betr_bijzin_per_zin
-    os << proportion( bijwCnt, sentCnt ) << ","; // Bijw_bijzin_per_zin
-    os << proportion( complCnt, sentCnt ) << ","; //Compl_bijzin_per_zin
-    os << proportion( bijzinCnt, sentCnt ) << ","; //Fin_bijzin_per_zin
-    os << proportion( mvFinInbedCnt, sentCnt ) << ","; //Mv_fin_inbed_per_zin
-    os << proportion( infinComplBepCnt, sentCnt ) << ","; // Infin_compl_bep_per_zin
-    os << proportion( mvInbedCnt, sentCnt ) << ","; //Mv_inbed_per_zin
-    os << proportion( losBetrCnt, sentCnt ) << ","; //Betr_bijzin_los
-    os << proportion( losBijwCnt, sentCnt ) << ","; //Bijw_compl_bijzin_los
-  }
-
-  if ( isSentence() && parseFailCnt > 0 ) { 
-    os << "NA,NA,NA,NA,NA,NA,NA,";
-  }
-  else {
-    os << proportion( smainCnt, sentCnt ) << ",";
-    os << proportion( ssubCnt, sentCnt ) << ",";
-    os << proportion( sv1Cnt, sentCnt ) << ",";
-    os << proportion( smainCnjCnt, sentCnt ) << ",";
-    os << proportion( ssubCnjCnt, sentCnt ) << ",";
-    os << proportion( sv1CnjCnt, sentCnt ) << ",";
-    os << proportion( clauseCnt, sentCnt ) << ",";
-  }
-
-  double frogClauseCnt = pastCnt + presentCnt;
-  os << density( frogClauseCnt, wordInclCnt ) << ",";
-  os << proportion( frogClauseCnt, sentCnt ) << ",";
-
-  os << proportion( dLevel, sentCnt ) << ",";
+void structStats::sentDifficultiesCSV( csvLine& line ) const {
+  line.col( "Zin_per_wrd", proportion( sentCnt, wordInclCnt() ) );
+  line.col( "Dzin_per_wrd", proportion( correctedClauseCnt(), wordInclCnt() ) );
+
+  // the clause structure of a sentence that Alpino failed on is unknown
+  line.missing( isSentence() && parseFailCnt > 0 );
+  line.col( "Wrd_per_nwg", proportion( wordInclCnt(), sentCnt ) );
+
+  double bijzinCnt = betrCnt() + bijwCnt() + complCnt();
+  line.col( "Betr_bijzin_per_zin", proportion( betrCnt(), sentCnt ) );
+  line.col( "Bijw_bijzin_per_zin", proportion( bijwCnt(), sentCnt ) );
+  line.col( "Compl_bijzin_per_zin", proportion( complCnt(), sentCnt ) );
+  line.col( "Fin_bijzin_per_zin", proportion( bijzinCnt, sentCnt ) );
+  line.col( "Mv_fin_inbed_per_zin", proportion( mvFinInbedCnt(), sentCnt ) );
+  line.col( "Infin_compl_bep_per_zin", proportion( infinComplBepCnt(), sentCnt ) );
+  line.col( "Mv_inbed_per_zin", proportion( mvInbedCnt(), sentCnt ) );
+  line.col( "Betr_bijzin_los", proportion( losBetrCnt(), sentCnt ) );
+  line.col( "Bijw_compl_bijzin_los", proportion( losBijwCnt(), sentCnt ) );
+
+  line.col( "Pv_hzin_per_zin", proportion( smainCnt(), sentCnt ) );
+  line.col( "Pv_bijzin_per_zin", proportion( ssubCnt(), sentCnt ) );
+  line.col( "Pv_ww1_per_zin", proportion( sv1Cnt(), sentCnt ) );
+  line.col( "Hzin_conj", proportion( smainCnjCnt(), sentCnt ) );
+  line.col( "Bijzin_conj", proportion( ssubCnjCnt(), sentCnt ) );
+  line.col( "Ww1_conj", proportion( sv1CnjCnt(), sentCnt ) );
+  line.col( "Pv_Alpino_per_zin", proportion( clauseCnt(), sentCnt ) );
+  line.missing( false );
+
+  double frogClauseCnt = pastCnt() + presentCnt();
+  line.col( "Pv_Frog_d", density( frogClauseCnt, wordInclCnt() ) );
+  line.col( "Pv_Frog_per_zin", proportion( frogClauseCnt, sentCnt ) );
+
+  line.col( "D_level", proportion( dLevel, sentCnt ) );
   if ( !isSentence() ){
-    os << proportion( dLevel_gt4, sentCnt ) << ",";
+    line.col( "D_level_gt4_p", proportion( dLevel_gt4(), sentCnt ) );
   }
-  os << density( nominalCnt, wordCnt ) << ",";
-  os << density( passiveCnt, wordInclCnt ) << ",";
-  os << proportion( passiveCnt, correctedClauseCnt ) << ",";
-  os << density( propNegCnt, wordInclCnt ) << ",";
-  os << proportion( propNegCnt, correctedClauseCnt ) << ",";
-  os << density( morphNegCnt, wordInclCnt ) << ",";
-  os << proportion( morphNegCnt, correctedClauseCnt ) << ",";
-  os << density( propNegCnt+morphNegCnt, wordInclCnt ) << ",";
-  os << proportion( propNegCnt+morphNegCnt, correctedClauseCnt ) << ",";
-  os << density( multiNegCnt, wordInclCnt ) << ",";
-  os << proportion( multiNegCnt, correctedClauseCnt ) << ",";
-  os << MMtoString( distances, SUB_VERB ) << ",";
-  os << MMtoString( distances, OBJ1_VERB ) << ",";
-  os << MMtoString( distances, OBJ2_VERB ) << ",";
-  os << MMtoString( distances, VERB_PP ) << ",";
-  os << MMtoString( distances, NOUN_DET ) << ",";
-  os << MMtoString( distances, PREP_OBJ1 ) << ",";
-  os << MMtoString( distances, VERB_VC ) << ",";
-  os << MMtoString( distances, COMP_BODY ) << ",";
-  os << MMtoString( distances, CRD_CNJ ) << ",";
-  os << MMtoString( distances, VERB_COMP ) << ",";
-  os << MMtoString( distances, NOUN_VC ) << ",";
-  os << MMtoString( distances, VERB_SVP ) << ",";
-  os << MMtoString( distances, VERB_PREDC_N ) << ",";
-  os << MMtoString( distances, VERB_PREDC_A ) << ",";
-  os << MMtoString( distances, VERB_MOD_A ) << ",";
-  os << MMtoString( distances, VERB_MOD_BW ) << ",";
-  os << MMtoString( distances, VERB_NOUN ) << ",";
-  os << toMString( al_gem ) << ",";
+  line.col( "Nom_d", density( nominalCnt(), wordCnt() ) );
+  line.col( "Lijdv_d", density( passiveCnt(), wordInclCnt() ) );
+  line.col( "Lijdv_dz", proportion( passiveCnt(), correctedClauseCnt() ) );
+  line.col( "Ontk_zin_d", density( propNegCnt(), wordInclCnt() ) );
+  line.col( "Ontk_zin_dz", proportion( propNegCnt(), correctedClauseCnt() ) );
+  line.col( "Ontk_morf_d", density( morphNegCnt(), wordInclCnt() ) );
+  line.col( "Ontk_morf_dz", proportion( morphNegCnt(), correctedClauseCnt() ) );
+  line.col( "Ontk_tot_d", density( propNegCnt()+morphNegCnt(), wordInclCnt() ) );
+  line.col( "Ontk_tot_dz", proportion( propNegCnt()+morphNegCnt(), correctedClauseCnt() ) );
+  line.col( "Meerv_ontk_d", density( multiNegCnt(), wordInclCnt() ) );
+  line.col( "Meerv_ontk_dz", proportion( multiNegCnt(), correctedClauseCnt() ) );
+  line.col( "AL_sub_ww", MMaverage( distances, SUB_VERB ) );
+  line.col( "AL_ob_ww", MMaverage( distances, OBJ1_VERB ) );
+  line.col( "AL_indirob_ww", MMaverage( distances, OBJ2_VERB ) );
+  line.col( "AL_ww_vzg", MMaverage( distances, VERB_PP ) );
+  line.col( "AL_lidw_znw", MMaverage( distances, NOUN_DET ) );
+  line.col( "AL_vz_znw", MMaverage( distances, PREP_OBJ1 ) );
+  line.col( "AL_ww_wwvc", MMaverage( distances, VERB_VC ) );
+  line.col( "AL_vg_wwbijzin", MMaverage( distances, COMP_BODY ) );
+  line.col( "AL_vg_conj", MMaverage( distances, CRD_CNJ ) );
+  line.col( "AL_vg_wwhoofdzin", MMaverage( distances, VERB_COMP ) );
+  line.col( "AL_znw_bijzin", MMaverage( distances, NOUN_VC ) );
+  line.col( "AL_ww_schdw", MMaverage( distances, VERB_SVP ) );
+  line.col( "AL_ww_znwpred", MMaverage( distances, VERB_PREDC_N ) );
+  line.col( "AL_ww_bnwpred", MMaverage( distances, VERB_PREDC_A ) );
+  line.col( "AL_ww_bnwbwp", MMaverage( distances, VERB_MOD_A ) );
+  line.col( "AL_ww_bwbwp", MMaverage( distances, VERB_MOD_BW ) );
+  line.col( "AL_ww_znwbwp", MMaverage( distances, VERB_NOUN ) );
+  line.col( "AL_gem", al_gem );
 }
 
-void structStats::infoHeader( ostream& os ) const {
-  os << "Bijw_bep_d,Bijw_bep_dz,Bijw_bep_dz_zbijzin,"
-     << "Bijw_bep_alg_d,Bijw_bep_alg_dz,"
-     << "Bijv_bep_d,Bijv_bep_dz,"
-     << "Attr_bijv_nw_d,Attr_bijv_nw_dz,"
-     << "Ov_bijv_bep_d,Ov_bijv_bep_dz,"
-     << "KConj_per_zin,Extra_KConj_per_zin,"
-     << "KConj_dz,"
-     << "Props_dz_tot,"
-     << "TTR_wrd,MTLD_wrd,TTR_lem,MTLD_lem,"
-     << "TTR_namen,MTLD_namen,"
-     << "TTR_inhwrd,MTLD_inhwrd,"
-     << "TTR_inhwrd_zonder_abw,"
-     << "Inhwrd_d,Inhwrd_dz,"
-     << "Inhwrd_d_zonder_abw,"
-     << "Zeldz_index,"
-     << "Vnw_ref_d,Vnw_ref_dz,"
-     << "Arg_over_vzin_d,Arg_over_vzin_dz,Lem_over_vzin_d,Lem_over_vzin_dz,"
-     << "Arg_over_buf_d,Arg_over_buf_dz,Lem_over_buf_d,Lem_over_buf_dz,"
-     << "Onbep_nwg_p,Onbep_nwg_dz,";
-}
+void structStats::informationDensityCSV( csvLine& line ) const {
+  line.col( "Bijw_bep_d", density( vcModCnt(), wordInclCnt() ) );
+  line.col( "Bijw_bep_dz", proportion( vcModCnt(), correctedClauseCnt() ) );
 
-void structStats::informationDensityToCSV( ostream& os ) const {
-  os << density( vcModCnt, wordInclCnt ) << ","; //Bijw_bep_d
-  os << proportion( vcModCnt, correctedClauseCnt ) << ","; //Bijw_bep_dz
+  int vcModCorrectedCnt = max(0, vcModCnt() - bijwCnt());
+  line.col( "Bijw_bep_dz_zbijzin", proportion( vcModCorrectedCnt, correctedClauseCnt() ) );
 
-  int vcModCorrectedCnt = max(0, vcModCnt - bijwCnt);
-  os << proportion( vcModCorrectedCnt, correctedClauseCnt ) << ","; //Bijw_bep_dz_zbijzin
+  line.col( "Bijw_bep_alg_d", density( vcModSingleCnt(), wordInclCnt() ) );
+  line.col( "Bijw_bep_alg_dz", proportion( vcModSingleCnt(), correctedClauseCnt() ) );
 
-  os << density( vcModSingleCnt, wordInclCnt ) << ",";
-  os << proportion( vcModSingleCnt, correctedClauseCnt ) << ","; //Bijw_bep_alg_dz
+  line.col( "Bijv_bep_d", density( npModCnt(), wordInclCnt() ) );
+  line.col( "Bijv_bep_dz", proportion( npModCnt(), correctedClauseCnt() ) );
 
-  os << density( npModCnt, wordInclCnt ) << ","; //Bijv_bep_d
-  os << proportion( npModCnt, correctedClauseCnt ) << ","; //Bijv_bep_dz
+  int npModCorrectedCnt = max(0, npModCnt() - betrCnt());
 
-  int npModCorrectedCnt = max(0, npModCnt - betrCnt);
+  line.col( "Attr_bijv_nw_d", density( adjNpModCnt(), wordInclCnt() ) );
+  line.col( "Attr_bijv_nw_dz", proportion( adjNpModCnt(), correctedClauseCnt() ) );
 
-  os << density( adjNpModCnt, wordInclCnt ) << ",";
-  os << proportion( adjNpModCnt, correctedClauseCnt ) << ","; //Attr_bijv_nw_dz
+  line.col( "Ov_bijv_bep_d", density( npModCnt()-adjNpModCnt(), wordInclCnt() ) );
+  line.col( "Ov_bijv_bep_dz", proportion( npModCnt()-adjNpModCnt(), correctedClauseCnt() ) );
 
-  os << density( npModCnt-adjNpModCnt, wordInclCnt ) << ",";
-  os << proportion( npModCnt-adjNpModCnt, correctedClauseCnt ) << ","; //Ov_bijv_bep_dz
+  line.col( "KConj_per_zin", proportion( smallCnjCnt(), sentCnt ) );
+  line.col( "Extra_KConj_per_zin", proportion( smallCnjExtraCnt(), sentCnt ) );
+  line.col( "KConj_dz", proportion( smallCnjCnt(), correctedClauseCnt() ) );
 
-  os << proportion( smallCnjCnt, sentCnt ) << ","; //KConj_per_zin
-  os << proportion( smallCnjExtraCnt, sentCnt ) << ","; //Extra_KConj_per_zin
-  os << proportion( smallCnjCnt, correctedClauseCnt ) << ","; //KConj_dz
+  int propositionCount = vcModCorrectedCnt + npModCorrectedCnt + smallCnjExtraCnt();
+  double propositionPr = proportion( propositionCount, correctedClauseCnt() ).p + 1.0;
+  line.col( "Props_dz_tot", propositionPr );
 
-  int propositionCount = vcModCorrectedCnt + npModCorrectedCnt + smallCnjExtraCnt;
-  double propositionPr = proportion( propositionCount, correctedClauseCnt ).p + 1.0;
-  os << propositionPr << ","; //Props_dz_tot
+  line.col( "TTR_wrd", proportion( unique_words.size(), wordInclCnt() ) );
+  line.col( "MTLD_wrd", word_mtld );
 
-  os << proportion( unique_words.size(), wordInclCnt ) << ","; //TTR_wrd
-  os << word_mtld << ","; //MTLD_wrd
+  line.col( "TTR_lem", proportion( unique_lemmas.size(), wordInclCnt() ) );
+  line.col( "MTLD_lem", lemma_mtld );
 
-  os << proportion( unique_lemmas.size(), wordInclCnt ) << ","; //TTR_lem
-  os << lemma_mtld << ","; //MTLD_lem
+  line.col( "TTR_namen", proportion( unique_names.size(), nameInclCnt() ) );
+  line.col( "MTLD_namen", name_mtld );
 
-  os << proportion( unique_names.size(), nameInclCnt ) << ",";
-  os << name_mtld << ","; //MTLD_namen
+  line.col( "TTR_inhwrd", proportion( unique_contents.size(), contentInclCnt() ) );
+  line.col( "MTLD_inhwrd", content_mtld );
 
-  os << proportion( unique_contents.size(), contentInclCnt ) << ",";
-  os << content_mtld << ","; //MTLD_inhwrd
+  line.col( "TTR_inhwrd_zonder_abw", proportion( unique_contents_strict.size(), contentStrictInclCnt() ) );
 
-  os << proportion( unique_contents_strict.size(), contentStrictInclCnt ) << ","; //TTR_inhwrd_zonder_abw
+  line.col( "Inhwrd_d", density( contentInclCnt(), wordInclCnt() ) );
+  line.col( "Inhwrd_dz", proportion( contentInclCnt(), correctedClauseCnt() ) );
 
-  os << density( contentInclCnt, wordInclCnt ) << ","; //Inhwrd_d
-  os << proportion( contentInclCnt, correctedClauseCnt ) << ","; //Inhwrd_dz
+  line.col( "Inhwrd_d_zonder_abw", density( contentStrictInclCnt(), wordInclCnt() ) );
 
-  os << density( contentStrictInclCnt, wordInclCnt ) << ","; //Inhwrd_d_zonder_abw
+  line.col( "Zeldz_index", rarity( rarityLevel ) );
 
-  double rare = rarity( rarityLevel ); //Zeldz_index
-  if (std::isnan(rare)) {
-    os << "NA" << ",";
-  }
-  else {
-    os << rare << ",";
-  }
-  
-  os << density( pronRefCnt, wordInclCnt ) << ",";
-  os << proportion( pronRefCnt, correctedClauseCnt ) << ",";
+  line.col( "Vnw_ref_d", density( pronRefCnt(), wordInclCnt() ) );
+  line.col( "Vnw_ref_dz", proportion( pronRefCnt(), correctedClauseCnt() ) );
   if ( isSentence() ){
-    if ( index == 0 ){
-      os << "NA,NA,"
-   << "NA,NA,";
-    }
-    else {
-      os << density( wordOverlapCnt, wordInclCnt ) << ",NA,"
-   << density( lemmaOverlapCnt, wordInclCnt ) << ",NA,";
-    }
-  }
-  else {
-    os << density( wordOverlapCnt, wordInclCnt ) << ",";
-    os << proportion( wordOverlapCnt, correctedClauseCnt ) << ",";
-    os << density( lemmaOverlapCnt, wordInclCnt ) << ",";
-    os << proportion( lemmaOverlapCnt, correctedClauseCnt ) << ",";
-  }
-  if ( !isDocument() ){
-    os << "NA,NA,NA,NA,";
+    // the first sentence has no previous one to overlap with
+    line.missing( index == 0 );
+    line.col( "Arg_over_vzin_d", density( wordOverlapCnt(), wordInclCnt() ) );
+    line.na( "Arg_over_vzin_dz" );
+    line.col( "Lem_over_vzin_d", density( lemmaOverlapCnt(), wordInclCnt() ) );
+    line.na( "Lem_over_vzin_dz" );
+    line.missing( false );
   }
   else {
-    os << density( word_overlapCnt(), wordInclCnt - overlapSize ) << ",";
-    os << proportion( word_overlapCnt(), correctedClauseCnt ) << ",";
-    os << density( lemma_overlapCnt(), wordInclCnt - overlapSize ) << ",";
-    os << proportion( lemma_overlapCnt(), correctedClauseCnt ) << ",";
+    line.col( "Arg_over_vzin_d", density( wordOverlapCnt(), wordInclCnt() ) );
+    line.col( "Arg_over_vzin_dz", proportion( wordOverlapCnt(), correctedClauseCnt() ) );
+    line.col( "Lem_over_vzin_d", density( lemmaOverlapCnt(), wordInclCnt() ) );
+    line.col( "Lem_over_vzin_dz", proportion( lemmaOverlapCnt(), correctedClauseCnt() ) );
   }
-  os << proportion( indefNpCnt, npCnt ) << ",";
-  os << proportion( indefNpCnt, correctedClauseCnt ) << ",";
-}
-
-void structStats::coherenceHeader( ostream& os ) const {
-  os << "Conn_d,Conn_dz,Conn_TTR,Conn_MTLD,"
-     << "Conn_temp_d,Conn_temp_dz,Conn_temp_TTR,Conn_temp_MTLD,"
-     << "Conn_reeks_wg_d,Conn_reeks_wg_dz,Conn_reeks_wg_TTR,Conn_reeks_wg_MTLD,"
-     << "Conn_reeks_zin_d,Conn_reeks_zin_dz,Conn_reeks_zin_TTR,Conn_reeks_zin_MTLD,"
-     << "Conn_contr_d,Conn_contr_dz,Conn_contr_TTR,Conn_contr_MTLD,"
-     << "Conn_comp_d,Conn_comp_dz,Conn_comp_TTR,Conn_comp_MTLD,"
-     << "Conn_caus_d,Conn_caus_dz,Conn_caus_TTR,Conn_caus_MTLD,"
-     << "Causaal_d,Ruimte_d,Tijd_d,Emotie_d,"
-     << "Causaal_TTR,Causaal_MTLD,"
-     << "Ruimte_TTR,Ruimte_MTLD,"
-     << "Tijd_TTR,Tijd_MTLD,"
-     << "Emotie_TTR,Emotie_MTLD,";
-}
-
-void structStats::coherenceToCSV( ostream& os ) const {
-  os << density( allConnCnt, wordInclCnt ) << ",";
-  os << proportion( allConnCnt, correctedClauseCnt ) << ",";
-  os << proportion( unique_all_conn.size(), allConnCnt ) << ",";
-  os << all_conn_mtld << ",";
-  os << density( tempConnCnt, wordInclCnt ) << ",";
-  os << proportion( tempConnCnt, correctedClauseCnt ) << ",";
-  os << proportion( unique_temp_conn.size(), tempConnCnt ) << ",";
-  os << temp_conn_mtld << ",";
-  os << density( opsomWgConnCnt, wordInclCnt ) << ",";
-  os << proportion( opsomWgConnCnt, correctedClauseCnt ) << ",";
-  os << proportion( unique_reeks_wg_conn.size(), opsomWgConnCnt ) << ",";
-  os << reeks_zin_conn_mtld << ",";
-  os << density( opsomZinConnCnt, wordInclCnt ) << ",";
-  os << proportion( opsomZinConnCnt, correctedClauseCnt ) << ",";
-  os << proportion( unique_reeks_zin_conn.size(), opsomZinConnCnt ) << ",";
-  os << reeks_zin_conn_mtld << ",";
-  os << density( contrastConnCnt, wordInclCnt ) << ",";
-  os << proportion( contrastConnCnt, correctedClauseCnt ) << ",";
-  os << proportion( unique_contr_conn.size(), contrastConnCnt ) << ",";
-  os << contr_conn_mtld << ",";
-  os << density( compConnCnt, wordInclCnt ) << ",";
-  os << proportion( compConnCnt, correctedClauseCnt ) << ",";
-  os << proportion( unique_comp_conn.size(), compConnCnt ) << ",";
-  os << comp_conn_mtld << ",";
-  os << density( causeConnCnt, wordInclCnt ) << ",";
-  os << proportion( causeConnCnt, correctedClauseCnt ) << ",";
-  os << proportion( unique_cause_conn.size(), causeConnCnt ) << ",";
-  os << cause_conn_mtld << ",";
-
-  os << density( causeSitCnt, wordInclCnt ) << ",";
-  os << density( spaceSitCnt, wordInclCnt ) << ",";
-  os << density( timeSitCnt, wordInclCnt ) << ",";
-  os << density( emoSitCnt, wordInclCnt ) << ",";
-  os << proportion( unique_cause_sits.size(), causeSitCnt ) << ",";
-  os << cause_sit_mtld << ",";
-  os << proportion( unique_ruimte_sits.size(), spaceSitCnt ) << ",";
-  os << ruimte_sit_mtld << ",";
-  os << proportion( unique_tijd_sits.size(), timeSitCnt ) << ",";
-  os << tijd_sit_mtld << ",";
-  os << proportion( unique_emotion_sits.size(), emoSitCnt ) << ",";
-  os << emotion_sit_mtld << ",";
+  // the overlap within the buffer is only known for the whole document
+  line.missing( !isDocument() );
+  line.col( "Arg_over_buf_d", density( word_overlapCnt(), wordInclCnt() - overlapSize ) );
+  line.col( "Arg_over_buf_dz", proportion( word_overlapCnt(), correctedClauseCnt() ) );
+  line.col( "Lem_over_buf_d", density( lemma_overlapCnt(), wordInclCnt() - overlapSize ) );
+  line.col( "Lem_over_buf_dz", proportion( lemma_overlapCnt(), correctedClauseCnt() ) );
+  line.missing( false );
+  line.col( "Onbep_nwg_p", proportion( indefNpCnt(), npCnt() ) );
+  line.col( "Onbep_nwg_dz", proportion( indefNpCnt(), correctedClauseCnt() ) );
 }
 
-void structStats::concreetHeader( ostream& os ) const {
-  os << "Conc_nw_strikt_d,";
-  os << "Conc_nw_ruim_d,";
-  os << "Pers_nw_p,Pers_nw_d,";
-  os << "PlantDier_nw_p,PlantDier_nw_d,";
-  os << "Gebr_vw_nw_p,Gebr_vw_nw_d,"; // 20141003: Features renamed
-  os << "Subst_conc_nw_p,Subst_conc_nw_d,"; // 20150508: Features renamed
-  os << "Voed_verz_nw_p,Voed_verz_nw_d,"; // 20150508: Features added
-  os << "Concr_ov_nw_p,Concr_ov_nw_d,";
-  os << "Gebeuren_conc_nw_p,Gebeuren_conc_nw_d,"; // 20141031: Features split
-  os << "Plaats_nw_p,Plaats_nw_d,";
-  os << "Tijd_nw_p,Tijd_nw_d,";
-  os << "Maat_nw_p,Maat_nw_d,";
-  os << "Subst_abstr_nw_p,Subst_abstr_nw_d,"; // 20150508: Features added
-  os << "Gebeuren_abstr_nw_p,Gebeuren_abstr_nw_d,"; // 20141031: Features split
-  os << "Organisatie_nw_p,Organisatie_nw_d,";
-  os << "Ov_abstr_nw_p,Ov_abstr_nw_d,"; // 20150508: Features renamed
-  os << "Undefined_nw_p,";
-  os << "Gedekte_nw_p,";
-  os << "Alg_nw_p,";
-  os << "Alg_nw_afz_sit_d,Alg_nw_afz_sit_p,";
-  os << "Alg_nw_rel_sit_d,Alg_nw_rel_sit_p,";
-  os << "Alg_nw_hand_d,Alg_nw_hand_p,";
-  os << "Alg_nw_kenn_d,Alg_nw_kenn_p,";
-  os << "Alg_nw_disc_caus_d,Alg_nw_disc_caus_p,";
-  os << "Alg_nw_ontw_d,Alg_nw_ontw_p,";
-  os << "Waarn_mens_bvnw_p,Waarn_mens_bvnw_d,";
-  os << "Emosoc_bvnw_p,Emosoc_bvnw_d,";
-  os << "Waarn_nmens_bvnw_p,Waarn_nmens_bvnw_d,";
-  os << "Vorm_omvang_bvnw_p,Vorm_omvang_bvnw_d,";
-  os << "Kleur_bvnw_p,Kleur_bvnw_d,";
-  os << "Stof_bvnw_p,Stof_bvnw_d,";
-  os << "Geluid_bvnw_p,Geluid_bvnw_d,";
-  os << "Waarn_nmens_ov_bvnw_p,Waarn_nmens_ov_bvnw_d,";
-  os << "Technisch_bvnw_p,Technisch_bvnw_d,";
-  os << "Tijd_bvnw_p,Tijd_bvnw_d,";
-  os << "Plaats_bvnw_p,Plaats_bvnw_d,";
-  os << "Spec_positief_bvnw_p,Spec_positief_bvnw_d,";
-  os << "Spec_negatief_bvnw_p,Spec_negatief_bvnw_d,";
-  os << "Alg_positief_bvnw_p,Alg_positief_bvnw_d,";
-  os << "Alg_negatief_bvnw_p,Alg_negatief_bvnw_d,";
-  os << "Alg_ev_zr_bvnw_p,Alg_ev_zr_bvnw_d,"; // 20150316: Features added
-  os << "Ep_positief_bvnw_p,Ep_positief_bvnw_d,";
-  os << "Ep_negatief_bvnw_p,Ep_negatief_bvnw_d,";
-  os << "Ov_abstr_bvnw_p,Ov_abstr_bvnw_d,"; // 20151020: Features renamed
-  os << "Spec_ev_bvnw_p,Spec_ev_bvnw_d,"; // 20150316: Features renamed
-  os << "Alg_ev_bvnw_p,Alg_ev_bvnw_d,"; // 20150316: Features renamed
-  os << "Ep_ev_bvnw_p,Ep_ev_bvnw_d,"; // 20150316: Features renamed
-  os << "Conc_bvnw_strikt_p,Conc_bvnw_strikt_d,";
-  os << "Conc_bvnw_ruim_p,Conc_bvnw_ruim_d,";
-  os << "Subj_bvnw_p,Subj_bvnw_d,";
-  os << "Undefined_bvnw_p,";
-  os << "Gelabeld_bvnw_p,";
-  os << "Gedekte_bvnw_p,";
-  os << "Conc_ww_p,Conc_ww_d,";
-  os << "Abstr_ww_p,Abstr_ww_d,";
-  os << "Undefined_ww_p,";
-  os << "Gedekte_ww_p,";
-  os << "Alg_ww_d,Alg_ww_p,";
-  os << "Alg_ww_afz_sit_d,Alg_ww_afz_sit_p,";
-  os << "Alg_ww_rel_sit_d,Alg_ww_rel_sit_p,";
-  os << "Alg_ww_hand_d,Alg_ww_hand_p,";
-  os << "Alg_ww_kenn_d,Alg_ww_kenn_p,";
-  os << "Alg_ww_disc_caus_d,Alg_ww_disc_caus_p,";
-  os << "Alg_ww_ontw_d,Alg_ww_ontw_p,";
-  os << "Conc_tot_p,Conc_tot_d,";
-  os << "Alg_bijw_d,Alg_bijw_p,";
-  os << "Spec_bijw_d,Spec_bijw_p,";
-  os << "Gedekte_bw_p,";
+void structStats::coherenceCSV( csvLine& line ) const {
+  line.col( "Conn_d", density( allConnCnt(), wordInclCnt() ) );
+  line.col( "Conn_dz", proportion( allConnCnt(), correctedClauseCnt() ) );
+  line.col( "Conn_TTR", proportion( unique_all_conn.size(), allConnCnt() ) );
+  line.col( "Conn_MTLD", all_conn_mtld );
+  line.col( "Conn_temp_d", density( tempConnCnt(), wordInclCnt() ) );
+  line.col( "Conn_temp_dz", proportion( tempConnCnt(), correctedClauseCnt() ) );
+  line.col( "Conn_temp_TTR", proportion( unique_temp_conn.size(), tempConnCnt() ) );
+  line.col( "Conn_temp_MTLD", temp_conn_mtld );
+  line.col( "Conn_reeks_wg_d", density( opsomWgConnCnt(), wordInclCnt() ) );
+  line.col( "Conn_reeks_wg_dz", proportion( opsomWgConnCnt(), correctedClauseCnt() ) );
+  line.col( "Conn_reeks_wg_TTR", proportion( unique_reeks_wg_conn.size(), opsomWgConnCnt() ) );
+  line.col( "Conn_reeks_wg_MTLD", reeks_zin_conn_mtld );
+  line.col( "Conn_reeks_zin_d", density( opsomZinConnCnt(), wordInclCnt() ) );
+  line.col( "Conn_reeks_zin_dz", proportion( opsomZinConnCnt(), correctedClauseCnt() ) );
+  line.col( "Conn_reeks_zin_TTR", proportion( unique_reeks_zin_conn.size(), opsomZinConnCnt() ) );
+  line.col( "Conn_reeks_zin_MTLD", reeks_zin_conn_mtld );
+  line.col( "Conn_contr_d", density( contrastConnCnt(), wordInclCnt() ) );
+  line.col( "Conn_contr_dz", proportion( contrastConnCnt(), correctedClauseCnt() ) );
+  line.col( "Conn_contr_TTR", proportion( unique_contr_conn.size(), contrastConnCnt() ) );
+  line.col( "Conn_contr_MTLD", contr_conn_mtld );
+  line.col( "Conn_comp_d", density( compConnCnt(), wordInclCnt() ) );
+  line.col( "Conn_comp_dz", proportion( compConnCnt(), correctedClauseCnt() ) );
+  line.col( "Conn_comp_TTR", proportion( unique_comp_conn.size(), compConnCnt() ) );
+  line.col( "Conn_comp_MTLD", comp_conn_mtld );
+  line.col( "Conn_caus_d", density( causeConnCnt(), wordInclCnt() ) );
+  line.col( "Conn_caus_dz", proportion( causeConnCnt(), correctedClauseCnt() ) );
+  line.col( "Conn_caus_TTR", proportion( unique_cause_conn.size(), causeConnCnt() ) );
+  line.col( "Conn_caus_MTLD", cause_conn_mtld );
+  line.col( "Causaal_d", density( causeSitCnt(), wordInclCnt() ) );
+  line.col( "Ruimte_d", density( spaceSitCnt(), wordInclCnt() ) );
+  line.col( "Tijd_d", density( timeSitCnt(), wordInclCnt() ) );
+  line.col( "Emotie_d", density( emoSitCnt(), wordInclCnt() ) );
+  line.col( "Causaal_TTR", proportion( unique_cause_sits.size(), causeSitCnt() ) );
+  line.col( "Causaal_MTLD", cause_sit_mtld );
+  line.col( "Ruimte_TTR", proportion( unique_ruimte_sits.size(), spaceSitCnt() ) );
+  line.col( "Ruimte_MTLD", ruimte_sit_mtld );
+  line.col( "Tijd_TTR", proportion( unique_tijd_sits.size(), timeSitCnt() ) );
+  line.col( "Tijd_MTLD", tijd_sit_mtld );
+  line.col( "Emotie_TTR", proportion( unique_emotion_sits.size(), emoSitCnt() ) );
+  line.col( "Emotie_MTLD", emotion_sit_mtld );
 }
 
-void structStats::concreetToCSV( ostream& os ) const {
-  int coveredNouns = nounCnt+nameCnt-uncoveredNounCnt;
-  os << density( strictNounCnt, wordCnt ) << ","; // column: Conc_nw_strikt_d
-  os << density( broadNounCnt, wordCnt ) << ","; // column: Conc_nw_ruim_d
-  os << proportion( humanCnt, coveredNouns ) << ",";
-  os << density( humanCnt, wordCnt ) << ","; // column: Pers_nw_d
-  os << proportion( nonHumanCnt, coveredNouns ) << ",";
-  os << density( nonHumanCnt, wordCnt ) << ","; // column: PlantDier_nw_d
-  os << proportion( artefactCnt, coveredNouns ) << ",";
-  os << density( artefactCnt, wordCnt ) << ","; // column: Gebr_vw_nw_d
-  os << proportion( substanceConcCnt, coveredNouns ) << ",";
-  os << density( substanceConcCnt, wordCnt ) << ","; // column: Subst_conc_nw_d
-  os << proportion( foodcareCnt, coveredNouns ) << ",";
-  os << density( foodcareCnt, wordCnt ) << ","; // column: Voed_verz_nw_d
-  os << proportion( concrotherCnt, coveredNouns ) << ",";
-  os << density( concrotherCnt, wordCnt ) << ","; // column: Concr_ov_nw_d
-  os << proportion( dynamicConcCnt, coveredNouns ) << ",";
-  os << density( dynamicConcCnt, wordCnt ) << ","; // column: Gebeuren_conc_nw_d
-  os << proportion( placeCnt, coveredNouns ) << ",";
-  os << density( placeCnt, wordCnt ) << ","; // column: Plaats_nw_d
-  os << proportion( timeCnt, coveredNouns ) << ",";
-  os << density( timeCnt, wordCnt ) << ","; // column: Tijd_nw_d
-  os << proportion( measureCnt, coveredNouns ) << ",";
-  os << density( measureCnt, wordCnt ) << ","; // column: Maat_nw_d
-  os << proportion( substanceAbstrCnt, coveredNouns ) << ",";
-  os << density( substanceAbstrCnt, wordCnt ) << ","; // column: Subst_abstr_nw_d
-  os << proportion( dynamicAbstrCnt, coveredNouns ) << ",";
-  os << density( dynamicAbstrCnt, wordCnt ) << ","; // column: Gebeuren_abstr_nw_d
-  os << proportion( institutCnt, coveredNouns ) << ",";
-  os << density( institutCnt, wordCnt ) << ","; // column: Organisatie_nw_d
-  os << proportion( nonDynamicCnt, coveredNouns ) << ",";
-  os << density( nonDynamicCnt, wordCnt ) << ","; // column: Ov_abstr_nw_d
-  os << proportion( undefinedNounCnt, coveredNouns ) << ","; // column: Undefined_nw_p
-  os << proportion( coveredNouns, nounCnt + nameCnt ) << ","; // column: Gedekte_nw_p
-
-  os << proportion( generalNounCnt, coveredNouns ) << ","; // column: Alg_nw_p
-  os << density( generalNounSepCnt, wordCnt ) << ",";
-  os << proportion( generalNounSepCnt, coveredNouns ) << ",";
-  os << density( generalNounRelCnt, wordCnt ) << ",";
-  os << proportion( generalNounRelCnt, coveredNouns ) << ",";
-  os << density( generalNounActCnt, wordCnt ) << ",";
-  os << proportion( generalNounActCnt, coveredNouns ) << ",";
-  os << density( generalNounKnowCnt, wordCnt ) << ",";
-  os << proportion( generalNounKnowCnt, coveredNouns ) << ",";
-  os << density( generalNounDiscCnt, wordCnt ) << ",";
-  os << proportion( generalNounDiscCnt, coveredNouns ) << ",";
-  os << density( generalNounDeveCnt, wordCnt ) << ",";
-  os << proportion( generalNounDeveCnt, coveredNouns ) << ",";
-
-  int coveredAdj = adjCnt-uncoveredAdjCnt;
-  os << proportion( humanAdjCnt, coveredAdj ) << ",";
-  os << density( humanAdjCnt,wordCnt ) << ",";
-  os << proportion( emoAdjCnt, coveredAdj ) << ",";
-  os << density( emoAdjCnt,wordCnt ) << ",";
-  os << proportion( nonhumanAdjCnt, coveredAdj ) << ",";
-  os << density( nonhumanAdjCnt,wordCnt ) << ",";
-  os << proportion( shapeAdjCnt, coveredAdj ) << ",";
-  os << density( shapeAdjCnt,wordCnt ) << ",";
-  os << proportion( colorAdjCnt, coveredAdj ) << ",";
-  os << density( colorAdjCnt,wordCnt ) << ",";
-  os << proportion( matterAdjCnt, coveredAdj ) << ",";
-  os << density( matterAdjCnt,wordCnt ) << ",";
-  os << proportion( soundAdjCnt, coveredAdj ) << ",";
-  os << density( soundAdjCnt,wordCnt ) << ",";
-  os << proportion( nonhumanOtherAdjCnt, coveredAdj ) << ",";
-  os << density( nonhumanOtherAdjCnt,wordCnt ) << ",";
-  os << proportion( techAdjCnt, coveredAdj ) << ",";
-  os << density( techAdjCnt,wordCnt ) << ",";
-  os << proportion( timeAdjCnt, coveredAdj ) << ",";
-  os << density( timeAdjCnt,wordCnt ) << ",";
-  os << proportion( placeAdjCnt, coveredAdj ) << ",";
-  os << density( placeAdjCnt,wordCnt ) << ",";
-  os << proportion( specPosAdjCnt, coveredAdj ) << ",";
-  os << density( specPosAdjCnt,wordCnt ) << ",";
-  os << proportion( specNegAdjCnt, coveredAdj ) << ",";
-  os << density( specNegAdjCnt,wordCnt ) << ",";
-  os << proportion( posAdjCnt, coveredAdj ) << ",";
-  os << density( posAdjCnt,wordCnt ) << ",";
-  os << proportion( negAdjCnt, coveredAdj ) << ",";
-  os << density( negAdjCnt,wordCnt ) << ",";
-  os << proportion( evaluativeAdjCnt, coveredAdj ) << ",";
-  os << density( evaluativeAdjCnt,wordCnt ) << ",";
-  os << proportion( epiPosAdjCnt, coveredAdj ) << ",";
-  os << density( epiPosAdjCnt,wordCnt ) << ",";
-  os << proportion( epiNegAdjCnt, coveredAdj ) << ",";
-  os << density( epiNegAdjCnt,wordCnt ) << ",";
-  os << proportion( abstractAdjCnt, coveredAdj ) << ",";
-  os << density( abstractAdjCnt,wordCnt ) << ",";
-  os << proportion( specPosAdjCnt + specNegAdjCnt, coveredAdj ) << ",";
-  os << density( specPosAdjCnt + specNegAdjCnt, wordCnt ) << ",";
-  os << proportion( posAdjCnt + negAdjCnt + evaluativeAdjCnt, coveredAdj ) << ",";
-  os << density( posAdjCnt + negAdjCnt + evaluativeAdjCnt, wordCnt ) << ",";
-  os << proportion( epiPosAdjCnt + epiNegAdjCnt, coveredAdj ) << ",";
-  os << density( epiPosAdjCnt + epiNegAdjCnt ,wordCnt ) << ",";
-  os << proportion( strictAdjCnt, coveredAdj ) << ",";
-  os << density( strictAdjCnt, wordCnt ) << ",";
-  os << proportion( broadAdjCnt, coveredAdj ) << ",";
-  os << density( broadAdjCnt, wordCnt ) << ",";
-  os << proportion( subjectiveAdjCnt ,coveredAdj ) << ",";
-  os << density( subjectiveAdjCnt, wordCnt ) << ",";
-  os << proportion( undefinedAdjCnt, coveredAdj ) << ",";
-  os << proportion( coveredAdj - undefinedAdjCnt ,coveredAdj ) << ",";
-  os << proportion( coveredAdj ,adjCnt ) << ",";
-
-  int coveredVerbs = verbCnt - uncoveredVerbCnt;
-  os << proportion( concreteWwCnt, coveredVerbs ) << ",";
-  os << density( concreteWwCnt, wordCnt ) << ",";
-  os << proportion( abstractWwCnt, coveredVerbs ) << ",";
-  os << density( abstractWwCnt, wordCnt ) << ",";
-  os << proportion( undefinedWwCnt, coveredVerbs ) << ",";
-  os << proportion( coveredVerbs, verbCnt ) << ",";
-
-  os << density( generalVerbCnt, wordCnt ) << ",";
-  os << proportion( generalVerbCnt, coveredVerbs ) << ",";
-  os << density( generalVerbSepCnt, wordCnt ) << ",";
-  os << proportion( generalVerbSepCnt, coveredVerbs ) << ",";
-  os << density( generalVerbRelCnt, wordCnt ) << ",";
-  os << proportion( generalVerbRelCnt, coveredVerbs ) << ",";
-  os << density( generalVerbActCnt, wordCnt ) << ",";
-  os << proportion( generalVerbActCnt, coveredVerbs ) << ",";
-  os << density( generalVerbKnowCnt, wordCnt ) << ",";
-  os << proportion( generalVerbKnowCnt, coveredVerbs ) << ",";
-  os << density( generalVerbDiscCnt, wordCnt ) << ",";
-  os << proportion( generalVerbDiscCnt, coveredVerbs ) << ",";
-  os << density( generalVerbDeveCnt, wordCnt ) << ",";
-  os << proportion( generalVerbDeveCnt, coveredVerbs ) << ",";
-
+void structStats::concreetCSV( csvLine& line ) const {
+  int coveredNouns = nounCnt()+nameCnt()-uncoveredNounCnt();
+  line.col( "Conc_nw_strikt_d", density( strictNounCnt(), wordCnt() ) );
+  line.col( "Conc_nw_ruim_d", density( broadNounCnt(), wordCnt() ) );
+  line.col( "Pers_nw_p", proportion( humanCnt(), coveredNouns ) );
+  line.col( "Pers_nw_d", density( humanCnt(), wordCnt() ) );
+  line.col( "PlantDier_nw_p", proportion( nonHumanCnt(), coveredNouns ) );
+  line.col( "PlantDier_nw_d", density( nonHumanCnt(), wordCnt() ) );
+  line.col( "Gebr_vw_nw_p", proportion( artefactCnt(), coveredNouns ) );
+  line.col( "Gebr_vw_nw_d", density( artefactCnt(), wordCnt() ) );
+  line.col( "Subst_conc_nw_p", proportion( substanceConcCnt(), coveredNouns ) );
+  line.col( "Subst_conc_nw_d", density( substanceConcCnt(), wordCnt() ) );
+  line.col( "Voed_verz_nw_p", proportion( foodcareCnt(), coveredNouns ) );
+  line.col( "Voed_verz_nw_d", density( foodcareCnt(), wordCnt() ) );
+  line.col( "Concr_ov_nw_p", proportion( concrotherCnt(), coveredNouns ) );
+  line.col( "Concr_ov_nw_d", density( concrotherCnt(), wordCnt() ) );
+  line.col( "Gebeuren_conc_nw_p", proportion( dynamicConcCnt(), coveredNouns ) );
+  line.col( "Gebeuren_conc_nw_d", density( dynamicConcCnt(), wordCnt() ) );
+  line.col( "Plaats_nw_p", proportion( placeCnt(), coveredNouns ) );
+  line.col( "Plaats_nw_d", density( placeCnt(), wordCnt() ) );
+  line.col( "Tijd_nw_p", proportion( timeCnt(), coveredNouns ) );
+  line.col( "Tijd_nw_d", density( timeCnt(), wordCnt() ) );
+  line.col( "Maat_nw_p", proportion( measureCnt(), coveredNouns ) );
+  line.col( "Maat_nw_d", density( measureCnt(), wordCnt() ) );
+  line.col( "Subst_abstr_nw_p", proportion( substanceAbstrCnt(), coveredNouns ) );
+  line.col( "Subst_abstr_nw_d", density( substanceAbstrCnt(), wordCnt() ) );
+  line.col( "Gebeuren_abstr_nw_p", proportion( dynamicAbstrCnt(), coveredNouns ) );
+  line.col( "Gebeuren_abstr_nw_d", density( dynamicAbstrCnt(), wordCnt() ) );
+  line.col( "Organisatie_nw_p", proportion( institutCnt(), coveredNouns ) );
+  line.col( "Organisatie_nw_d", density( institutCnt(), wordCnt() ) );
+  line.col( "Ov_abstr_nw_p", proportion( nonDynamicCnt(), coveredNouns ) );
+  line.col( "Ov_abstr_nw_d", density( nonDynamicCnt(), wordCnt() ) );
+  line.col( "Undefined_nw_p", proportion( undefinedNounCnt(), coveredNouns ) );
+  line.col( "Gedekte_nw_p", proportion( coveredNouns, nounCnt() + nameCnt() ) );
+  line.col( "Alg_nw_p", proportion( generalNounCnt(), coveredNouns ) );
+  line.col( "Alg_nw_afz_sit_d", density( generalNounSepCnt(), wordCnt() ) );
+  line.col( "Alg_nw_afz_sit_p", proportion( generalNounSepCnt(), coveredNouns ) );
+  line.col( "Alg_nw_rel_sit_d", density( generalNounRelCnt(), wordCnt() ) );
+  line.col( "Alg_nw_rel_sit_p", proportion( generalNounRelCnt(), coveredNouns ) );
+  line.col( "Alg_nw_hand_d", density( generalNounActCnt(), wordCnt() ) );
+  line.col( "Alg_nw_hand_p", proportion( generalNounActCnt(), coveredNouns ) );
+  line.col( "Alg_nw_kenn_d", density( generalNounKnowCnt(), wordCnt() ) );
+  line.col( "Alg_nw_kenn_p", proportion( generalNounKnowCnt(), coveredNouns ) );
+  line.col( "Alg_nw_disc_caus_d", density( generalNounDiscCnt(), wordCnt() ) );
+  line.col( "Alg_nw_disc_caus_p", proportion( generalNounDiscCnt(), coveredNouns ) );
+  line.col( "Alg_nw_ontw_d", density( generalNounDeveCnt(), wordCnt() ) );
+  line.col( "Alg_nw_ontw_p", proportion( generalNounDeveCnt(), coveredNouns ) );
+  int coveredAdj = adjCnt()-uncoveredAdjCnt();
+  line.col( "Waarn_mens_bvnw_p", proportion( humanAdjCnt(), coveredAdj ) );
+  line.col( "Waarn_mens_bvnw_d", density( humanAdjCnt(),wordCnt() ) );
+  line.col( "Emosoc_bvnw_p", proportion( emoAdjCnt(), coveredAdj ) );
+  line.col( "Emosoc_bvnw_d", density( emoAdjCnt(),wordCnt() ) );
+  line.col( "Waarn_nmens_bvnw_p", proportion( nonhumanAdjCnt(), coveredAdj ) );
+  line.col( "Waarn_nmens_bvnw_d", density( nonhumanAdjCnt(),wordCnt() ) );
+  line.col( "Vorm_omvang_bvnw_p", proportion( shapeAdjCnt(), coveredAdj ) );
+  line.col( "Vorm_omvang_bvnw_d", density( shapeAdjCnt(),wordCnt() ) );
+  line.col( "Kleur_bvnw_p", proportion( colorAdjCnt(), coveredAdj ) );
+  line.col( "Kleur_bvnw_d", density( colorAdjCnt(),wordCnt() ) );
+  line.col( "Stof_bvnw_p", proportion( matterAdjCnt(), coveredAdj ) );
+  line.col( "Stof_bvnw_d", density( matterAdjCnt(),wordCnt() ) );
+  line.col( "Geluid_bvnw_p", proportion( soundAdjCnt(), coveredAdj ) );
+  line.col( "Geluid_bvnw_d", density( soundAdjCnt(),wordCnt() ) );
+  line.col( "Waarn_nmens_ov_bvnw_p", proportion( nonhumanOtherAdjCnt(), coveredAdj ) );
+  line.col( "Waarn_nmens_ov_bvnw_d", density( nonhumanOtherAdjCnt(),wordCnt() ) );
+  line.col( "Technisch_bvnw_p", proportion( techAdjCnt(), coveredAdj ) );
+  line.col( "Technisch_bvnw_d", density( techAdjCnt(),wordCnt() ) );
+  line.col( "Tijd_bvnw_p", proportion( timeAdjCnt(), coveredAdj ) );
+  line.col( "Tijd_bvnw_d", density( timeAdjCnt(),wordCnt() ) );
+  line.col( "Plaats_bvnw_p", proportion( placeAdjCnt(), coveredAdj ) );
+  line.col( "Plaats_bvnw_d", density( placeAdjCnt(),wordCnt() ) );
+  line.col( "Spec_positief_bvnw_p", proportion( specPosAdjCnt(), coveredAdj ) );
+  line.col( "Spec_positief_bvnw_d", density( specPosAdjCnt(),wordCnt() ) );
+  line.col( "Spec_negatief_bvnw_p", proportion( specNegAdjCnt(), coveredAdj ) );
+  line.col( "Spec_negatief_bvnw_d", density( specNegAdjCnt(),wordCnt() ) );
+  line.col( "Alg_positief_bvnw_p", proportion( posAdjCnt(), coveredAdj ) );
+  line.col( "Alg_positief_bvnw_d", density( posAdjCnt(),wordCnt() ) );
+  line.col( "Alg_negatief_bvnw_p", proportion( negAdjCnt(), coveredAdj ) );
+  line.col( "Alg_negatief_bvnw_d", density( negAdjCnt(),wordCnt() ) );
+  line.col( "Alg_ev_zr_bvnw_p", proportion( evaluativeAdjCnt(), coveredAdj ) );
+  line.col( "Alg_ev_zr_bvnw_d", density( evaluativeAdjCnt(),wordCnt() ) );
+  line.col( "Ep_positief_bvnw_p", proportion( epiPosAdjCnt(), coveredAdj ) );
+  line.col( "Ep_positief_bvnw_d", density( epiPosAdjCnt(),wordCnt() ) );
+  line.col( "Ep_negatief_bvnw_p", proportion( epiNegAdjCnt(), coveredAdj ) );
+  line.col( "Ep_negatief_bvnw_d", density( epiNegAdjCnt(),wordCnt() ) );
+  line.col( "Ov_abstr_bvnw_p", proportion( abstractAdjCnt(), coveredAdj ) );
+  line.col( "Ov_abstr_bvnw_d", density( abstractAdjCnt(),wordCnt() ) );
+  line.col( "Spec_ev_bvnw_p", proportion( specPosAdjCnt() + specNegAdjCnt(), coveredAdj ) );
+  line.col( "Spec_ev_bvnw_d", density( specPosAdjCnt() + specNegAdjCnt(), wordCnt() ) );
+  line.col( "Alg_ev_bvnw_p", proportion( posAdjCnt() + negAdjCnt() + evaluativeAdjCnt(), coveredAdj ) );
+  line.col( "Alg_ev_bvnw_d", density( posAdjCnt() + negAdjCnt() + evaluativeAdjCnt(), wordCnt() ) );
+  line.col( "Ep_ev_bvnw_p", proportion( epiPosAdjCnt() + epiNegAdjCnt(), coveredAdj ) );
+  line.col( "Ep_ev_bvnw_d", density( epiPosAdjCnt() + epiNegAdjCnt() ,wordCnt() ) );
+  line.col( "Conc_bvnw_strikt_p", proportion( strictAdjCnt(), coveredAdj ) );
+  line.col( "Conc_bvnw_strikt_d", density( strictAdjCnt(), wordCnt() ) );
+  line.col( "Conc_bvnw_ruim_p", proportion( broadAdjCnt(), coveredAdj ) );
+  line.col( "Conc_bvnw_ruim_d", density( broadAdjCnt(), wordCnt() ) );
+  line.col( "Subj_bvnw_p", proportion( subjectiveAdjCnt() ,coveredAdj ) );
+  line.col( "Subj_bvnw_d", density( subjectiveAdjCnt(), wordCnt() ) );
+  line.col( "Undefined_bvnw_p", proportion( undefinedAdjCnt(), coveredAdj ) );
+  line.col( "Gelabeld_bvnw_p", proportion( coveredAdj - undefinedAdjCnt() ,coveredAdj ) );
+  line.col( "Gedekte_bvnw_p", proportion( coveredAdj ,adjCnt() ) );
+  int coveredVerbs = verbCnt() - uncoveredVerbCnt();
+  line.col( "Conc_ww_p", proportion( concreteWwCnt(), coveredVerbs ) );
+  line.col( "Conc_ww_d", density( concreteWwCnt(), wordCnt() ) );
+  line.col( "Abstr_ww_p", proportion( abstractWwCnt(), coveredVerbs ) );
+  line.col( "Abstr_ww_d", density( abstractWwCnt(), wordCnt() ) );
+  line.col( "Undefined_ww_p", proportion( undefinedWwCnt(), coveredVerbs ) );
+  line.col( "Gedekte_ww_p", proportion( coveredVerbs, verbCnt() ) );
+  line.col( "Alg_ww_d", density( generalVerbCnt(), wordCnt() ) );
+  line.col( "Alg_ww_p", proportion( generalVerbCnt(), coveredVerbs ) );
+  line.col( "Alg_ww_afz_sit_d", density( generalVerbSepCnt(), wordCnt() ) );
+  line.col( "Alg_ww_afz_sit_p", proportion( generalVerbSepCnt(), coveredVerbs ) );
+  line.col( "Alg_ww_rel_sit_d", density( generalVerbRelCnt(), wordCnt() ) );
+  line.col( "Alg_ww_rel_sit_p", proportion( generalVerbRelCnt(), coveredVerbs ) );
+  line.col( "Alg_ww_hand_d", density( generalVerbActCnt(), wordCnt() ) );
+  line.col( "Alg_ww_hand_p", proportion( generalVerbActCnt(), coveredVerbs ) );
+  line.col( "Alg_ww_kenn_d", density( generalVerbKnowCnt(), wordCnt() ) );
+  line.col( "Alg_ww_kenn_p", proportion( generalVerbKnowCnt(), coveredVerbs ) );
+  line.col( "Alg_ww_disc_caus_d", density( generalVerbDiscCnt(), wordCnt() ) );
+  line.col( "Alg_ww_disc_caus_p", proportion( generalVerbDiscCnt(), coveredVerbs ) );
+  line.col( "Alg_ww_ontw_d", density( generalVerbDeveCnt(), wordCnt() ) );
+  line.col( "Alg_ww_ontw_p", proportion( generalVerbDeveCnt(), coveredVerbs ) );
   int totalCovered = coveredNouns + coveredAdj + coveredVerbs;
-  int totalCnt = strictNounCnt + strictAdjCnt + concreteWwCnt;
-  os << proportion( totalCnt, totalCovered ) << ",";
-  os << density( totalCnt, wordCnt ) << ",";
-
-  int coveredAdverbs = generalAdverbCnt + specificAdverbCnt;
-  os << density( generalAdverbCnt, wordInclCnt ) << ",";
-  os << proportion( generalAdverbCnt, coveredAdverbs ) << ",";
-  os << density( specificAdverbCnt, wordInclCnt ) << ",";
-  os << proportion( specificAdverbCnt, coveredAdverbs ) << ",";
-  os << proportion( coveredAdverbs, bwCnt ) << ",";
+  int totalCnt = strictNounCnt() + strictAdjCnt() + concreteWwCnt();
+  line.col( "Conc_tot_p", proportion( totalCnt, totalCovered ) );
+  line.col( "Conc_tot_d", density( totalCnt, wordCnt() ) );
+  int coveredAdverbs = generalAdverbCnt() + specificAdverbCnt();
+  line.col( "Alg_bijw_d", density( generalAdverbCnt(), wordInclCnt() ) );
+  line.col( "Alg_bijw_p", proportion( generalAdverbCnt(), coveredAdverbs ) );
+  line.col( "Spec_bijw_d", density( specificAdverbCnt(), wordInclCnt() ) );
+  line.col( "Spec_bijw_p", proportion( specificAdverbCnt(), coveredAdverbs ) );
+  line.col( "Gedekte_bw_p", proportion( coveredAdverbs, bwCnt() ) );
 }
 
-void structStats::persoonlijkheidHeader( ostream& os ) const {
-  os << "Pers_vnw1_d,Pers_vnw2_d,Pers_vnw3_d,"
-     << "Pers_namen_p, Pers_namen_p2, Pers_namen_d, Plaatsnamen_d,"
-     << "Org_namen_d, Prod_namen_d, Event_namen_d,";
-}
-
-void structStats::persoonlijkheidToCSV( ostream& os ) const {
-  os << density( pron1Cnt, wordInclCnt ) << ","; // column: Pers_vnw1_d
-  os << density( pron2Cnt, wordInclCnt ) << ","; // column: Pers_vnw2_d
-  os << density( pron3Cnt, wordInclCnt ) << ","; // column: Pers_vnw3_d
-
+void structStats::persoonlijkheidCSV( csvLine& line ) const {
+  line.col( "Pers_vnw1_d", density( pron1Cnt(), wordInclCnt() ) );
+  line.col( "Pers_vnw2_d", density( pron2Cnt(), wordInclCnt() ) );
+  line.col( "Pers_vnw3_d", density( pron3Cnt(), wordInclCnt() ) );
   int val = at( ners, NER::PER_B );
-  os << proportion( val, nerCnt ) << ",";
-  os << proportion( val, nounCnt + nameCnt ) << ",";
-  os << density( val, wordCnt ) << ",";
+  line.col( "Pers_namen_p", proportion( val, nerCnt() ) );
+  line.col( " Pers_namen_p2", proportion( val, nounCnt() + nameCnt() ) );
+  line.col( " Pers_namen_d", density( val, wordCnt() ) );
   val = at( ners, NER::LOC_B );
-  os << density( val, wordCnt ) << ",";
+  line.col( " Plaatsnamen_d", density( val, wordCnt() ) );
   val = at( ners, NER::ORG_B );
-  os << density( val, wordCnt ) << ",";
+  line.col( "Org_namen_d", density( val, wordCnt() ) );
   val = at( ners, NER::PRO_B );
-  os << density( val, wordCnt ) << ",";
+  line.col( " Prod_namen_d", density( val, wordCnt() ) );
   val = at( ners, NER::EVE_B );
-  os << density( val, wordCnt ) << ",";
+  line.col( " Event_namen_d", density( val, wordCnt() ) );
 }
 
-void structStats::verbHeader( ostream& os ) const {
-  os << "Actieww_p,Actieww_d,Toestww_p,Toestww_d,"
-     << "Procesww_p,Procesww_d,Undefined_ATP_ww_p,"
-     << "Ww_tt_p,Ww_tt_dz,Ww_mod_d_,Ww_mod_dz,"
-     << "Huww_tijd_d,Huww_tijd_dz,Koppelww_d,Koppelww_dz,"
-     << "Infin_bv_d,Infin_bv_dz,"
-     << "Infin_nw_d,Infin_nw_dz,"
-     << "Infin_vrij_d,Infin_vrij_dz,"
-     << "Vd_bv_d,Vd_bv_dz,"
-     << "Vd_nw_d,Vd_nw_dz,"
-     << "Vd_vrij_d,Vd_vrij_dz,"
-     << "Ovd_bv_d,Ovd_bv_dz,"
-     << "Ovd_nw_d,Ovd_nw_dz,"
-     << "Ovd_vrij_d,Ovd_vrij_dz,";
+void structStats::verbCSV( csvLine& line ) const {
+  line.col( "Actieww_p", proportion( actionCnt(), verbCnt() ) );
+  line.col( "Actieww_d", density( actionCnt(), wordCnt()) );
+  line.col( "Toestww_p", proportion( stateCnt(), verbCnt() ) );
+  line.col( "Toestww_d", density( stateCnt(), wordCnt() ) );
+  line.col( "Procesww_p", proportion( processCnt(), verbCnt() ) );
+  line.col( "Procesww_d", density( processCnt(), wordCnt() ) );
+  line.col( "Undefined_ATP_ww_p", proportion( undefinedATPCnt(), verbCnt() - uncoveredVerbCnt() ) );
+  line.col( "Ww_tt_p", density( presentCnt(), wordInclCnt() ) );
+  line.col( "Ww_tt_dz", proportion( presentCnt(), correctedClauseCnt() ) );
+  line.col( "Ww_mod_d_", density( modalCnt(), wordInclCnt() ) );
+  line.col( "Ww_mod_dz", proportion( modalCnt(), correctedClauseCnt() ) );
+  line.col( "Huww_tijd_d", density( timeVCnt(), wordInclCnt() ) );
+  line.col( "Huww_tijd_dz", proportion( timeVCnt(), correctedClauseCnt() ) );
+  line.col( "Koppelww_d", density( koppelCnt(), wordInclCnt() ) );
+  line.col( "Koppelww_dz", proportion( koppelCnt(), correctedClauseCnt() ) );
+  line.col( "Infin_bv_d", density( infBvCnt(), wordInclCnt() ) );
+  line.col( "Infin_bv_dz", proportion( infBvCnt(), correctedClauseCnt() ) );
+  line.col( "Infin_nw_d", density( infNwCnt(), wordInclCnt() ) );
+  line.col( "Infin_nw_dz", proportion( infNwCnt(), correctedClauseCnt() ) );
+  line.col( "Infin_vrij_d", density( infVrijCnt(), wordInclCnt() ) );
+  line.col( "Infin_vrij_dz", proportion( infVrijCnt(), correctedClauseCnt() ) );
+  line.col( "Vd_bv_d", density( vdBvCnt(), wordInclCnt() ) );
+  line.col( "Vd_bv_dz", proportion( vdBvCnt(), correctedClauseCnt() ) );
+  line.col( "Vd_nw_d", density( vdNwCnt(), wordInclCnt() ) );
+  line.col( "Vd_nw_dz", proportion( vdNwCnt(), correctedClauseCnt() ) );
+  line.col( "Vd_vrij_d", density( vdVrijCnt(), wordInclCnt() ) );
+  line.col( "Vd_vrij_dz", proportion( vdVrijCnt(), correctedClauseCnt() ) );
+  line.col( "Ovd_bv_d", density( odBvCnt(), wordInclCnt() ) );
+  line.col( "Ovd_bv_dz", proportion( odBvCnt(), correctedClauseCnt() ) );
+  line.col( "Ovd_nw_d", density( odNwCnt(), wordInclCnt() ) );
+  line.col( "Ovd_nw_dz", proportion( odNwCnt(), correctedClauseCnt() ) );
+  line.col( "Ovd_vrij_d", density( odVrijCnt(), wordInclCnt() ) );
+  line.col( "Ovd_vrij_dz", proportion( odVrijCnt(), correctedClauseCnt() ) );
 }
 
-void structStats::verbToCSV( ostream& os ) const {
-  os << proportion( actionCnt, verbCnt ) << ",";
-  os << density( actionCnt, wordCnt) << ",";
-  os << proportion( stateCnt, verbCnt ) << ",";
-  os << density( stateCnt, wordCnt ) << ",";
-  os << proportion( processCnt, verbCnt ) << ",";
-  os << density( processCnt, wordCnt ) << ",";
-  os << proportion( undefinedATPCnt, verbCnt - uncoveredVerbCnt ) << ",";
-
-  os << density( presentCnt, wordInclCnt ) << ",";
-  os << proportion( presentCnt, correctedClauseCnt ) << ",";
-  os << density( modalCnt, wordInclCnt ) << ",";
-  os << proportion( modalCnt, correctedClauseCnt ) << ",";
-  os << density( timeVCnt, wordInclCnt ) << ",";
-  os << proportion( timeVCnt, correctedClauseCnt ) << ",";
-  os << density( koppelCnt, wordInclCnt ) << ",";
-  os << proportion( koppelCnt, correctedClauseCnt ) << ",";
-
-  os << density( infBvCnt, wordInclCnt ) << ",";
-  os << proportion( infBvCnt, correctedClauseCnt ) << ",";
-  os << density( infNwCnt, wordInclCnt ) << ",";
-  os << proportion( infNwCnt, correctedClauseCnt ) << ",";
-  os << density( infVrijCnt, wordInclCnt ) << ",";
-  os << proportion( infVrijCnt, correctedClauseCnt ) << ",";
-
-  os << density( vdBvCnt, wordInclCnt ) << ",";
-  os << proportion( vdBvCnt, correctedClauseCnt ) << ",";
-  os << density( vdNwCnt, wordInclCnt ) << ",";
-  os << proportion( vdNwCnt, correctedClauseCnt ) << ",";
-  os << density( vdVrijCnt, wordInclCnt ) << ",";
-  os << proportion( vdVrijCnt, correctedClauseCnt ) << ",";
-
-  os << density( odBvCnt, wordInclCnt ) << ",";
-  os << proportion( odBvCnt, correctedClauseCnt ) << ",";
-  os << density( odNwCnt, wordInclCnt ) << ",";
-  os << proportion( odNwCnt, correctedClauseCnt ) << ",";
-  os << density( odVrijCnt, wordInclCnt ) << ",";
-  os << proportion( odVrijCnt, correctedClauseCnt ) << ",";
+void structStats::imperativeCSV( csvLine& line ) const {
+  line.col( "Imp_ellips_p", proportion( impCnt(), sentCnt ) );
+  line.col( "Imp_ellips_d", density( impCnt(), wordInclCnt() ) );
+  line.col( "Vragen_p", proportion( questCnt(), sentCnt ) );
+  line.col( "Vragen_d", density( questCnt(), wordInclCnt() ) );
 }
 
-void structStats::imperativeHeader( ostream& os ) const {
-  os << "Imp_ellips_p,Imp_ellips_d," // 20141003: Features renamed
-     << "Vragen_p,Vragen_d,";
-}
-
-void structStats::imperativeToCSV( ostream& os ) const {
-  os << proportion( impCnt, sentCnt ) << ",";
-  os << density( impCnt, wordInclCnt ) << ",";
-  os << proportion( questCnt, sentCnt ) << ",";
-  os << density( questCnt, wordInclCnt ) << ",";
-}
-
-void structStats::wordSortHeader( ostream& os ) const {
-  os << "Bvnw_d,Vg_d,Vnw_d,Lidw_d,Vz_d,Bijw_d,Tw_d,Nw_d,Ww_d,Tuss_d,Spec_d,"
-     << "Interp_d,"
-     << "Afk_d,Afk_gen_d,Afk_int_d,Afk_jur_d,Afk_med_d,"
-     << "Afk_ond_d,Afk_pol_d,Afk_ov_d,Afk_zorg_d,";
-}
-
-void structStats::wordSortToCSV( ostream& os ) const {
-  os << density(adjInclCnt, wordInclCnt ) << ","
-     << density(vgCnt, wordInclCnt ) << ","
-     << density(vnwCnt, wordInclCnt ) << ","
-     << density(lidCnt, wordInclCnt ) << ","
-     << density(vzCnt, wordInclCnt ) << ","
-     << density(bwCnt, wordInclCnt ) << ","
-     << density(twCnt, wordInclCnt ) << ","
-     << density(nounInclCnt, wordInclCnt ) << ","
-     << density(verbInclCnt, wordInclCnt ) << ","
-     << density(tswCnt, wordInclCnt ) << ","
-     << density(specCnt, wordInclCnt ) << ","
-     << density(letCnt, wordInclCnt ) << ",";
+void structStats::wordSortCSV( csvLine& line ) const {
+  line.col( "Bvnw_d", density(adjInclCnt(), wordInclCnt() ) );
+  line.col( "Vg_d", density(vgCnt(), wordInclCnt() ) );
+  line.col( "Vnw_d", density(vnwCnt(), wordInclCnt() ) );
+  line.col( "Lidw_d", density(lidCnt(), wordInclCnt() ) );
+  line.col( "Vz_d", density(vzCnt(), wordInclCnt() ) );
+  line.col( "Bijw_d", density(bwCnt(), wordInclCnt() ) );
+  line.col( "Tw_d", density(twCnt(), wordInclCnt() ) );
+  line.col( "Nw_d", density(nounInclCnt(), wordInclCnt() ) );
+  line.col( "Ww_d", density(verbInclCnt(), wordInclCnt() ) );
+  line.col( "Tuss_d", density(tswCnt(), wordInclCnt() ) );
+  line.col( "Spec_d", density(specCnt(), wordInclCnt() ) );
+  line.col( "Interp_d", density(letCnt(), wordInclCnt() ) );
   int pola = at( afks, Afk::OVERHEID_A );
   int jura = at( afks, Afk::JURIDISCH_A );
   int onda = at( afks, Afk::ONDERWIJS_A );
@@ -908,105 +616,73 @@ void structStats::wordSortToCSV( ostream& os ) const {
   int ova = at( afks, Afk::OVERIGE_A );
   int zorga = at( afks, Afk::ZORG_A );
   int inta = at( afks, Afk::INTERNATIONAAL_A );
-  os << density( gena+inta+jura+meda+onda+pola+ova+zorga, wordInclCnt ) << ","
-     << density( gena, wordInclCnt ) << ","
-     << density( inta, wordInclCnt ) << ","
-     << density( jura, wordInclCnt ) << ","
-     << density( meda, wordInclCnt ) << ","
-     << density( onda, wordInclCnt ) << ","
-     << density( pola, wordInclCnt ) << ","
-     << density( ova, wordInclCnt ) << ","
-     << density( zorga, wordInclCnt ) << ",";
+  line.col( "Afk_d", density( gena+inta+jura+meda+onda+pola+ova+zorga, wordInclCnt() ) );
+  line.col( "Afk_gen_d", density( gena, wordInclCnt() ) );
+  line.col( "Afk_int_d", density( inta, wordInclCnt() ) );
+  line.col( "Afk_jur_d", density( jura, wordInclCnt() ) );
+  line.col( "Afk_med_d", density( meda, wordInclCnt() ) );
+  line.col( "Afk_ond_d", density( onda, wordInclCnt() ) );
+  line.col( "Afk_pol_d", density( pola, wordInclCnt() ) );
+  line.col( "Afk_ov_d", density( ova, wordInclCnt() ) );
+  line.col( "Afk_zorg_d", density( zorga, wordInclCnt() ) );
 }
 
-void structStats::prepPhraseHeader( ostream& os ) const {
-  os << "Vzu_d,Vzu_dz,Arch_d,";
+void structStats::prepPhraseCSV( csvLine& line ) const {
+  line.col( "Vzu_d", density( prepExprCnt(), wordInclCnt() ) );
+  line.col( "Vzu_dz", proportion( prepExprCnt(), correctedClauseCnt() ) );
+  line.col( "Arch_d", density( archaicsCnt(), wordInclCnt() ) );
 }
 
-void structStats::prepPhraseToCSV( ostream& os ) const {
-  os << density( prepExprCnt, wordInclCnt ) << ",";
-  os << proportion( prepExprCnt, correctedClauseCnt ) << ",";
-  os << density( archaicsCnt, wordInclCnt ) << ",";
+void structStats::intensCSV( csvLine& line ) const {
+  line.col( "Int_d", density( intensCnt(), wordInclCnt() ) );
+  line.col( "Int_bvnw_d", density( intensBvnwCnt(), wordInclCnt() ) );
+  line.col( "Int_bvbw_d", density( intensBvbwCnt(), wordInclCnt() ) );
+  line.col( "Int_bw_d", density( intensBwCnt(), wordInclCnt() ) );
+  line.col( "Int_combi_d", density( intensCombiCnt(), wordInclCnt() ) );
+  line.col( "Int_nw_d", density( intensNwCnt(), wordInclCnt() ) );
+  line.col( "Int_tuss_d", density( intensTussCnt(), wordInclCnt() ) );
+  line.col( "Int_ww_d", density( intensWwCnt(), wordInclCnt() ) );
 }
 
-void structStats::intensHeader( ostream& os ) const {
-  os << "Int_d,Int_bvnw_d,Int_bvbw_d,";
-  os << "Int_bw_d,Int_combi_d,Int_nw_d,";
-  os << "Int_tuss_d,Int_ww_d,";
+void structStats::formalCSV( csvLine& line ) const {
+  line.col( "Form_d", density( formalCnt(), wordInclCnt() ) );
+  line.col( "Form_d_z_vnw", density( formalCnt()-formalVnwCnt(), wordInclCnt() ) );
+  line.col( "Form_bvnw_d", density( formalBvnwCnt(), wordInclCnt() ) );
+  line.col( "Form_bw_d", density( formalBwCnt(), wordInclCnt() ) );
+  line.col( "Form_vgw_d", density( formalVgwCnt(), wordInclCnt() ) );
+  line.col( "Form_vnw_d", density( formalVnwCnt(), wordInclCnt() ) );
+  line.col( "Form_vz_d", density( formalVzCnt(), wordInclCnt() ) );
+  line.col( "Form_vzg_d", density( formalVzgCnt(), wordInclCnt() ) );
+  line.col( "Form_ww_d", density( formalWwCnt(), wordInclCnt() ) );
+  line.col( "Form_znw_d", density( formalZnwCnt(), wordInclCnt() ) );
 }
 
-void structStats::intensToCSV( ostream& os ) const {
-  os << density( intensCnt, wordInclCnt ) << ","; // column: Int_d
-  os << density( intensBvnwCnt, wordInclCnt ) << ","; /// column: Int_bvnw_d
-  os << density( intensBvbwCnt, wordInclCnt ) << ","; // column: Int_bvbw_d
-  os << density( intensBwCnt, wordInclCnt ) << ","; // column: Int_bw_d
-  os << density( intensCombiCnt, wordInclCnt ) << ","; // column: Int_combi_d
-  os << density( intensNwCnt, wordInclCnt ) << ","; // column: Int_nw_d
-  os << density( intensTussCnt, wordInclCnt ) << ","; // column: Int_tuss_d
-  os << density( intensWwCnt, wordInclCnt ) << ","; // column: Int_ww_d
-}
-
-void structStats::formalHeader( ostream& os ) const {
-  os << "Form_d,";
-  os << "Form_d_z_vnw,";
-  os << "Form_bvnw_d,";
-  os << "Form_bw_d,";
-  os << "Form_vgw_d,";
-  os << "Form_vnw_d,";
-  os << "Form_vz_d,";
-  os << "Form_vzg_d,";
-  os << "Form_ww_d,";
-  os << "Form_znw_d,";
-}
-
-void structStats::formalToCSV( ostream& os ) const {
-  os << density( formalCnt, wordInclCnt ) << ","; // column: Form_d
-  os << density( formalCnt-formalVnwCnt, wordInclCnt ) << ","; // column: Form_d_z_vnw
-  os << density( formalBvnwCnt, wordInclCnt ) << ","; // column: Form_bvnw_d
-  os << density( formalBwCnt, wordInclCnt ) << ","; // column: Form_bw_d
-  os << density( formalVgwCnt, wordInclCnt ) << ","; // column: Form_vgw_d
-  os << density( formalVnwCnt, wordInclCnt ) << ","; // column: Form_vnw_d
-  os << density( formalVzCnt, wordInclCnt ) << ","; // column: Form_vz_d
-  os << density( formalVzgCnt, wordInclCnt ) << ","; // column: Form_vzg_d
-  os << density( formalWwCnt, wordInclCnt ) << ","; // column: Form_ww_d
-  os << density( formalZnwCnt, wordInclCnt ) << ","; // column: Form_znw_d
-}
-
-void structStats::miscHeader( ostream& os ) const {
-  os << "Log_prob_fwd,Log_prob_fwd_inhwrd,Log_prob_fwd_zn,Log_prob_fwd_inhwrd_zn,";
-  os << "Entropie_fwd,Entropie_fwd_norm,Perplexiteit_fwd,Perplexiteit_fwd_norm,";
-  os << "Log_prob_bwd,Log_prob_bwd_inhwrd,Log_prob_bwd_zn,Log_prob_bwd_inhwrd_zn,";
-  os << "Entropie_bwd,Entropie_bwd_norm,Perplexiteit_bwd,Perplexiteit_bwd_norm,";
-  os << "Eigen_classificatie,";
-  os << "LiNT_score1,LiNT_niveau1,LiNT_score2,LiNT_niveau2";
-}
-
-void structStats::miscToCSV( ostream& os ) const {
-  os << proportion( avg_prob10_fwd, sentCnt ) << ",";
-  os << proportion( avg_prob10_fwd_content, sentCnt ) << ",";
-  os << proportion( avg_prob10_fwd_ex_names, sentCnt ) << ",";
-  os << proportion( avg_prob10_fwd_content_ex_names, sentCnt ) << ",";
-  os << proportion( entropy_fwd, sentCnt ) << ",";
-  os << proportion( entropy_fwd_norm, sentCnt ) << ",";
-  os << proportion( perplexity_fwd, sentCnt ) << ",";
-  os << proportion( perplexity_fwd_norm, sentCnt ) << ",";
-  os << proportion( avg_prob10_bwd, sentCnt ) << ",";
-  os << proportion( avg_prob10_bwd_content, sentCnt ) << ",";
-  os << proportion( avg_prob10_bwd_ex_names, sentCnt ) << ",";
-  os << proportion( avg_prob10_bwd_content_ex_names, sentCnt ) << ",";
-  os << proportion( entropy_bwd, sentCnt ) << ",";
-  os << proportion( entropy_bwd_norm, sentCnt ) << ",";
-  os << proportion( perplexity_bwd, sentCnt ) << ",";
-  os << proportion( perplexity_bwd_norm, sentCnt ) << ",";
-
-  os << "\"" << escape_quotes(toStringCounter(my_classification)) << "\",";
+void structStats::miscCSV( csvLine& line ) const {
+  line.col( "Log_prob_fwd", proportion( avg_prob10_fwd(), sentCnt ) );
+  line.col( "Log_prob_fwd_inhwrd", proportion( avg_prob10_fwd_content(), sentCnt ) );
+  line.col( "Log_prob_fwd_zn", proportion( avg_prob10_fwd_ex_names(), sentCnt ) );
+  line.col( "Log_prob_fwd_inhwrd_zn", proportion( avg_prob10_fwd_content_ex_names(), sentCnt ) );
+  line.col( "Entropie_fwd", proportion( entropy_fwd(), sentCnt ) );
+  line.col( "Entropie_fwd_norm", proportion( entropy_fwd_norm(), sentCnt ) );
+  line.col( "Perplexiteit_fwd", proportion( perplexity_fwd(), sentCnt ) );
+  line.col( "Perplexiteit_fwd_norm", proportion( perplexity_fwd_norm(), sentCnt ) );
+  line.col( "Log_prob_bwd", proportion( avg_prob10_bwd(), sentCnt ) );
+  line.col( "Log_prob_bwd_inhwrd", proportion( avg_prob10_bwd_content(), sentCnt ) );
+  line.col( "Log_prob_bwd_zn", proportion( avg_prob10_bwd_ex_names(), sentCnt ) );
+  line.col( "Log_prob_bwd_inhwrd_zn", proportion( avg_prob10_bwd_content_ex_names(), sentCnt ) );
+  line.col( "Entropie_bwd", proportion( entropy_bwd(), sentCnt ) );
+  line.col( "Entropie_bwd_norm", proportion( entropy_bwd_norm(), sentCnt ) );
+  line.col( "Perplexiteit_bwd", proportion( perplexity_bwd(), sentCnt ) );
+  line.col( "Perplexiteit_bwd_norm", proportion( perplexity_bwd_norm(), sentCnt ) );
+
+  line.quoted( "Eigen_classificatie", toStringCounter( my_classification ) );
 
   /* LINT scores */
-  double wrd_freq_log_zn_corr = proportion(word_freq_log_n_corr, contentCnt-nameCnt).p;
-  double bijv_bep_dz_zbijzin = proportion( max(0, npModCnt - betrCnt), correctedClauseCnt).p ;
-  double alg_nw_d = density( generalNounCnt, wordCnt ).d;
-  double inhwrd_dz_zonder_abw = proportion( contentStrictInclCnt, correctedClauseCnt ).p;
-  double conc_nw_ruim_p = proportion( broadNounCnt, nounCnt+nameCnt-uncoveredNounCnt ).p;
+  double wrd_freq_log_zn_corr = proportion(word_freq_log_n_corr(), contentCnt()-nameCnt()).p;
+  double bijv_bep_dz_zbijzin = proportion( max(0, npModCnt() - betrCnt()), correctedClauseCnt()).p ;
+  double alg_nw_d = density( generalNounCnt(), wordCnt() ).d;
+  double inhwrd_dz_zonder_abw = proportion( contentStrictInclCnt(), correctedClauseCnt() ).p;
+  double conc_nw_ruim_p = proportion( broadNounCnt(), nounCnt()+nameCnt()-uncoveredNounCnt() ).p;
 
   double lint_score_1 = min(100.0, max(0.0, 100 - (-14.857
     +  19.487 * wrd_freq_log_zn_corr 
@@ -1035,10 +711,10 @@ void structStats::miscToCSV( ostream& os ) const {
   else if (lint_score_2 <= level3) { lint_level_2 = 3; }
   else { lint_level_2 = 4; }
   
-  os << lint_score_1 << ",";
-  os << lint_level_1 << ",";
-  os << lint_score_2 << ",";
-  os << lint_level_2 << ",";
+  line.col( "LiNT_score1", lint_score_1 );
+  line.col( "LiNT_niveau1", lint_level_1 );
+  line.col( "LiNT_score2", lint_score_2 );
+  line.col( "LiNT_niveau2", lint_level_2 );
 }
 
 /**************
@@ -1051,294 +727,294 @@ void structStats::miscToCSV( ostream& os ) const {
 void structStats::addMetrics( ) const {
   folia::FoliaElement *el = folia_node;
   folia::Document *doc = el->doc();
-  addOneMetric( doc, el, "word_count", TiCC::toString(wordCnt) );
-  addOneMetric( doc, el, "word_count_incl_stopwords", TiCC::toString(wordInclCnt) );
-  addOneMetric( doc, el, "bv_vd_count", TiCC::toString(vdBvCnt) );
-  addOneMetric( doc, el, "nw_vd_count", TiCC::toString(vdNwCnt) );
-  addOneMetric( doc, el, "vrij_vd_count", TiCC::toString(vdVrijCnt) );
-  addOneMetric( doc, el, "bv_od_count", TiCC::toString(odBvCnt) );
-  addOneMetric( doc, el, "nw_od_count", TiCC::toString(odNwCnt) );
-  addOneMetric( doc, el, "vrij_od_count", TiCC::toString(odVrijCnt) );
-  addOneMetric( doc, el, "bv_inf_count", TiCC::toString(infBvCnt) );
-  addOneMetric( doc, el, "nw_inf_count", TiCC::toString(infNwCnt) );
-  addOneMetric( doc, el, "vrij_inf_count", TiCC::toString(infVrijCnt) );
-  addOneMetric( doc, el, "smain_count", TiCC::toString(smainCnt) );
-  addOneMetric( doc, el, "ssub_count", TiCC::toString(ssubCnt) );
-  addOneMetric( doc, el, "sv1_count", TiCC::toString(sv1Cnt) );
-  addOneMetric( doc, el, "smain_cnj_count", TiCC::toString(smainCnjCnt) );
-  addOneMetric( doc, el, "ssub_cnj_count", TiCC::toString(ssubCnjCnt) );
-  addOneMetric( doc, el, "sv1_cnj_count", TiCC::toString(sv1CnjCnt) );
-  addOneMetric( doc, el, "present_verb_count", TiCC::toString(presentCnt) );
-  addOneMetric( doc, el, "past_verb_count", TiCC::toString(pastCnt) );
-  addOneMetric( doc, el, "subjonct_count", TiCC::toString(subjonctCnt) );
-  addOneMetric( doc, el, "name_count", TiCC::toString(nameCnt) );
+  addOneMetric( doc, el, "word_count", wordCnt() );
+  addOneMetric( doc, el, "word_count_incl_stopwords", wordInclCnt() );
+  addOneMetric( doc, el, "bv_vd_count", vdBvCnt() );
+  addOneMetric( doc, el, "nw_vd_count", vdNwCnt() );
+  addOneMetric( doc, el, "vrij_vd_count", vdVrijCnt() );
+  addOneMetric( doc, el, "bv_od_count", odBvCnt() );
+  addOneMetric( doc, el, "nw_od_count", odNwCnt() );
+  addOneMetric( doc, el, "vrij_od_count", odVrijCnt() );
+  addOneMetric( doc, el, "bv_inf_count", infBvCnt() );
+  addOneMetric( doc, el, "nw_inf_count", infNwCnt() );
+  addOneMetric( doc, el, "vrij_inf_count", infVrijCnt() );
+  addOneMetric( doc, el, "smain_count", smainCnt() );
+  addOneMetric( doc, el, "ssub_count", ssubCnt() );
+  addOneMetric( doc, el, "sv1_count", sv1Cnt() );
+  addOneMetric( doc, el, "smain_cnj_count", smainCnjCnt() );
+  addOneMetric( doc, el, "ssub_cnj_count", ssubCnjCnt() );
+  addOneMetric( doc, el, "sv1_cnj_count", sv1CnjCnt() );
+  addOneMetric( doc, el, "present_verb_count", presentCnt() );
+  addOneMetric( doc, el, "past_verb_count", pastCnt() );
+  addOneMetric( doc, el, "subjonct_count", subjonctCnt() );
+  addOneMetric( doc, el, "name_count", nameCnt() );
   int val = at( ners, NER::PER_B );
-  addOneMetric( doc, el, "personal_name_count", TiCC::toString(val) );
+  addOneMetric( doc, el, "personal_name_count", val );
   val = at( ners, NER::LOC_B );
-  addOneMetric( doc, el, "location_name_count", TiCC::toString(val) );
+  addOneMetric( doc, el, "location_name_count", val );
   val = at( ners, NER::ORG_B );
-  addOneMetric( doc, el, "organization_name_count", TiCC::toString(val) );
+  addOneMetric( doc, el, "organization_name_count", val );
   val = at( ners, NER::PRO_B );
-  addOneMetric( doc, el, "product_name_count", TiCC::toString(val) );
+  addOneMetric( doc, el, "product_name_count", val );
   val = at( ners, NER::EVE_B );
-  addOneMetric( doc, el, "event_name_count", TiCC::toString(val) );
+  addOneMetric( doc, el, "event_name_count", val );
   val = at( afks, Afk::OVERHEID_A );
   if ( val > 0 ){
-    addOneMetric( doc, el, "overheid_afk_count", TiCC::toString(val) );
+    addOneMetric( doc, el, "overheid_afk_count", val );
   }
   val = at( afks, Afk::JURIDISCH_A );
   if ( val > 0 ){
-    addOneMetric( doc, el, "juridisch_afk_count", TiCC::toString(val) );
+    addOneMetric( doc, el, "juridisch_afk_count", val );
   }
   val = at( afks, Afk::ONDERWIJS_A );
   if ( val > 0 ){
-    addOneMetric( doc, el, "onderwijs_afk_count", TiCC::toString(val) );
+    addOneMetric( doc, el, "onderwijs_afk_count", val );
   }
   val = at( afks, Afk::MEDIA_A );
   if ( val > 0 ){
-    addOneMetric( doc, el, "media_afk_count", TiCC::toString(val) );
+    addOneMetric( doc, el, "media_afk_count", val );
   }
   val = at( afks, Afk::GENERIEK_A );
   if ( val > 0 ){
-    addOneMetric( doc, el, "generiek_afk_count", TiCC::toString(val) );
+    addOneMetric( doc, el, "generiek_afk_count", val );
   }
   val = at( afks, Afk::OVERIGE_A );
   if ( val > 0 ){
-    addOneMetric( doc, el, "overige_afk_count", TiCC::toString(val) );
+    addOneMetric( doc, el, "overige_afk_count", val );
   }
   val = at( afks, Afk::INTERNATIONAAL_A );
   if ( val > 0 ){
-    addOneMetric( doc, el, "internationaal_afk_count", TiCC::toString(val) );
+    addOneMetric( doc, el, "internationaal_afk_count", val );
   }
   val = at( afks, Afk::ZORG_A );
   if ( val > 0 ){
-    addOneMetric( doc, el, "zorg_afk_count", TiCC::toString(val) );
+    addOneMetric( doc, el, "zorg_afk_count", val );
   }
 
-  addOneMetric( doc, el, "pers_pron_1_count", TiCC::toString(pron1Cnt) );
-  addOneMetric( doc, el, "pers_pron_2_count", TiCC::toString(pron2Cnt) );
-  addOneMetric( doc, el, "pers_pron_3_count", TiCC::toString(pron3Cnt) );
-  addOneMetric( doc, el, "passive_count", TiCC::toString(passiveCnt) );
-  addOneMetric( doc, el, "modal_count", TiCC::toString(modalCnt) );
-  addOneMetric( doc, el, "time_count", TiCC::toString(timeVCnt) );
-  addOneMetric( doc, el, "koppel_count", TiCC::toString(koppelCnt) );
-  addOneMetric( doc, el, "pers_ref_count", TiCC::toString(persRefCnt) );
-  addOneMetric( doc, el, "pron_ref_count", TiCC::toString(pronRefCnt) );
-  addOneMetric( doc, el, "archaic_count", TiCC::toString(archaicsCnt) );
-  addOneMetric( doc, el, "content_count", TiCC::toString(contentCnt) );
-  addOneMetric( doc, el, "content_strict_count", TiCC::toString(contentStrictCnt) );
-  addOneMetric( doc, el, "nominal_count", TiCC::toString(nominalCnt) );
-  addOneMetric( doc, el, "adj_count", TiCC::toString(adjCnt) );
-  addOneMetric( doc, el, "vg_count", TiCC::toString(vgCnt) );
-  addOneMetric( doc, el, "vnw_count", TiCC::toString(vnwCnt) );
-  addOneMetric( doc, el, "lid_count", TiCC::toString(lidCnt) );
-  addOneMetric( doc, el, "vz_count", TiCC::toString(vzCnt) );
-  addOneMetric( doc, el, "bw_count", TiCC::toString(bwCnt) );
-  addOneMetric( doc, el, "tw_count", TiCC::toString(twCnt) );
-  addOneMetric( doc, el, "noun_count", TiCC::toString(nounCnt) );
-  addOneMetric( doc, el, "verb_count", TiCC::toString(verbCnt) );
-  addOneMetric( doc, el, "tsw_count", TiCC::toString(tswCnt) );
-  addOneMetric( doc, el, "spec_count", TiCC::toString(specCnt) );
-  addOneMetric( doc, el, "let_count", TiCC::toString(letCnt) );
-  addOneMetric( doc, el, "rel_count", TiCC::toString(betrCnt) );
-  addOneMetric( doc, el, "all_connector_count", TiCC::toString(allConnCnt) );
-  addOneMetric( doc, el, "temporal_connector_count", TiCC::toString(tempConnCnt) );
-  addOneMetric( doc, el, "reeks_wg_connector_count", TiCC::toString(opsomWgConnCnt) );
-  addOneMetric( doc, el, "reeks_zin_connector_count", TiCC::toString(opsomZinConnCnt) );
-  addOneMetric( doc, el, "contrast_connector_count", TiCC::toString(contrastConnCnt) );
-  addOneMetric( doc, el, "comparatief_connector_count", TiCC::toString(compConnCnt) );
-  addOneMetric( doc, el, "causaal_connector_count", TiCC::toString(causeConnCnt) );
-  addOneMetric( doc, el, "time_situation_count", TiCC::toString(timeSitCnt) );
-  addOneMetric( doc, el, "space_situation_count", TiCC::toString(spaceSitCnt) );
-  addOneMetric( doc, el, "cause_situation_count", TiCC::toString(causeSitCnt) );
-  addOneMetric( doc, el, "emotion_situation_count", TiCC::toString(emoSitCnt) );
-  addOneMetric( doc, el, "prop_neg_count", TiCC::toString(propNegCnt) );
-  addOneMetric( doc, el, "morph_neg_count", TiCC::toString(morphNegCnt) );
-  addOneMetric( doc, el, "multiple_neg_count", TiCC::toString(multiNegCnt) );
-  addOneMetric( doc, el, "voorzetsel_expression_count", TiCC::toString(prepExprCnt) );
+  addOneMetric( doc, el, "pers_pron_1_count", pron1Cnt() );
+  addOneMetric( doc, el, "pers_pron_2_count", pron2Cnt() );
+  addOneMetric( doc, el, "pers_pron_3_count", pron3Cnt() );
+  addOneMetric( doc, el, "passive_count", passiveCnt() );
+  addOneMetric( doc, el, "modal_count", modalCnt() );
+  addOneMetric( doc, el, "time_count", timeVCnt() );
+  addOneMetric( doc, el, "koppel_count", koppelCnt() );
+  addOneMetric( doc, el, "pers_ref_count", persRefCnt() );
+  addOneMetric( doc, el, "pron_ref_count", pronRefCnt() );
+  addOneMetric( doc, el, "archaic_count", archaicsCnt() );
+  addOneMetric( doc, el, "content_count", contentCnt() );
+  addOneMetric( doc, el, "content_strict_count", contentStrictCnt() );
+  addOneMetric( doc, el, "nominal_count", nominalCnt() );
+  addOneMetric( doc, el, "adj_count", adjCnt() );
+  addOneMetric( doc, el, "vg_count", vgCnt() );
+  addOneMetric( doc, el, "vnw_count", vnwCnt() );
+  addOneMetric( doc, el, "lid_count", lidCnt() );
+  addOneMetric( doc, el, "vz_count", vzCnt() );
+  addOneMetric( doc, el, "bw_count", bwCnt() );
+  addOneMetric( doc, el, "tw_count", twCnt() );
+  addOneMetric( doc, el, "noun_count", nounCnt() );
+  addOneMetric( doc, el, "verb_count", verbCnt() );
+  addOneMetric( doc, el, "tsw_count", tswCnt() );
+  addOneMetric( doc, el, "spec_count", specCnt() );
+  addOneMetric( doc, el, "let_count", letCnt() );
+  addOneMetric( doc, el, "rel_count", betrCnt() );
+  addOneMetric( doc, el, "all_connector_count", allConnCnt() );
+  addOneMetric( doc, el, "temporal_connector_count", tempConnCnt() );
+  addOneMetric( doc, el, "reeks_wg_connector_count", opsomWgConnCnt() );
+  addOneMetric( doc, el, "reeks_zin_connector_count", opsomZinConnCnt() );
+  addOneMetric( doc, el, "contrast_connector_count", contrastConnCnt() );
+  addOneMetric( doc, el, "comparatief_connector_count", compConnCnt() );
+  addOneMetric( doc, el, "causaal_connector_count", causeConnCnt() );
+  addOneMetric( doc, el, "time_situation_count", timeSitCnt() );
+  addOneMetric( doc, el, "space_situation_count", spaceSitCnt() );
+  addOneMetric( doc, el, "cause_situation_count", causeSitCnt() );
+  addOneMetric( doc, el, "emotion_situation_count", emoSitCnt() );
+  addOneMetric( doc, el, "prop_neg_count", propNegCnt() );
+  addOneMetric( doc, el, "morph_neg_count", morphNegCnt() );
+  addOneMetric( doc, el, "multiple_neg_count", multiNegCnt() );
+  addOneMetric( doc, el, "voorzetsel_expression_count", prepExprCnt() );
   addOneMetric( doc, el,
-    "word_overlap_count", TiCC::toString( wordOverlapCnt ) );
+    "word_overlap_count", wordOverlapCnt() );
   addOneMetric( doc, el,
-    "lemma_overlap_count", TiCC::toString( lemmaOverlapCnt ) );
-  addOneMetric( doc, el, "prevalenceP", TiCC::toString(prevalenceP) );
-  addOneMetric( doc, el, "prevalenceZ", TiCC::toString(prevalenceZ) );
-  addOneMetric( doc, el, "prevalenceContentP", TiCC::toString(prevalenceContentP) );
-  addOneMetric( doc, el, "prevalenceContentZ", TiCC::toString(prevalenceContentZ) );
-  addOneMetric( doc, el, "prevalenceCovered", TiCC::toString(prevalenceCovered) );
-  addOneMetric( doc, el, "prevalenceContentCovered", TiCC::toString(prevalenceContentCovered) );
-  addOneMetric( doc, el, "freq50", TiCC::toString(f50Cnt) );
-  addOneMetric( doc, el, "freq65", TiCC::toString(f65Cnt) );
-  addOneMetric( doc, el, "freq77", TiCC::toString(f77Cnt) );
-  addOneMetric( doc, el, "freq80", TiCC::toString(f80Cnt) );
-
-  addOneMetric( doc, el, "top1000", TiCC::toString(top1000Cnt) );
-  addOneMetric( doc, el, "top2000", TiCC::toString(top2000Cnt) );
-  addOneMetric( doc, el, "top3000", TiCC::toString(top3000Cnt) );
-  addOneMetric( doc, el, "top5000", TiCC::toString(top5000Cnt) );
-  addOneMetric( doc, el, "top10000", TiCC::toString(top10000Cnt) );
-  addOneMetric( doc, el, "top20000", TiCC::toString(top20000Cnt) );
-  addOneMetric( doc, el, "top1000Content", TiCC::toString(top1000ContentCnt) );
-  addOneMetric( doc, el, "top2000Content", TiCC::toString(top2000ContentCnt) );
-  addOneMetric( doc, el, "top3000Content", TiCC::toString(top3000ContentCnt) );
-  addOneMetric( doc, el, "top5000Content", TiCC::toString(top5000ContentCnt) );
-  addOneMetric( doc, el, "top10000Content", TiCC::toString(top10000ContentCnt) );
-  addOneMetric( doc, el, "top20000Content", TiCC::toString(top20000ContentCnt) );
-  addOneMetric( doc, el, "top1000StrictContent", TiCC::toString(top1000ContentStrictCnt) );
-  addOneMetric( doc, el, "top2000StrictContent", TiCC::toString(top2000ContentStrictCnt) );
-  addOneMetric( doc, el, "top3000StrictContent", TiCC::toString(top3000ContentStrictCnt) );
-  addOneMetric( doc, el, "top5000StrictContent", TiCC::toString(top5000ContentStrictCnt) );
-  addOneMetric( doc, el, "top10000StrictContent", TiCC::toString(top10000ContentStrictCnt) );
-  addOneMetric( doc, el, "top20000StrictContent", TiCC::toString(top20000ContentStrictCnt) );
-
-  addOneMetric( doc, el, "word_freq", TiCC::toString(word_freq) );
-  addOneMetric( doc, el, "word_freq_no_names", TiCC::toString(word_freq_n) );
+    "lemma_overlap_count", lemmaOverlapCnt() );
+  addOneMetric( doc, el, "prevalenceP", prevalenceP() );
+  addOneMetric( doc, el, "prevalenceZ", prevalenceZ() );
+  addOneMetric( doc, el, "prevalenceContentP", prevalenceContentP() );
+  addOneMetric( doc, el, "prevalenceContentZ", prevalenceContentZ() );
+  addOneMetric( doc, el, "prevalenceCovered", prevalenceCovered() );
+  addOneMetric( doc, el, "prevalenceContentCovered", prevalenceContentCovered() );
+  addOneMetric( doc, el, "freq50", f50Cnt() );
+  addOneMetric( doc, el, "freq65", f65Cnt() );
+  addOneMetric( doc, el, "freq77", f77Cnt() );
+  addOneMetric( doc, el, "freq80", f80Cnt() );
+
+  addOneMetric( doc, el, "top1000", top1000Cnt() );
+  addOneMetric( doc, el, "top2000", top2000Cnt() );
+  addOneMetric( doc, el, "top3000", top3000Cnt() );
+  addOneMetric( doc, el, "top5000", top5000Cnt() );
+  addOneMetric( doc, el, "top10000", top10000Cnt() );
+  addOneMetric( doc, el, "top20000", top20000Cnt() );
+  addOneMetric( doc, el, "top1000Content", top1000ContentCnt() );
+  addOneMetric( doc, el, "top2000Content", top2000ContentCnt() );
+  addOneMetric( doc, el, "top3000Content", top3000ContentCnt() );
+  addOneMetric( doc, el, "top5000Content", top5000ContentCnt() );
+  addOneMetric( doc, el, "top10000Content", top10000ContentCnt() );
+  addOneMetric( doc, el, "top20000Content", top20000ContentCnt() );
+  addOneMetric( doc, el, "top1000StrictContent", top1000ContentStrictCnt() );
+  addOneMetric( doc, el, "top2000StrictContent", top2000ContentStrictCnt() );
+  addOneMetric( doc, el, "top3000StrictContent", top3000ContentStrictCnt() );
+  addOneMetric( doc, el, "top5000StrictContent", top5000ContentStrictCnt() );
+  addOneMetric( doc, el, "top10000StrictContent", top10000ContentStrictCnt() );
+  addOneMetric( doc, el, "top20000StrictContent", top20000ContentStrictCnt() );
+
+  addOneMetric( doc, el, "word_freq", word_freq() );
+  addOneMetric( doc, el, "word_freq_no_names", word_freq_n() );
   if ( !std::isnan(word_freq_log)  )
-    addOneMetric( doc, el, "log_word_freq", TiCC::toString(word_freq_log) );
+    addOneMetric( doc, el, "log_word_freq", word_freq_log );
   if ( !std::isnan(word_freq_log_n)  )
-    addOneMetric( doc, el, "log_word_freq_no_names", TiCC::toString(word_freq_log_n) );
-  addOneMetric( doc, el, "lemma_freq", TiCC::toString(lemma_freq) );
-  addOneMetric( doc, el, "lemma_freq_no_names", TiCC::toString(lemma_freq_n) );
+    addOneMetric( doc, el, "log_word_freq_no_names", word_freq_log_n );
+  addOneMetric( doc, el, "lemma_freq", lemma_freq() );
+  addOneMetric( doc, el, "lemma_freq_no_names", lemma_freq_n() );
   if ( !std::isnan(lemma_freq_log)  )
-    addOneMetric( doc, el, "log_lemma_freq", TiCC::toString(lemma_freq_log) );
+    addOneMetric( doc, el, "log_lemma_freq", lemma_freq_log );
   if ( !std::isnan(lemma_freq_log_n)  )
-    addOneMetric( doc, el, "log_lemma_freq_no_names", TiCC::toString(lemma_freq_log_n) );
+    addOneMetric( doc, el, "log_lemma_freq_no_names", lemma_freq_log_n );
 
   if ( !std::isnan(word_freq_log_strict)  )
-    addOneMetric( doc, el, "log_word_freq_strict", TiCC::toString(word_freq_log_strict) );
+    addOneMetric( doc, el, "log_word_freq_strict", word_freq_log_strict );
   if ( !std::isnan(word_freq_log_n_strict)  )
-    addOneMetric( doc, el, "log_word_freq_no_names_strict", TiCC::toString(word_freq_log_n_strict) );
+    addOneMetric( doc, el, "log_word_freq_no_names_strict", word_freq_log_n_strict );
   if ( !std::isnan(lemma_freq_log_strict)  )
-    addOneMetric( doc, el, "log_lemma_freq_strict", TiCC::toString(lemma_freq_log_strict) );
+    addOneMetric( doc, el, "log_lemma_freq_strict", lemma_freq_log_strict );
   if ( !std::isnan(lemma_freq_log_n_strict)  )
-    addOneMetric( doc, el, "log_lemma_freq_no_names_strict", TiCC::toString(lemma_freq_log_n_strict) );
-
-  if ( !std::isnan(avg_prob10_fwd) )
-    addOneMetric( doc, el, "wopr_logprob_fwd", TiCC::toString(avg_prob10_fwd) );
-  if ( !std::isnan(entropy_fwd) )
-    addOneMetric( doc, el, "wopr_entropy_fwd", TiCC::toString(entropy_fwd) );
-  if ( !std::isnan(perplexity_fwd) )
-    addOneMetric( doc, el, "wopr_perplexity_fwd", TiCC::toString(perplexity_fwd) );
-  if ( !std::isnan(avg_prob10_bwd) )
-    addOneMetric( doc, el, "wopr_logprob_bwd", TiCC::toString(avg_prob10_bwd) );
-  if ( !std::isnan(entropy_bwd) )
-    addOneMetric( doc, el, "wopr_entropy_bwd", TiCC::toString(entropy_bwd) );
-  if ( !std::isnan(perplexity_bwd) )
-    addOneMetric( doc, el, "wopr_perplexity_bwd", TiCC::toString(perplexity_bwd) );
-
-  addOneMetric( doc, el, "broad_adj", TiCC::toString(broadAdjCnt) );
-  addOneMetric( doc, el, "strict_adj", TiCC::toString(strictAdjCnt) );
-  addOneMetric( doc, el, "human_adj_count", TiCC::toString(humanAdjCnt) );
-  addOneMetric( doc, el, "emo_adj_count", TiCC::toString(emoAdjCnt) );
-  addOneMetric( doc, el, "nonhuman_adj_count", TiCC::toString(nonhumanAdjCnt) );
-  addOneMetric( doc, el, "shape_adj_count", TiCC::toString(shapeAdjCnt) );
-  addOneMetric( doc, el, "color_adj_count", TiCC::toString(colorAdjCnt) );
-  addOneMetric( doc, el, "matter_adj_count", TiCC::toString(matterAdjCnt) );
-  addOneMetric( doc, el, "sound_adj_count", TiCC::toString(soundAdjCnt) );
-  addOneMetric( doc, el, "other_nonhuman_adj_count", TiCC::toString(nonhumanOtherAdjCnt) );
-  addOneMetric( doc, el, "techn_adj_count", TiCC::toString(techAdjCnt) );
-  addOneMetric( doc, el, "time_adj_count", TiCC::toString(timeAdjCnt) );
-  addOneMetric( doc, el, "place_adj_count", TiCC::toString(placeAdjCnt) );
-  addOneMetric( doc, el, "pos_spec_adj_count", TiCC::toString(specPosAdjCnt) );
-  addOneMetric( doc, el, "neg_spec_adj_count", TiCC::toString(specNegAdjCnt) );
-  addOneMetric( doc, el, "pos_adj_count", TiCC::toString(posAdjCnt) );
-  addOneMetric( doc, el, "neg_adj_count", TiCC::toString(negAdjCnt) );
-  addOneMetric( doc, el, "evaluative_adj_count", TiCC::toString(evaluativeAdjCnt) );
-  addOneMetric( doc, el, "pos_epi_adj_count", TiCC::toString(epiPosAdjCnt) );
-  addOneMetric( doc, el, "neg_epi_adj_count", TiCC::toString(epiNegAdjCnt) );
-  addOneMetric( doc, el, "abstract_adj", TiCC::toString(abstractAdjCnt) );
-  addOneMetric( doc, el, "undefined_adj_count", TiCC::toString(undefinedAdjCnt) );
-  addOneMetric( doc, el, "covered_adj_count", TiCC::toString(adjCnt-uncoveredAdjCnt) );
-  addOneMetric( doc, el, "uncovered_adj_count", TiCC::toString(uncoveredAdjCnt) );
-
-  addOneMetric( doc, el, "intens_count", TiCC::toString(intensCnt) );
-  addOneMetric( doc, el, "intens_bvnw_count", TiCC::toString(intensBvnwCnt) );
-  addOneMetric( doc, el, "intens_bvbw_count", TiCC::toString(intensBvbwCnt) );
-  addOneMetric( doc, el, "intens_bw_count", TiCC::toString(intensBwCnt) );
-  addOneMetric( doc, el, "intens_combi_count", TiCC::toString(intensCombiCnt) );
-  addOneMetric( doc, el, "intens_nw_count", TiCC::toString(intensNwCnt) );
-  addOneMetric( doc, el, "intens_tuss_count", TiCC::toString(intensTussCnt) );
-  addOneMetric( doc, el, "intens_ww_count", TiCC::toString(intensWwCnt) );
-
-  addOneMetric( doc, el, "formal_count", TiCC::toString(formalCnt) );
-  addOneMetric( doc, el, "formal_bvnw_count", TiCC::toString(formalBvnwCnt) );
-  addOneMetric( doc, el, "formal_bw_count", TiCC::toString(formalBwCnt) );
-  addOneMetric( doc, el, "formal_vgw_count", TiCC::toString(formalVgwCnt) );
-  addOneMetric( doc, el, "formal_vnw_count", TiCC::toString(formalVnwCnt) );
-  addOneMetric( doc, el, "formal_vz_count", TiCC::toString(formalVzCnt) );
-  addOneMetric( doc, el, "formal_vzg_count", TiCC::toString(formalVzgCnt) );
-  addOneMetric( doc, el, "formal_ww_count", TiCC::toString(formalWwCnt) );
-  addOneMetric( doc, el, "formal_znw_count", TiCC::toString(formalZnwCnt) );  
-
-  addOneMetric( doc, el, "general_noun_count", TiCC::toString(generalNounCnt) );
-  addOneMetric( doc, el, "general_noun_sep_count", TiCC::toString(generalNounSepCnt) );
-  addOneMetric( doc, el, "general_noun_rel_count", TiCC::toString(generalNounRelCnt) );
-  addOneMetric( doc, el, "general_noun_act_count", TiCC::toString(generalNounActCnt) );
-  addOneMetric( doc, el, "general_noun_know_count", TiCC::toString(generalNounKnowCnt) );
-  addOneMetric( doc, el, "general_noun_disc_count", TiCC::toString(generalNounDiscCnt) );
-  addOneMetric( doc, el, "general_noun_deve_count", TiCC::toString(generalNounDeveCnt) );
-
-  addOneMetric( doc, el, "general_verb_count", TiCC::toString(generalVerbCnt) );
-  addOneMetric( doc, el, "general_verb_sep_count", TiCC::toString(generalVerbSepCnt) );
-  addOneMetric( doc, el, "general_verb_rel_count", TiCC::toString(generalVerbRelCnt) );
-  addOneMetric( doc, el, "general_verb_act_count", TiCC::toString(generalVerbActCnt) );
-  addOneMetric( doc, el, "general_verb_know_count", TiCC::toString(generalVerbKnowCnt) );
-  addOneMetric( doc, el, "general_verb_disc_count", TiCC::toString(generalVerbDiscCnt) );
-  addOneMetric( doc, el, "general_verb_deve_count", TiCC::toString(generalVerbDeveCnt) );
-
-  addOneMetric( doc, el, "general_adverb_count", TiCC::toString(generalAdverbCnt) );
-  addOneMetric( doc, el, "specific_adverb_count", TiCC::toString(specificAdverbCnt) );
-
-  addOneMetric( doc, el, "broad_noun", TiCC::toString(broadNounCnt) );
-  addOneMetric( doc, el, "strict_noun", TiCC::toString(strictNounCnt) );
-  addOneMetric( doc, el, "human_nouns_count", TiCC::toString(humanCnt) );
-  addOneMetric( doc, el, "nonhuman_nouns_count", TiCC::toString(nonHumanCnt) );
-  addOneMetric( doc, el, "artefact_nouns_count", TiCC::toString(artefactCnt) );
-  addOneMetric( doc, el, "concrother_nouns_count", TiCC::toString(concrotherCnt) );
-  addOneMetric( doc, el, "substance_conc_nouns_count", TiCC::toString(substanceConcCnt) );
-  addOneMetric( doc, el, "foodcare_nouns_count", TiCC::toString(foodcareCnt) );
-  addOneMetric( doc, el, "time_nouns_count", TiCC::toString(timeCnt) );
-  addOneMetric( doc, el, "place_nouns_count", TiCC::toString(placeCnt) );
-  addOneMetric( doc, el, "measure_nouns_count", TiCC::toString(measureCnt) );
-  addOneMetric( doc, el, "dynamic_conc_nouns_count", TiCC::toString(dynamicConcCnt) );
-  addOneMetric( doc, el, "substance_abstr_nouns_count", TiCC::toString(substanceAbstrCnt) );
-  addOneMetric( doc, el, "dynamic_abstr_nouns_count", TiCC::toString(dynamicAbstrCnt) );
-  addOneMetric( doc, el, "nondynamic_nouns_count", TiCC::toString(nonDynamicCnt) );
-  addOneMetric( doc, el, "institut_nouns_count", TiCC::toString(institutCnt) );
-  addOneMetric( doc, el, "undefined_nouns_count", TiCC::toString(undefinedNounCnt) );
-  addOneMetric( doc, el, "covered_nouns_count", TiCC::toString(nounCnt+nameCnt-uncoveredNounCnt) );
-  addOneMetric( doc, el, "uncovered_nouns_count", TiCC::toString(uncoveredNounCnt) );
-
-  addOneMetric( doc, el, "abstract_ww", TiCC::toString(abstractWwCnt) );
-  addOneMetric( doc, el, "concrete_ww", TiCC::toString(concreteWwCnt) );
-  addOneMetric( doc, el, "undefined_ww", TiCC::toString(undefinedWwCnt) );
-  addOneMetric( doc, el, "undefined_ATP", TiCC::toString(undefinedATPCnt) );
-  addOneMetric( doc, el, "state_count", TiCC::toString(stateCnt) );
-  addOneMetric( doc, el, "action_count", TiCC::toString(actionCnt) );
-  addOneMetric( doc, el, "process_count", TiCC::toString(processCnt) );
-  addOneMetric( doc, el, "covered_verb_count", TiCC::toString(verbCnt-uncoveredVerbCnt) );
-  addOneMetric( doc, el, "uncovered_verb_count", TiCC::toString(uncoveredVerbCnt) );
-  addOneMetric( doc, el, "indef_np_count", TiCC::toString(indefNpCnt) );
-  addOneMetric( doc, el, "np_count", TiCC::toString(npCnt) );
-  addOneMetric( doc, el, "np_size", TiCC::toString(npSize) );
-  addOneMetric( doc, el, "vc_modifier_count", TiCC::toString(vcModCnt) );
-  addOneMetric( doc, el, "vc_modifier_single_count", TiCC::toString(vcModSingleCnt) );
-  addOneMetric( doc, el, "adj_np_modifier_count", TiCC::toString(adjNpModCnt) );
-  addOneMetric( doc, el, "np_modifier_count", TiCC::toString(npModCnt) );
-
-  addOneMetric( doc, el, "character_count", TiCC::toString(charCnt) );
-  addOneMetric( doc, el, "character_count_min_names", TiCC::toString(charCntExNames) );
-  addOneMetric( doc, el, "morpheme_count", TiCC::toString(morphCnt) );
-  addOneMetric( doc, el, "morpheme_count_min_names", TiCC::toString(morphCntExNames) );
+    addOneMetric( doc, el, "log_lemma_freq_no_names_strict", lemma_freq_log_n_strict );
+
+  if ( !std::isnan(avg_prob10_fwd()) )
+    addOneMetric( doc, el, "wopr_logprob_fwd", avg_prob10_fwd() );
+  if ( !std::isnan(entropy_fwd()) )
+    addOneMetric( doc, el, "wopr_entropy_fwd", entropy_fwd() );
+  if ( !std::isnan(perplexity_fwd()) )
+    addOneMetric( doc, el, "wopr_perplexity_fwd", perplexity_fwd() );
+  if ( !std::isnan(avg_prob10_bwd()) )
+    addOneMetric( doc, el, "wopr_logprob_bwd", avg_prob10_bwd() );
+  if ( !std::isnan(entropy_bwd()) )
+    addOneMetric( doc, el, "wopr_entropy_bwd", entropy_bwd() );
+  if ( !std::isnan(perplexity_bwd()) )
+    addOneMetric( doc, el, "wopr_perplexity_bwd", perplexity_bwd() );
+
+  addOneMetric( doc, el, "broad_adj", broadAdjCnt() );
+  addOneMetric( doc, el, "strict_adj", strictAdjCnt() );
+  addOneMetric( doc, el, "human_adj_count", humanAdjCnt() );
+  addOneMetric( doc, el, "emo_adj_count", emoAdjCnt() );
+  addOneMetric( doc, el, "nonhuman_adj_count", nonhumanAdjCnt() );
+  addOneMetric( doc, el, "shape_adj_count", shapeAdjCnt() );
+  addOneMetric( doc, el, "color_adj_count", colorAdjCnt() );
+  addOneMetric( doc, el, "matter_adj_count", matterAdjCnt() );
+  addOneMetric( doc, el, "sound_adj_count", soundAdjCnt() );
+  addOneMetric( doc, el, "other_nonhuman_adj_count", nonhumanOtherAdjCnt() );
+  addOneMetric( doc, el, "techn_adj_count", techAdjCnt() );
+  addOneMetric( doc, el, "time_adj_count", timeAdjCnt() );
+  addOneMetric( doc, el, "place_adj_count", placeAdjCnt() );
+  addOneMetric( doc, el, "pos_spec_adj_count", specPosAdjCnt() );
+  addOneMetric( doc, el, "neg_spec_adj_count", specNegAdjCnt() );
+  addOneMetric( doc, el, "pos_adj_count", posAdjCnt() );
+  addOneMetric( doc, el, "neg_adj_count", negAdjCnt() );
+  addOneMetric( doc, el, "evaluative_adj_count", evaluativeAdjCnt() );
+  addOneMetric( doc, el, "pos_epi_adj_count", epiPosAdjCnt() );
+  addOneMetric( doc, el, "neg_epi_adj_count", epiNegAdjCnt() );
+  addOneMetric( doc, el, "abstract_adj", abstractAdjCnt() );
+  addOneMetric( doc, el, "undefined_adj_count", undefinedAdjCnt() );
+  addOneMetric( doc, el, "covered_adj_count", adjCnt()-uncoveredAdjCnt() );
+  addOneMetric( doc, el, "uncovered_adj_count", uncoveredAdjCnt() );
+
+  addOneMetric( doc, el, "intens_count", intensCnt() );
+  addOneMetric( doc, el, "intens_bvnw_count", intensBvnwCnt() );
+  addOneMetric( doc, el, "intens_bvbw_count", intensBvbwCnt() );
+  addOneMetric( doc, el, "intens_bw_count", intensBwCnt() );
+  addOneMetric( doc, el, "intens_combi_count", intensCombiCnt() );
+  addOneMetric( doc, el, "intens_nw_count", intensNwCnt() );
+  addOneMetric( doc, el, "intens_tuss_count", intensTussCnt() );
+  addOneMetric( doc, el, "intens_ww_count", intensWwCnt() );
+
+  addOneMetric( doc, el, "formal_count", formalCnt() );
+  addOneMetric( doc, el, "formal_bvnw_count", formalBvnwCnt() );
+  addOneMetric( doc, el, "formal_bw_count", formalBwCnt() );
+  addOneMetric( doc, el, "formal_vgw_count", formalVgwCnt() );
+  addOneMetric( doc, el, "formal_vnw_count", formalVnwCnt() );
+  addOneMetric( doc, el, "formal_vz_count", formalVzCnt() );
+  addOneMetric( doc, el, "formal_vzg_count", formalVzgCnt() );
+  addOneMetric( doc, el, "formal_ww_count", formalWwCnt() );
+  addOneMetric( doc, el, "formal_znw_count", formalZnwCnt() );  
+
+  addOneMetric( doc, el, "general_noun_count", generalNounCnt() );
+  addOneMetric( doc, el, "general_noun_sep_count", generalNounSepCnt() );
+  addOneMetric( doc, el, "general_noun_rel_count", generalNounRelCnt() );
+  addOneMetric( doc, el, "general_noun_act_count", generalNounActCnt() );
+  addOneMetric( doc, el, "general_noun_know_count", generalNounKnowCnt() );
+  addOneMetric( doc, el, "general_noun_disc_count", generalNounDiscCnt() );
+  addOneMetric( doc, el, "general_noun_deve_count", generalNounDeveCnt() );
+
+  addOneMetric( doc, el, "general_verb_count", generalVerbCnt() );
+  addOneMetric( doc, el, "general_verb_sep_count", generalVerbSepCnt() );
+  addOneMetric( doc, el, "general_verb_rel_count", generalVerbRelCnt() );
+  addOneMetric( doc, el, "general_verb_act_count", generalVerbActCnt() );
+  addOneMetric( doc, el, "general_verb_know_count", generalVerbKnowCnt() );
+  addOneMetric( doc, el, "general_verb_disc_count", generalVerbDiscCnt() );
+  addOneMetric( doc, el, "general_verb_deve_count", generalVerbDeveCnt() );
+
+  addOneMetric( doc, el, "general_adverb_count", generalAdverbCnt() );
+  addOneMetric( doc, el, "specific_adverb_count", specificAdverbCnt() );
+
+  addOneMetric( doc, el, "broad_noun", broadNounCnt() );
+  addOneMetric( doc, el, "strict_noun", strictNounCnt() );
+  addOneMetric( doc, el, "human_nouns_count", humanCnt() );
+  addOneMetric( doc, el, "nonhuman_nouns_count", nonHumanCnt() );
+  addOneMetric( doc, el, "artefact_nouns_count", artefactCnt() );
+  addOneMetric( doc, el, "concrother_nouns_count", concrotherCnt() );
+  addOneMetric( doc, el, "substance_conc_nouns_count", substanceConcCnt() );
+  addOneMetric( doc, el, "foodcare_nouns_count", foodcareCnt() );
+  addOneMetric( doc, el, "time_nouns_count", timeCnt() );
+  addOneMetric( doc, el, "place_nouns_count", placeCnt() );
+  addOneMetric( doc, el, "measure_nouns_count", measureCnt() );
+  addOneMetric( doc, el, "dynamic_conc_nouns_count", dynamicConcCnt() );
+  addOneMetric( doc, el, "substance_abstr_nouns_count", substanceAbstrCnt() );
+  addOneMetric( doc, el, "dynamic_abstr_nouns_count", dynamicAbstrCnt() );
+  addOneMetric( doc, el, "nondynamic_nouns_count", nonDynamicCnt() );
+  addOneMetric( doc, el, "institut_nouns_count", institutCnt() );
+  addOneMetric( doc, el, "undefined_nouns_count", undefinedNounCnt() );
+  addOneMetric( doc, el, "covered_nouns_count", nounCnt()+nameCnt()-uncoveredNounCnt() );
+  addOneMetric( doc, el, "uncovered_nouns_count", uncoveredNounCnt() );
+
+  addOneMetric( doc, el, "abstract_ww", abstractWwCnt() );
+  addOneMetric( doc, el, "concrete_ww", concreteWwCnt() );
+  addOneMetric( doc, el, "undefined_ww", undefinedWwCnt() );
+  addOneMetric( doc, el, "undefined_ATP", undefinedATPCnt() );
+  addOneMetric( doc, el, "state_count", stateCnt() );
+  addOneMetric( doc, el, "action_count", actionCnt() );
+  addOneMetric( doc, el, "process_count", processCnt() );
+  addOneMetric( doc, el, "covered_verb_count", verbCnt()-uncoveredVerbCnt() );
+  addOneMetric( doc, el, "uncovered_verb_count", uncoveredVerbCnt() );
+  addOneMetric( doc, el, "indef_np_count", indefNpCnt() );
+  addOneMetric( doc, el, "np_count", npCnt() );
+  addOneMetric( doc, el, "np_size", npSize() );
+  addOneMetric( doc, el, "vc_modifier_count", vcModCnt() );
+  addOneMetric( doc, el, "vc_modifier_single_count", vcModSingleCnt() );
+  addOneMetric( doc, el, "adj_np_modifier_count", adjNpModCnt() );
+  addOneMetric( doc, el, "np_modifier_count", npModCnt() );
+
+  addOneMetric( doc, el, "character_count", charCnt );
+  addOneMetric( doc, el, "character_count_min_names", charCntExNames );
+  addOneMetric( doc, el, "morpheme_count", morphCnt );
+  addOneMetric( doc, el, "morpheme_count_min_names", morphCntExNames );
   if ( dLevel >= 0 )
-    addOneMetric( doc, el, "d_level", TiCC::toString(dLevel) );
+    addOneMetric( doc, el, "d_level", dLevel );
   else
     addOneMetric( doc, el, "d_level", "missing" );
-  if ( dLevel_gt4 != 0 )
-    addOneMetric( doc, el, "d_level_gt4", TiCC::toString(dLevel_gt4) );
-  if ( questCnt > 0 )
-    addOneMetric( doc, el, "question_count", TiCC::toString(questCnt) );
-  if ( impCnt > 0 )
-    addOneMetric( doc, el, "imperative_count", TiCC::toString(impCnt) );
+  if ( dLevel_gt4() != 0 )
+    addOneMetric( doc, el, "d_level_gt4", dLevel_gt4() );
+  if ( questCnt() > 0 )
+    addOneMetric( doc, el, "question_count", questCnt() );
+  if ( impCnt() > 0 )
+    addOneMetric( doc, el, "imperative_count", impCnt() );
   addOneMetric( doc, el, "sub_verb_dist", MMtoString( distances, SUB_VERB ) );
   addOneMetric( doc, el, "obj_verb_dist", MMtoString( distances, OBJ1_VERB ) );
   addOneMetric( doc, el, "lijdend_verb_dist", MMtoString( distances, OBJ2_VERB ) );
@@ -1376,299 +1052,34 @@ void structStats::merge( structStats *ss ){
     parseFailCnt = -1;
   else
     parseFailCnt += ss->parseFailCnt;
-  wordCnt += ss->wordCnt;
-  wordInclCnt += ss->wordInclCnt;
-  if ( ss->wordCnt != 0 ) // don't count sentences without words
+  if ( ss->wordCnt() != 0 ) // don't count sentences without words
     sentCnt += ss->sentCnt;
   charCnt += ss->charCnt;
   charCntExNames += ss->charCntExNames;
   morphCnt += ss->morphCnt;
   morphCntExNames += ss->morphCntExNames;
-  nameCnt += ss->nameCnt;
-  nameInclCnt += ss->nameInclCnt;
-  infBvCnt += ss->infBvCnt;
-  infNwCnt += ss->infNwCnt;
-  infVrijCnt += ss->infVrijCnt;
-  vdBvCnt += ss->vdBvCnt;
-  vdNwCnt += ss->vdNwCnt;
-  vdVrijCnt += ss->vdVrijCnt;
-  odBvCnt += ss->odBvCnt;
-  odNwCnt += ss->odNwCnt;
-  odVrijCnt += ss->odVrijCnt;
-  passiveCnt += ss->passiveCnt;
-  modalCnt += ss->modalCnt;
-  timeVCnt += ss->timeVCnt;
-  koppelCnt += ss->koppelCnt;
-  archaicsCnt += ss->archaicsCnt;
-  contentCnt += ss->contentCnt;
-  contentInclCnt += ss->contentInclCnt;
-  contentStrictCnt += ss->contentStrictCnt;
-  contentStrictInclCnt += ss->contentStrictInclCnt;
-  nominalCnt += ss->nominalCnt;
-  adjCnt += ss->adjCnt;
-  adjInclCnt += ss->adjInclCnt;
-  vgCnt += ss->vgCnt;
-  vnwCnt += ss->vnwCnt;
-  lidCnt += ss->lidCnt;
-  vzCnt += ss->vzCnt;
-  bwCnt += ss->bwCnt;
-  twCnt += ss->twCnt;
-  nounCnt += ss->nounCnt;
-  nounInclCnt += ss->nounInclCnt;
-  verbCnt += ss->verbCnt;
-  verbInclCnt += ss->verbInclCnt;
-  tswCnt += ss->tswCnt;
-  specCnt += ss->specCnt;
-  letCnt += ss->letCnt;
-  betrCnt += ss->betrCnt;
-  bijwCnt += ss->bijwCnt;
-  complCnt += ss->complCnt;
-  mvFinInbedCnt += ss->mvFinInbedCnt;
-  infinComplBepCnt += ss->infinComplBepCnt;
-  mvInbedCnt += ss->mvInbedCnt;
-  losBetrCnt += ss->losBetrCnt;
-  losBijwCnt += ss->losBijwCnt;
-
-  allConnCnt += ss->allConnCnt;
-  tempConnCnt += ss->tempConnCnt;
-  opsomWgConnCnt += ss->opsomWgConnCnt;
-  opsomZinConnCnt += ss->opsomZinConnCnt;
-  contrastConnCnt += ss->contrastConnCnt;
-  compConnCnt += ss->compConnCnt;
-  causeConnCnt += ss->causeConnCnt;
-
-  timeSitCnt += ss->timeSitCnt;
-  spaceSitCnt += ss->spaceSitCnt;
-  causeSitCnt += ss->causeSitCnt;
-  emoSitCnt += ss->emoSitCnt;
-  prepExprCnt += ss->prepExprCnt;
-  propNegCnt += ss->propNegCnt;
-  morphNegCnt += ss->morphNegCnt;
-  multiNegCnt += ss->multiNegCnt;
-  wordOverlapCnt += ss->wordOverlapCnt;
-  lemmaOverlapCnt += ss->lemmaOverlapCnt;
-  prevalenceP += ss->prevalenceP;
-  prevalenceZ += ss->prevalenceZ;
-  prevalenceContentP += ss->prevalenceContentP;
-  prevalenceContentZ += ss->prevalenceContentZ;
-  prevalenceCovered += ss->prevalenceCovered;
-  prevalenceContentCovered += ss->prevalenceContentCovered;
-  f50Cnt += ss->f50Cnt;
-  f65Cnt += ss->f65Cnt;
-  f77Cnt += ss->f77Cnt;
-  f80Cnt += ss->f80Cnt;
-
-  top1000Cnt += ss->top1000Cnt;
-  top2000Cnt += ss->top2000Cnt;
-  top3000Cnt += ss->top3000Cnt;
-  top5000Cnt += ss->top5000Cnt;
-  top10000Cnt += ss->top10000Cnt;
-  top20000Cnt += ss->top20000Cnt;
-  top1000ContentCnt += ss->top1000ContentCnt;
-  top2000ContentCnt += ss->top2000ContentCnt;
-  top3000ContentCnt += ss->top3000ContentCnt;
-  top5000ContentCnt += ss->top5000ContentCnt;
-  top10000ContentCnt += ss->top10000ContentCnt;
-  top20000ContentCnt += ss->top20000ContentCnt;
-  top1000ContentStrictCnt += ss->top1000ContentStrictCnt;
-  top2000ContentStrictCnt += ss->top2000ContentStrictCnt;
-  top3000ContentStrictCnt += ss->top3000ContentStrictCnt;
-  top5000ContentStrictCnt += ss->top5000ContentStrictCnt;
-  top10000ContentStrictCnt += ss->top10000ContentStrictCnt;
-  top20000ContentStrictCnt += ss->top20000ContentStrictCnt;
-
-  word_freq += ss->word_freq;
-  word_freq_n += ss->word_freq_n;
-  lemma_freq += ss->lemma_freq;
-  lemma_freq_n += ss->lemma_freq_n;
-
-  word_freq_strict += ss->word_freq_strict;
-  word_freq_n_strict += ss->word_freq_n_strict;
-  lemma_freq_strict += ss->lemma_freq_strict;
-  lemma_freq_n_strict += ss->lemma_freq_n_strict;
-
-  // Wopr forwards probabilities
-  avg_prob10_fwd += ss->avg_prob10_fwd;
-  avg_prob10_fwd_content += ss->avg_prob10_fwd_content;
-  avg_prob10_fwd_ex_names += ss->avg_prob10_fwd_ex_names;
-  avg_prob10_fwd_content_ex_names += ss->avg_prob10_fwd_content_ex_names;
-  entropy_fwd += ss->entropy_fwd;
-  entropy_fwd_norm += ss->entropy_fwd_norm;
-  perplexity_fwd += ss->perplexity_fwd;
-  perplexity_fwd_norm += ss->perplexity_fwd_norm;
-  
-  // Wopr backwards probabilities
-  avg_prob10_bwd += ss->avg_prob10_bwd;
-  avg_prob10_bwd_content += ss->avg_prob10_bwd_content;
-  avg_prob10_bwd_ex_names += ss->avg_prob10_bwd_ex_names;
-  avg_prob10_bwd_content_ex_names += ss->avg_prob10_bwd_content_ex_names;
-  entropy_bwd += ss->entropy_bwd;
-  entropy_bwd_norm += ss->entropy_bwd_norm;
-  perplexity_bwd += ss->perplexity_bwd;
-  perplexity_bwd_norm += ss->perplexity_bwd_norm;
-
-  intensCnt += ss->intensCnt;
-  intensBvnwCnt += ss->intensBvnwCnt;
-  intensBvbwCnt += ss->intensBvbwCnt;
-  intensBwCnt += ss->intensBwCnt;
-  intensCombiCnt += ss->intensCombiCnt;
-  intensNwCnt += ss->intensNwCnt;
-  intensTussCnt += ss->intensTussCnt;
-  intensWwCnt += ss->intensWwCnt;
-
-  formalCnt += ss->formalCnt;
-  formalBvnwCnt += ss->formalBvnwCnt;
-  formalBwCnt += ss->formalBwCnt;
-  formalVgwCnt += ss->formalVgwCnt;
-  formalVnwCnt += ss->formalVnwCnt;
-  formalVzCnt += ss->formalVzCnt;
-  formalVzgCnt += ss->formalVzgCnt;
-  formalWwCnt += ss->formalWwCnt;
-  formalZnwCnt += ss->formalZnwCnt;
-
-  generalNounCnt += ss->generalNounCnt;
-  generalNounSepCnt += ss->generalNounSepCnt;
-  generalNounRelCnt += ss->generalNounRelCnt;
-  generalNounActCnt += ss->generalNounActCnt;
-  generalNounKnowCnt += ss->generalNounKnowCnt;
-  generalNounDiscCnt += ss->generalNounDiscCnt;
-  generalNounDeveCnt += ss->generalNounDeveCnt;
-  generalVerbCnt += ss->generalVerbCnt;
-  generalVerbSepCnt += ss->generalVerbSepCnt;
-  generalVerbRelCnt += ss->generalVerbRelCnt;
-  generalVerbActCnt += ss->generalVerbActCnt;
-  generalVerbKnowCnt += ss->generalVerbKnowCnt;
-  generalVerbDiscCnt += ss->generalVerbDiscCnt;
-  generalVerbDeveCnt += ss->generalVerbDeveCnt;
-  generalAdverbCnt += ss->generalAdverbCnt;
-  specificAdverbCnt += ss->specificAdverbCnt;
-  smainCnt += ss->smainCnt;
-  ssubCnt += ss->ssubCnt;
-  sv1Cnt += ss->sv1Cnt;
-  clauseCnt += ss->clauseCnt;
-  correctedClauseCnt += ss->correctedClauseCnt;
-  smainCnjCnt += ss->smainCnjCnt;
-  ssubCnjCnt += ss->ssubCnjCnt;
-  sv1CnjCnt += ss->sv1CnjCnt;
-  presentCnt += ss->presentCnt;
-  pastCnt += ss->pastCnt;
-  subjonctCnt += ss->subjonctCnt;
-  pron1Cnt += ss->pron1Cnt;
-  pron2Cnt += ss->pron2Cnt;
-  pron3Cnt += ss->pron3Cnt;
-  persRefCnt += ss->persRefCnt;
-  pronRefCnt += ss->pronRefCnt;
-  strictNounCnt += ss->strictNounCnt;
-  broadNounCnt += ss->broadNounCnt;
-  strictAdjCnt += ss->strictAdjCnt;
-  broadAdjCnt += ss->broadAdjCnt;
-  subjectiveAdjCnt += ss->subjectiveAdjCnt;
-  abstractWwCnt += ss->abstractWwCnt;
-  concreteWwCnt += ss->concreteWwCnt;
-  undefinedWwCnt += ss->undefinedWwCnt;
-  undefinedATPCnt += ss->undefinedATPCnt;
-  stateCnt += ss->stateCnt;
-  actionCnt += ss->actionCnt;
-  processCnt += ss->processCnt;
-  humanAdjCnt += ss->humanAdjCnt;
-  emoAdjCnt += ss->emoAdjCnt;
-  nonhumanAdjCnt += ss->nonhumanAdjCnt;
-  shapeAdjCnt += ss->shapeAdjCnt;
-  colorAdjCnt += ss->colorAdjCnt;
-  matterAdjCnt += ss->matterAdjCnt;
-  soundAdjCnt += ss->soundAdjCnt;
-  nonhumanOtherAdjCnt += ss->nonhumanOtherAdjCnt;
-  techAdjCnt += ss->techAdjCnt;
-  timeAdjCnt += ss->timeAdjCnt;
-  placeAdjCnt += ss->placeAdjCnt;
-  specPosAdjCnt += ss->specPosAdjCnt;
-  specNegAdjCnt += ss->specNegAdjCnt;
-  posAdjCnt += ss->posAdjCnt;
-  negAdjCnt += ss->negAdjCnt;
-  evaluativeAdjCnt += ss->evaluativeAdjCnt;
-  epiPosAdjCnt += ss->epiPosAdjCnt;
-  epiNegAdjCnt += ss->epiNegAdjCnt;
-  abstractAdjCnt += ss->abstractAdjCnt;
-  undefinedNounCnt += ss->undefinedNounCnt;
-  uncoveredNounCnt += ss->uncoveredNounCnt;
-  undefinedAdjCnt += ss->undefinedAdjCnt;
-  uncoveredAdjCnt += ss->uncoveredAdjCnt;
-  uncoveredVerbCnt += ss->uncoveredVerbCnt;
-  humanCnt += ss->humanCnt;
-  nonHumanCnt += ss->nonHumanCnt;
-  artefactCnt += ss->artefactCnt;
-  concrotherCnt += ss->concrotherCnt;
-  substanceConcCnt += ss->substanceConcCnt;
-  foodcareCnt += ss->foodcareCnt;
-  timeCnt += ss->timeCnt;
-  placeCnt += ss->placeCnt;
-  measureCnt += ss->measureCnt;
-  dynamicConcCnt += ss->dynamicConcCnt;
-  substanceAbstrCnt += ss->substanceAbstrCnt;
-  dynamicAbstrCnt += ss->dynamicAbstrCnt;
-  nonDynamicCnt += ss->nonDynamicCnt;
-  institutCnt += ss->institutCnt;
-  npCnt += ss->npCnt;
-  indefNpCnt += ss->indefNpCnt;
-  npSize += ss->npSize;
-  vcModCnt += ss->vcModCnt;
-  vcModSingleCnt += ss->vcModSingleCnt;
-  adjNpModCnt += ss->adjNpModCnt;
-  npModCnt += ss->npModCnt;
-  smallCnjCnt += ss->smallCnjCnt;
-  smallCnjExtraCnt += ss->smallCnjExtraCnt;
+  for ( size_t i=0; i < int_sums.size(); ++i ){
+    int_sums[i] += ss->int_sums[i];
+  }
+  for ( size_t i=0; i < double_sums.size(); ++i ){
+    double_sums[i] += ss->double_sums[i];
+  }
   if ( ss->dLevel >= 0 ){
     if ( dLevel < 0 )
       dLevel = ss->dLevel;
     else
       dLevel += ss->dLevel;
   }
-  dLevel_gt4 += ss->dLevel_gt4;
-  impCnt += ss->impCnt;
-  questCnt += ss->questCnt;
-  nerCnt += ss->nerCnt;
-  compoundCnt += ss->compoundCnt;
-  compound3Cnt += ss->compound3Cnt;
-  charCntNoun += ss->charCntNoun;
-  charCntNonComp += ss->charCntNonComp;
-  charCntComp += ss->charCntComp;
-  charCntHead += ss->charCntHead;
-  charCntSat += ss->charCntSat;
-  charCntNounCorr += ss->charCntNounCorr;
-  charCntCorr += ss->charCntCorr;
-  word_freq_log_noun += ss->word_freq_log_noun;
-  word_freq_log_non_comp += ss->word_freq_log_non_comp;
-  word_freq_log_comp += ss->word_freq_log_comp;
-  word_freq_log_head += ss->word_freq_log_head;
-  word_freq_log_sat += ss->word_freq_log_sat;
-  word_freq_log_head_sat += ss->word_freq_log_head_sat;
-  word_freq_log_noun_corr += ss->word_freq_log_noun_corr;
-  word_freq_log_corr += ss->word_freq_log_corr;
-  word_freq_log_corr_strict += ss->word_freq_log_corr_strict;
-  word_freq_log_n_corr += ss->word_freq_log_n_corr;
-  word_freq_log_n_corr_strict += ss->word_freq_log_n_corr_strict;
-  top1000CntNoun += ss->top1000CntNoun;
-  top1000CntNonComp += ss->top1000CntNonComp;
-  top1000CntComp += ss->top1000CntComp;
-  top1000CntHead += ss->top1000CntHead;
-  top1000CntSat += ss->top1000CntSat;
-  top1000CntNounCorr += ss->top1000CntNounCorr;
-  top1000CntCorr += ss->top1000CntCorr;
-  top5000CntNoun += ss->top5000CntNoun;
-  top5000CntNonComp += ss->top5000CntNonComp;
-  top5000CntComp += ss->top5000CntComp;
-  top5000CntHead += ss->top5000CntHead;
-  top5000CntSat += ss->top5000CntSat;
-  top5000CntNounCorr += ss->top5000CntNounCorr;
-  top5000CntCorr += ss->top5000CntCorr;
-  top20000CntNoun += ss->top20000CntNoun;
-  top20000CntNonComp += ss->top20000CntNonComp;
-  top20000CntComp += ss->top20000CntComp;
-  top20000CntHead += ss->top20000CntHead;
-  top20000CntSat += ss->top20000CntSat;
-  top20000CntNounCorr += ss->top20000CntNounCorr;
-  top20000CntCorr += ss->top20000CntCorr;
   updateCounter(my_classification, ss->my_classification);
+  // children are merged in document order, so their words are adjacent.
+  // Children without words, like a paragraph without sentences, may have
+  // no span at all, so they are left out.
+  if ( !ss->words.empty() ){
+    if ( words.empty() ){
+      words.first = ss->words.first;
+    }
+    words.last = ss->words.last;
+  }
   sv.push_back( ss );
   aggregate( heads, ss->heads );
   aggregate( unique_names, ss->unique_names );
@@ -0,0 +1,79 @@
+#include "ticcutils/StringOps.h"
+#include "ticcutils/Unicode.h"
+#include "tscan/tokens.h"
+
+using namespace std;
+
+const string frog_pos_set = "http://ilk.uvt.nl/folia/sets/frog-mbpos-cgn";
+const string frog_lemma_set = "http://ilk.uvt.nl/folia/sets/frog-mblem-nl";
+
+/**
+ * Selects and decodes the Frog POS tag and lemma of every word once.
+ * Words without a unique POS tag are kept, with pa == 0: it is up to
+ * the users of the table to complain about that, as they did before.
+ * @param s the sentence
+ */
+tokenTable::tokenTable( const folia::Sentence *s ):
+  wordlist( s->words() ) {
+  tokens.resize( wordlist.size() );
+  for ( size_t i = 0; i < wordlist.size(); ++i ) {
+    folia::Word *w = wordlist[i];
+    tokenInfo& t = tokens[i];
+    positions[w] = i;
+    t.word = w;
+    icu::UnicodeString us = w->text();
+    t.charCnt = us.length();
+    t.word_id = Intern::intern( TiCC::UnicodeToUTF8( us ) );
+    t.l_word_id = Intern::intern( TiCC::UnicodeToUTF8( us.toLower() ) );
+    t.head = CGN::UNASS;
+    t.wvorm = CGN::NO_WVORM;
+    t.position = CGN::NOPOS;
+    t.pvtijd = CGN::NO_PVTIJD;
+    t.conjtype = CGN::NO_CONJTYPE;
+    t.isPunct = false;
+    t.lemma_id = Intern::EMPTY;
+    t.l_lemma_id = Intern::EMPTY;
+    vector<folia::PosAnnotation *> posV = w->select<folia::PosAnnotation>( frog_pos_set );
+    if ( posV.size() != 1 ) {
+      t.pa = 0;
+      continue;
+    }
+    t.pa = posV[0];
+    string head = t.pa->feat( "head" );
+    t.head = CGN::toCGN( head );
+    switch ( t.head ) {
+      case CGN::LET:
+        t.isPunct = true;
+        puncts.insert( i );
+        break;
+      case CGN::WW:
+        t.wvorm = CGN::toWVorm( t.pa->feat( "wvorm" ) );
+        if ( t.wvorm == CGN::WV_PV ) {
+          t.pvtijd = CGN::toPvTijd( t.pa->feat( "pvtijd" ) );
+        }
+        else if ( t.wvorm != CGN::NO_WVORM && t.wvorm != CGN::WV_UNKNOWN ) {
+          t.position = CGN::toPosition( t.pa->feat( "positie" ) );
+        }
+        break;
+      case CGN::VG:
+        t.conjtype = CGN::toConjType( t.pa->feat( "conjtype" ) );
+        break;
+      default:;
+    }
+    string lemma = w->lemma( frog_lemma_set );
+    t.lemma_id = Intern::intern( lemma );
+    us = TiCC::UnicodeFromUTF8( lemma );
+    t.l_lemma_id = Intern::intern( TiCC::UnicodeToUTF8( us.toLower() ) );
+  }
+}
+
+/**
+ * Returns the token of a word in this sentence, or 0 for other elements.
+ */
+const tokenInfo *tokenTable::find( const folia::FoliaElement *e ) const {
+  unordered_map<const folia::FoliaElement*,size_t>::const_iterator it = positions.find( e );
+  if ( it == positions.end() ) {
+    return 0;
+  }
+  return &tokens[it->second];
+}
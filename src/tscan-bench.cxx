@@ -0,0 +1,599 @@
+/*
+  T-scan
+
+  Copyright (c) 1998 - 2018
+
+  This file is part of tscan
+
+  tscan is free software; you can redistribute it and/or modify
+  it under the terms of the GNU Affero General Public License as published by
+  the Free Software Foundation; either version 3 of the License, or
+  (at your option) any later version.
+
+  tscan is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU Affere General Public License for more details.
+
+  You should have received a copy of the GNU Affero General Public License
+  along with this program; if not, see <http://www.gnu.org/licenses/>.
+
+*/
+
+#include <string>
+#include <vector>
+#include <map>
+#include <set>
+#include <deque>
+#include <memory>
+#include <chrono>
+#include <functional>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <cstdio>
+#include <unistd.h>
+#include "config.h"
+#include "ticcutils/StringOps.h"
+#include "ticcutils/CommandLine.h"
+#include "ticcutils/FileUtils.h"
+#include "ticcutils/XMLtools.h"
+#include "ticcutils/Unicode.h"
+#include "libfolia/folia.h"
+#include "tscan/Alpino.h"
+#include "tscan/tokens.h"
+#include "tscan/utils.h"
+#include "tscan/intern.h"
+#include "tscan/mtld.h"
+#include "tscan/compress.h"
+#include "tscan/csv.h"
+#include "tscan/columns.h"
+#include "tscan/stats.h"
+#include "tscan/analyzer.h"
+
+using namespace std;
+
+/*
+ * Times the CPU-bound kernels of tscan one by one, on the expected
+ * outputs of the examples in tests/ (Frog tagged FoLiA), their Alpino parses
+ * from tests/alpino_lookup.data and the lexicons in data/. No servers
+ * are needed, so an optimisation of a kernel can be measured on its own.
+ * The documents are also analysed by libtscan, without Alpino, Wopr and
+ * the compound splitter, so the methods of the statistics can be timed
+ * on them, with the parses read here.
+ */
+
+inline void usage() {
+  cerr << "usage:  tscan-bench [options] " << endl;
+  cerr << "Times the CPU-bound kernels of tscan on the test examples." << endl;
+  cerr << "options: " << endl;
+  cerr << "\t-t <dir> the tests directory (default 'tests') " << endl;
+  cerr << "\t-d <dir> the data directory (default 'data') " << endl;
+  cerr << "\t-n <count> the number of repetitions (default 20) " << endl;
+  cerr << "\t--kernels=<list> only run these kernels, comma separated " << endl;
+  cerr << "\t--list list the kernels " << endl;
+  cerr << "\t-V or --version show version " << endl;
+  cerr << endl;
+}
+
+// the default mtldThreshold of tscan.cfg
+const double MTLD_THRESHOLD = 0.720;
+
+// keeps the compiler from optimising the kernels away
+static volatile size_t sink = 0;
+
+// A sentence of a test document, with its parse if there is one.
+struct benchSentence {
+  folia::Sentence *sentence;
+  unique_ptr<tokenTable> tokens;
+  xmlDoc *alp;
+  vector<xmlNode*> nodes; // the parse node of each word, or 0
+  sentStats *stats; // its statistics, or 0
+};
+
+struct benchData {
+  // sets up the lexicons of libtscan, for the statistics
+  unique_ptr<TScan::Analyzer> analyzer;
+  vector<unique_ptr<folia::Document>> docs;
+  vector<unique_ptr<docStats>> stats;
+  vector<benchSentence> sentences;
+  // the lowercased words of each document, without punctuation
+  vector<vector<Intern::Id>> words;
+  vector<vector<Intern::Id>> lemmas;
+  vector<pair<string, map<string, string>>> lexicons;
+  ~benchData(){
+    for ( auto& s : sentences ){
+      if ( s.alp )
+	xmlFreeDoc( s.alp );
+    }
+  }
+};
+
+/**
+ * Reads the parse of a sentence the way tscan's Alpino lookup does.
+ * @param file the treebank
+ * @param index the tree in it, 0 when it holds just one
+ * @return the parse or 0
+ */
+xmlDoc *readParse( const string& file, int index ){
+  string data;
+  if ( !Compress::readFile( file, data ) )
+    return 0;
+  xmlDoc *xmldoc = xmlReadMemory( data.c_str(), data.length(), 0, 0,
+				  XML_PARSE_NOBLANKS );
+  if ( !xmldoc || index == 0 )
+    return xmldoc;
+  auto trees = TiCC::FindNodes( xmldoc, "//alpino_ds[" + to_string( index ) + "]" );
+  if ( trees.empty() ){
+    xmlFreeDoc( xmldoc );
+    return 0;
+  }
+  xmlDocSetRootElement( xmldoc, trees.front() );
+  return xmldoc;
+}
+
+bool readLookup( const string& testDir, map<string, pair<string, int>>& m ){
+  ifstream is( testDir + "/alpino_lookup.data" );
+  if ( !is )
+    return false;
+  string line;
+  while ( safe_getline( is, line ) ){
+    vector<string> parts;
+    if ( TiCC::split_at( TiCC::trim( line ), parts, "\t" ) == 3 ){
+      m[parts[0]] = make_pair( testDir + "/" + parts[1],
+			       TiCC::stringTo<int>( parts[2] ) );
+    }
+  }
+  return true;
+}
+
+/**
+ * Reads a lexicon: the first column of each line mapped to the second.
+ */
+bool readLexicon( const string& name, map<string, string>& lex ){
+  ifstream is( name );
+  if ( !is )
+    return false;
+  string line;
+  while ( safe_getline( is, line ) ){
+    vector<string> parts;
+    if ( TiCC::split_at( line, parts, "\t" ) >= 2 ){
+      lex[TiCC::trim( parts[0] )] = parts[1];
+    }
+  }
+  return true;
+}
+
+bool readData( const string& testDir, const string& dataDir, benchData& data ){
+  map<string, pair<string, int>> lookup;
+  if ( !readLookup( testDir, lookup ) ){
+    cerr << "unable to read " << testDir << "/alpino_lookup.data" << endl;
+    return false;
+  }
+  vector<string> names = TiCC::searchFilesMatch( testDir, "*.example.ok", false );
+  for ( const auto& name : names ){
+    unique_ptr<folia::Document> doc( new folia::Document() );
+    try {
+      doc->readFromFile( name );
+    }
+    catch ( exception& e ){
+      cerr << "skipped " << name << ": " << e.what() << endl;
+      continue;
+    }
+    // for the addMetrics kernel, as docStats does
+    doc->declare( folia::AnnotationType::METRIC,
+		  "metricset",
+		  "annotator='tscan'" );
+    vector<Intern::Id> words;
+    vector<Intern::Id> lemmas;
+    for ( auto s : doc->sentences() ){
+      benchSentence bs;
+      bs.sentence = s;
+      bs.tokens.reset( new tokenTable( s ) );
+      bs.alp = 0;
+      bs.stats = 0;
+      auto it = lookup.find( TiCC::UnicodeToUTF8( s->toktext() ) );
+      if ( it != lookup.end() ){
+	bs.alp = readParse( it->second.first, it->second.second );
+      }
+      const tokenTable& tokens = *bs.tokens;
+      for ( size_t i=0; i < tokens.size(); ++i ){
+	bs.nodes.push_back( bs.alp ? getAlpNodeWord( bs.alp, tokens[i].word ) : 0 );
+	if ( !tokens[i].isPunct ){
+	  words.push_back( tokens[i].l_word_id );
+	  lemmas.push_back( tokens[i].l_lemma_id );
+	}
+      }
+      data.sentences.push_back( move( bs ) );
+    }
+    data.words.push_back( words );
+    data.lemmas.push_back( lemmas );
+    data.docs.push_back( move( doc ) );
+  }
+  if ( data.docs.empty() ){
+    cerr << "no documents in " << testDir << endl;
+    return false;
+  }
+  const char *lexicons[] = { "formal.data", "adverbs.data" };
+  for ( auto lexicon : lexicons ){
+    map<string, string> lex;
+    if ( !readLexicon( dataDir + "/" + lexicon, lex ) ){
+      cerr << "unable to read " << dataDir << "/" << lexicon << endl;
+      return false;
+    }
+    data.lexicons.push_back( make_pair( string( lexicon ), lex ) );
+  }
+  map<string, string> semtypes;
+  if ( readLexicon( testDir + "/nouns_semtype.data", semtypes ) ){
+    data.lexicons.push_back( make_pair( string( "nouns_semtype.data" ), semtypes ) );
+  }
+  return true;
+}
+
+/**
+ * Analyses the documents with libtscan, configured with the lexicons
+ * only, and links their sentences to the statistics.
+ */
+bool analyseData( const string& testDir, const string& dataDir, benchData& data ){
+  string name = "/tmp/tscan-bench." + to_string( getpid() ) + ".cfg";
+  {
+    ofstream os( name );
+    os << "useAlpino=0\nuseAlpinoServer=0\nsaveAlpinoOutput=0\n"
+       << "useWopr=0\nuseCompoundSplitter=0\nlogProblems=false\n"
+       << "overlapSize=50\nmtldThreshold=" << MTLD_THRESHOLD << "\n"
+       << "configDir=" << dataDir << "\n"
+       << "adj_semtypes=" << testDir << "/adjs_semtype.data\n"
+       << "noun_semtypes=" << testDir << "/nouns_semtype.data\n";
+    // the lexicons of tests/bench/bench.cfg that are in data/
+    const char *lexicons[][2] = {
+      { "temporals", "temporal_connectors.lst" },
+      { "opsom_connectors_wg", "opsom_connectors_wg.lst" },
+      { "opsom_connectors_zin", "opsom_connectors_zin.lst" },
+      { "contrast", "contrast_connectors.lst" },
+      { "compars", "compar_connectors.lst" },
+      { "causals", "causal_connectors.lst" },
+      { "causal_situation", "causaliteit.txt" },
+      { "space_situation", "ruimte.txt" },
+      { "time_situation", "tijd.txt" },
+      { "emotion_situation", "emoties.txt" },
+      { "voorzetselexpr", "voorzetseluitdrukkingen.txt" },
+      { "afkortingen", "afkortingen.lst" },
+      { "adverbs", "adverbs.data" },
+      { "prevalence", "prevalence_nl.data" },
+      { "formal", "formal.data" } };
+    for ( auto lexicon : lexicons ){
+      os << lexicon[0] << "=" << lexicon[1] << "\n";
+    }
+  }
+  try {
+    data.analyzer.reset( new TScan::Analyzer( name ) );
+  }
+  catch ( exception& e ){
+    cerr << "unable to set up libtscan: " << e.what() << endl;
+    remove( name.c_str() );
+    return false;
+  }
+  remove( name.c_str() );
+  map<const folia::FoliaElement*, sentStats*> sentences;
+  for ( const auto& doc : data.docs ){
+    // not Analyzer::analyse, which would forget the interned words of
+    // the other documents
+    unique_ptr<docStats> stats( new docStats( doc->id(), doc.get() ) );
+    for ( auto par : stats->sv ){
+      for ( auto sent : par->sv ){
+	sentStats *ss = dynamic_cast<sentStats*>( sent );
+	if ( ss ){
+	  sentences[ss->folia_node] = ss;
+	}
+      }
+    }
+    data.stats.push_back( move( stats ) );
+  }
+  for ( auto& s : data.sentences ){
+    auto it = sentences.find( s.sentence );
+    s.stats = it == sentences.end() ? 0 : it->second;
+  }
+  return true;
+}
+
+// A kernel returns the number of calls it made.
+struct kernel {
+  const char *name;
+  function<size_t()> run;
+};
+
+vector<kernel> kernels( benchData& data ){
+  vector<kernel> result;
+  result.push_back( { "mtld", [&data](){
+	static mtldEngine engine;
+	double total = 0.0;
+	for ( size_t d=0; d < data.words.size(); ++d ){
+	  total += engine.average( data.words[d], MTLD_THRESHOLD );
+	  total += engine.average( data.lemmas[d], MTLD_THRESHOLD );
+	}
+	sink += total;
+	return 2 * data.words.size();
+      } } );
+  // the document overlap, first as it was done before overlapWindow
+  result.push_back( { "argument_overlap", [&data](){
+	size_t calls = 0;
+	int count = 0;
+	for ( const auto& words : data.words ){
+	  deque<string> window;
+	  for ( auto id : words ){
+	    const string& word = Intern::toString( id );
+	    if ( window.size() == 50 ){
+	      vector<string> buffer( window.begin(), window.end() );
+	      argument_overlap( word, buffer, count );
+	      ++calls;
+	      window.pop_front();
+	    }
+	    window.push_back( word );
+	  }
+	}
+	sink += count;
+	return calls;
+      } } );
+  // and as docStats does it now, with overlapWindow
+  result.push_back( { "doc_overlap", [&data](){
+	for ( const auto& stats : data.stats ){
+	  stats->calculate_doc_overlap();
+	  sink += stats->doc_word_overlapCnt;
+	}
+	return data.stats.size();
+      } } );
+  // the lexicon lookups of the word sequences of a sentence. They add to
+  // the counts of the sentence every time, which doesn't matter here
+  result.push_back( { "resolveMultiWord", [&data](){
+	size_t calls = 0;
+	for ( const auto& s : data.sentences ){
+	  if ( s.stats && !s.stats->sv.empty() ){
+	    s.stats->resolveMultiWordIntensify();
+	    s.stats->resolveMultiWordFormal();
+	    calls += 2;
+	  }
+	}
+	return calls;
+      } } );
+  result.push_back( { "resolveConnectives", [&data](){
+	size_t calls = 0;
+	for ( const auto& s : data.sentences ){
+	  if ( s.stats ){
+	    s.stats->resolveConnectives();
+	    ++calls;
+	  }
+	}
+	return calls;
+      } } );
+  result.push_back( { "resolveSituations", [&data](){
+	size_t calls = 0;
+	for ( const auto& s : data.sentences ){
+	  if ( s.stats ){
+	    s.stats->resolveSituations();
+	    ++calls;
+	  }
+	}
+	return calls;
+      } } );
+  result.push_back( { "resolveRelativeClauses", [&data](){
+	size_t calls = 0;
+	for ( const auto& s : data.sentences ){
+	  if ( s.stats && s.alp ){
+	    s.stats->resolveRelativeClauses( s.alp );
+	    ++calls;
+	  }
+	}
+	return calls;
+      } } );
+  result.push_back( { "findInflected", [&data](){
+	size_t calls = 0;
+	size_t found = 0;
+	for ( const auto& lex : data.lexicons ){
+	  for ( size_t d=0; d < data.words.size(); ++d ){
+	    for ( size_t i=0; i < data.words[d].size(); ++i ){
+	      found += findInflected( lex.second, Intern::toString( data.words[d][i] ) ) != lex.second.end();
+	      found += findInflected( lex.second, Intern::toString( data.lemmas[d][i] ) ) != lex.second.end();
+	      calls += 2;
+	    }
+	  }
+	}
+	sink += found;
+	return calls;
+      } } );
+  result.push_back( { "getAlpNodeWord", [&data](){
+	size_t calls = 0;
+	for ( const auto& s : data.sentences ){
+	  if ( !s.alp )
+	    continue;
+	  const tokenTable& tokens = *s.tokens;
+	  for ( size_t i=0; i < tokens.size(); ++i ){
+	    sink += getAlpNodeWord( s.alp, tokens[i].word ) != 0;
+	    ++calls;
+	  }
+	}
+	return calls;
+      } } );
+  result.push_back( { "getDependencyDist", [&data](){
+	size_t calls = 0;
+	for ( const auto& s : data.sentences ){
+	  for ( auto node : s.nodes ){
+	    if ( node ){
+	      sink += getDependencyDist( node, s.tokens->punctuation() ).size();
+	      ++calls;
+	    }
+	  }
+	}
+	return calls;
+      } } );
+  result.push_back( { "get_d_level", [&data](){
+	size_t calls = 0;
+	for ( const auto& s : data.sentences ){
+	  if ( s.alp ){
+	    try {
+	      sink += get_d_level( *s.tokens, s.alp );
+	    }
+	    catch ( folia::ValueError& ){
+	      // a word without a POS tag
+	    }
+	    ++calls;
+	  }
+	}
+	return calls;
+      } } );
+  result.push_back( { "merge", [](){
+	const size_t n = 1000;
+	structStats total( 0, 0, "document" );
+	structStats part( 1, 0, "paragraph" );
+	part.wordCnt() = 10;
+	part.sentCnt = 1;
+	part.parseFailCnt = 0;
+	part.dLevel = 3;
+	for ( size_t i=0; i < n; ++i ){
+	  total.merge( &part );
+	}
+	sink += total.wordCnt();
+	return n;
+      } } );
+  // the emitters write the statistics of a sentence, as a paragraph
+  static string base = "/tmp/tscan-bench." + to_string( getpid() );
+  result.push_back( { "csv", [](){
+	const size_t n = 1000;
+	structStats ss( 1, 0, "paragraph" );
+	Groups::selection groups;
+	csvFile file;
+	if ( file.open( base + ".csv" ) ){
+	  for ( size_t i=0; i < n; ++i ){
+	    csvLine line( file, i == 0, groups );
+	    line.col( "Inputfile", base );
+	    ss.CSVcolumns( line );
+	    line.end();
+	  }
+	  file.close();
+	  remove( file.name().c_str() );
+	}
+	return n;
+      } } );
+  result.push_back( { "columns", [](){
+	const size_t n = 1000;
+	structStats ss( 1, 0, "paragraph" );
+	Groups::selection groups;
+	columnFile file;
+	if ( file.open( base + ".tscb", "bench" ) ){
+	  for ( size_t i=0; i < n; ++i ){
+	    csvLine line( file, i == 0, groups );
+	    line.col( "Inputfile", base );
+	    ss.CSVcolumns( line );
+	    line.end();
+	  }
+	  file.close();
+	  remove( file.name().c_str() );
+	}
+	return n;
+      } } );
+  result.push_back( { "addMetrics", [&data](){
+	const size_t n = 100;
+	folia::Document *doc = data.docs[0].get();
+	structStats ss( 1, 0, "paragraph" );
+	for ( size_t i=0; i < n; ++i ){
+	  folia::Paragraph *par = new folia::Paragraph( folia::KWargs(), doc );
+	  ss.folia_node = par;
+	  ss.addMetrics();
+	  sink += par->size();
+	  par->destroy();
+	}
+	return n;
+      } } );
+  return result;
+}
+
+int main( int argc, char *argv[] ) {
+  TiCC::CL_Options opts( "hVt:d:n:", "kernels:,list,version,help" );
+  try {
+    opts.init( argc, argv );
+  }
+  catch ( TiCC::OptionError &e ) {
+    cerr << e.what() << endl;
+    usage();
+    exit( EXIT_FAILURE );
+  }
+  if ( opts.extract( 'h' ) || opts.extract( "help" ) ) {
+    usage();
+    exit( EXIT_SUCCESS );
+  }
+  if ( opts.extract( 'V' ) || opts.extract( "version" ) ) {
+    cerr << "tscan-bench " << VERSION << endl;
+    exit( EXIT_SUCCESS );
+  }
+  string testDir = "tests";
+  opts.extract( 't', testDir );
+  string dataDir = "data";
+  opts.extract( 'd', dataDir );
+  size_t repeats = 20;
+  string val;
+  if ( opts.extract( 'n', val ) ) {
+    if ( !TiCC::stringTo( val, repeats ) || repeats < 1 ) {
+      cerr << "wrong value for '-n' option. (must be >= 1 )" << endl;
+      exit( EXIT_FAILURE );
+    }
+  }
+  set<string> wanted;
+  if ( opts.extract( "kernels", val ) ) {
+    vector<string> parts;
+    TiCC::split_at( val, parts, "," );
+    wanted.insert( parts.begin(), parts.end() );
+  }
+  bool list = opts.extract( "list" );
+  if ( !opts.empty() ) {
+    cerr << "unsupported options in command: " << opts.toString() << endl;
+    exit( EXIT_FAILURE );
+  }
+
+  benchData data;
+  vector<kernel> all = kernels( data );
+  if ( list ) {
+    for ( const auto& k : all ) {
+      cout << k.name << endl;
+    }
+    exit( EXIT_SUCCESS );
+  }
+  for ( const auto& name : wanted ) {
+    bool known = false;
+    for ( const auto& k : all ) {
+      known = known || name == k.name;
+    }
+    if ( !known ) {
+      cerr << "unknown kernel '" << name << "', see --list" << endl;
+      exit( EXIT_FAILURE );
+    }
+  }
+  if ( !readData( testDir, dataDir, data )
+       || !analyseData( testDir, dataDir, data ) ) {
+    exit( EXIT_FAILURE );
+  }
+  size_t parsed = 0;
+  for ( const auto& s : data.sentences ) {
+    parsed += s.alp != 0;
+  }
+  cout << data.docs.size() << " documents, " << data.sentences.size()
+       << " sentences (" << parsed << " parsed), " << repeats
+       << " repetitions" << endl;
+  for ( const auto& k : all ) {
+    if ( !wanted.empty() && wanted.find( k.name ) == wanted.end() ) {
+      continue;
+    }
+    // once to warm up the caches
+    k.run();
+    size_t calls = 0;
+    auto start = chrono::steady_clock::now();
+    for ( size_t i = 0; i < repeats; ++i ) {
+      calls += k.run();
+    }
+    chrono::duration<double> secs = chrono::steady_clock::now() - start;
+    char line[128];
+    snprintf( line, sizeof( line ), "%-24s %10zu calls %10.3f ms %12.1f ns/call",
+              k.name, calls, secs.count() * 1000.0,
+              calls ? secs.count() * 1e9 / calls : 0.0 );
+    cout << line << endl;
+  }
+  exit( EXIT_SUCCESS );
+}
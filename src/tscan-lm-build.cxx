@@ -0,0 +1,175 @@
+/*
+  T-scan
+
+  Copyright (c) 1998 - 2018
+
+  This file is part of tscan
+
+  tscan is free software; you can redistribute it and/or modify
+  it under the terms of the GNU Affero General Public License as published by
+  the Free Software Foundation; either version 3 of the License, or
+  (at your option) any later version.
+
+  tscan is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU Affere General Public License for more details.
+
+  You should have received a copy of the GNU Affero General Public License
+  along with this program; if not, see <http://www.gnu.org/licenses/>.
+
+*/
+
+#include <string>
+#include <vector>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include "config.h"
+#include "ticcutils/StringOps.h"
+#include "ticcutils/CommandLine.h"
+#include "tscan/ngram.h"
+
+using namespace std;
+
+inline void usage() {
+  cerr << "usage:  tscan-lm-build [options] -o <countfile> <corpusfiles> " << endl;
+  cerr << "        tscan-lm-build -s <countfile> <files> " << endl;
+  cerr << "Builds a language model for tscan from tokenized text, one sentence per line." << endl;
+  cerr << "options: " << endl;
+  cerr << "\t-o <file> write the count file to 'file' " << endl;
+  cerr << "\t-s <file> score the sentences with the count file 'file' instead:" << endl;
+  cerr << "\t          the log10 probability of every word, and per sentence" << endl;
+  cerr << "\t          avg_prob10, entropy and perplexity, as tscan computes them" << endl;
+  cerr << "\t-n <order> the n-gram order (default 3) " << endl;
+  cerr << "\t--reverse build a backward model" << endl;
+  cerr << "\t-V or --version show version " << endl;
+  cerr << "Without files, the sentences are read from standard input." << endl;
+  cerr << endl;
+}
+
+void addCorpus( istream &is, NGram::builder &builder, size_t &lines ) {
+  string line;
+  while ( getline( is, line ) ) {
+    vector<string> words;
+    istringstream ss( line );
+    string word;
+    while ( ss >> word ) {
+      words.push_back( word );
+    }
+    builder.add( words );
+    if ( ++lines % 100000 == 0 ) {
+      cerr << "counted " << lines << " sentences" << endl;
+    }
+  }
+}
+
+void scoreCorpus( istream &is, const NGram::model &lm ) {
+  string line;
+  while ( getline( is, line ) ) {
+    vector<string> words;
+    istringstream ss( line );
+    string word;
+    while ( ss >> word ) {
+      words.push_back( word );
+    }
+    if ( words.empty() ) {
+      continue;
+    }
+    vector<double> lprob10;
+    lm.score( words, lprob10 );
+    for ( size_t i = 0; i < words.size(); ++i ) {
+      cout << words[i] << "\t" << lprob10[i] << endl;
+    }
+    double avg_prob10, entropy, perplexity;
+    NGram::summarize( lprob10, avg_prob10, entropy, perplexity );
+    cout << "avg_prob10\t" << avg_prob10 << endl;
+    cout << "entropy\t" << entropy << endl;
+    cout << "perplexity\t" << perplexity << endl;
+    cout << endl;
+  }
+}
+
+int main( int argc, char *argv[] ) {
+  TiCC::CL_Options opts( "hVo:n:s:", "reverse,version,help" );
+  try {
+    opts.init( argc, argv );
+  }
+  catch ( TiCC::OptionError &e ) {
+    cerr << e.what() << endl;
+    usage();
+    exit( EXIT_FAILURE );
+  }
+  if ( opts.extract( 'h' ) || opts.extract( "help" ) ) {
+    usage();
+    exit( EXIT_SUCCESS );
+  }
+  if ( opts.extract( 'V' ) || opts.extract( "version" ) ) {
+    cerr << "tscan-lm-build " << VERSION << endl;
+    exit( EXIT_SUCCESS );
+  }
+  string modelName;
+  if ( opts.extract( 's', modelName ) ) {
+    vector<string> inputnames = opts.getMassOpts();
+    if ( !opts.empty() ) {
+      cerr << "unsupported options in command: " << opts.toString() << endl;
+      exit( EXIT_FAILURE );
+    }
+    NGram::model lm;
+    if ( !lm.open( modelName ) ) {
+      exit( EXIT_FAILURE );
+    }
+    if ( inputnames.empty() ) {
+      scoreCorpus( cin, lm );
+    }
+    for ( size_t i = 0; i < inputnames.size(); ++i ) {
+      ifstream is( inputnames[i] );
+      if ( !is ) {
+        cerr << "unable to open '" << inputnames[i] << "'" << endl;
+        exit( EXIT_FAILURE );
+      }
+      scoreCorpus( is, lm );
+    }
+    exit( EXIT_SUCCESS );
+  }
+  string outName;
+  if ( !opts.extract( 'o', outName ) ) {
+    cerr << "missing -o option" << endl;
+    usage();
+    exit( EXIT_FAILURE );
+  }
+  size_t order = 3;
+  string val;
+  if ( opts.extract( 'n', val ) ) {
+    if ( !TiCC::stringTo( val, order ) || order < 1 || order > NGram::MAX_ORDER ) {
+      cerr << "wrong value for '-n' option. (must be >=1 and <= "
+           << NGram::MAX_ORDER << " )" << endl;
+      exit( EXIT_FAILURE );
+    }
+  }
+  bool reverse = opts.extract( "reverse" );
+  vector<string> inputnames = opts.getMassOpts();
+  if ( !opts.empty() ) {
+    cerr << "unsupported options in command: " << opts.toString() << endl;
+    exit( EXIT_FAILURE );
+  }
+
+  NGram::builder builder( order, reverse );
+  size_t lines = 0;
+  if ( inputnames.empty() ) {
+    addCorpus( cin, builder, lines );
+  }
+  for ( size_t i = 0; i < inputnames.size(); ++i ) {
+    ifstream is( inputnames[i] );
+    if ( !is ) {
+      cerr << "unable to open '" << inputnames[i] << "'" << endl;
+      exit( EXIT_FAILURE );
+    }
+    addCorpus( is, builder, lines );
+  }
+  cerr << "counted " << lines << " sentences, writing " << outName << endl;
+  if ( !builder.save( outName ) ) {
+    exit( EXIT_FAILURE );
+  }
+  exit( EXIT_SUCCESS );
+}
@@ -0,0 +1,245 @@
+/*
+  T-scan
+
+  Copyright (c) 1998 - 2018
+
+  This file is part of tscan
+
+  tscan is free software; you can redistribute it and/or modify
+  it under the terms of the GNU Affero General Public License as published by
+  the Free Software Foundation; either version 3 of the License, or
+  (at your option) any later version.
+
+  tscan is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU Affere General Public License for more details.
+
+  You should have received a copy of the GNU Affero General Public License
+  along with this program; if not, see <http://www.gnu.org/licenses/>.
+
+*/
+
+#include <string>
+#include <vector>
+#include <iostream>
+#include <cstdlib>
+#include <cmath>
+#include <fstream>
+#include <stdexcept>
+#include <unistd.h>
+#include "tscan/utils.h"
+#include "tscan/mtld.h"
+#include "tscan/stats.h"
+#include "tscan/shards.h"
+#include "tscan/ngram.h"
+#include "tscan/analyzer.h"
+
+using namespace std;
+
+/*
+ * Unit tests of the parts of tscan that need neither the services nor
+ * the lexicons, run by 'make check'. Every check prints a line, and
+ * the program fails when any check failed.
+ */
+
+static int failures = 0;
+
+static void check( const string &name, bool ok ) {
+  cout << name << ( ok ? " OK" : " FAILED" ) << endl;
+  if ( !ok ) {
+    ++failures;
+  }
+}
+
+static size_t count( const string &s, const string &what ) {
+  size_t n = 0;
+  for ( size_t pos = s.find( what ); pos != string::npos; pos = s.find( what, pos + 1 ) ) {
+    ++n;
+  }
+  return n;
+}
+
+static string frogShard( const string &id, const string &declarations,
+                         const string &text ) {
+  return "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+         "<FoLiA xmlns=\"http://ilk.uvt.nl/folia\" xml:id=\"" + id + "\" version=\"2.0.0\">\n"
+         "  <metadata type=\"native\">\n"
+         "    <annotations>\n"
+         "      <token-annotation set=\"tokconfig-nld\">\n"
+         "        <annotator processor=\"frog.ucto\"/>\n"
+         "      </token-annotation>\n" + declarations +
+         "    </annotations>\n"
+         "    <provenance>\n"
+         "      <processor xml:id=\"frog\" name=\"frog\">\n"
+         "        <processor xml:id=\"frog.ucto\" name=\"ucto\"/>\n"
+         "      </processor>\n"
+         "    </provenance>\n"
+         "  </metadata>\n"
+         "  <text xml:id=\"" + id + ".text\">\n" + text +
+         "  </text>\n"
+         "</FoLiA>\n";
+}
+
+static string paragraph( const string &id, const string &word, bool entity ) {
+  string w = id + ".s.1.w.1";
+  string result = "    <p xml:id=\"" + id + "\">\n"
+                  "      <s xml:id=\"" + id + ".s.1\">\n"
+                  "        <w xml:id=\"" + w + "\"><t>" + word + "</t></w>\n";
+  if ( entity ) {
+    result += "        <entities>\n"
+              "          <entity xml:id=\"" + id + ".s.1.entity.1\" class=\"per\">\n"
+              "            <wref id=\"" + w + "\" t=\"" + word + "\"/>\n"
+              "          </entity>\n"
+              "        </entities>\n";
+  }
+  return result + "      </s>\n"
+                  "    </p>\n";
+}
+
+static void testShards() {
+  // the first empty line after half of the text ends the first part
+  vector<string> lines = { "een", "twee", "", "drie", "vier", "", "vijf" };
+  vector<pair<size_t, size_t>> parts = Shards::split( lines, 2, false );
+  check( "shards split at a paragraph",
+         parts.size() == 2 && parts[0] == make_pair( size_t( 0 ), size_t( 6 ) )
+         && parts[1] == make_pair( size_t( 6 ), size_t( 7 ) ) );
+  parts = Shards::split( lines, 2, true );
+  check( "shards split per line",
+         parts.size() == 2 && parts[0].second == parts[1].first );
+
+  const string ner = "      <entity-annotation set=\"http://ilk.uvt.nl/folia/sets/frog-ner-nl\"/>\n";
+  vector<string> shards = {
+    frogShard( "doc", "", paragraph( "doc.p.1", "Jan", false ) + paragraph( "doc.p.2", "ziet", false ) ),
+    frogShard( "other", ner, paragraph( "other.p.1", "Marie", true ) + paragraph( "other.p.2", ".", false ) )
+  };
+  string doc = Shards::stitch( shards );
+  check( "shards stitched", !doc.empty() );
+  check( "shards paragraphs renumbered",
+         count( doc, "<p xml:id=" ) == 4 && doc.find( "\"doc.p.1\"" ) < doc.find( "\"doc.p.2\"" )
+         && doc.find( "\"doc.p.2\"" ) < doc.find( "\"doc.p.3\"" )
+         && doc.find( "\"doc.p.3\"" ) < doc.find( "\"doc.p.4\"" ) );
+  check( "shards ids renumbered",
+         doc.find( "xml:id=\"doc.p.3.s.1.w.1\"><t>Marie</t>" ) != string::npos
+         && doc.find( "xml:id=\"doc.p.3.s.1.entity.1\"" ) != string::npos
+         && doc.find( "other." ) == string::npos );
+  check( "shards references renumbered",
+         doc.find( "<wref id=\"doc.p.3.s.1.w.1\" t=\"Marie\"/>" ) != string::npos );
+  check( "shards declarations merged",
+         count( doc, "<entity-annotation " ) == 1 && count( doc, "<token-annotation " ) == 1
+         && doc.find( "<entity-annotation " ) < doc.find( "</annotations>" ) );
+  check( "shards processors merged once", count( doc, "xml:id=\"frog\"" ) == 1 );
+
+  shards[1] = frogShard( "other", "", paragraph( "other.p.1", "Marie", false )
+                                      + "    <gap xml:id=\"other.gap\"/>\n" );
+  check( "shards refuse unknown ids", Shards::stitch( shards ).empty() );
+}
+
+static void testTempNames() {
+  string a = tempName( "dir/out.xml" );
+  string b = tempName( "dir/out.xml" );
+  check( "temporary names unique", a != b );
+  check( "temporary names in the same directory",
+         a.compare( 0, 12, "dir/out.xml." ) == 0 && a.find( '/', 4 ) == string::npos );
+}
+
+static vector<Intern::Id> tokens( const vector<string> &words ) {
+  vector<Intern::Id> result;
+  for ( const auto &w : words ) {
+    result.push_back( Intern::intern( w ) );
+  }
+  return result;
+}
+
+static void testMTLD() {
+  mtldEngine engine;
+  // the TTR stays above 0.72, so both directions end with a partial
+  // factor of (1 - 4/5) / (1 - 0.72): 5 / (0.2 / 0.28) = 7
+  check( "mtld partial factor",
+         fabs( engine.average( tokens( { "a", "b", "c", "a", "d" } ), 0.72 ) - 7.0 ) < 1e-9 );
+  // forward: a a (TTR 0.5) is a factor, b is a partial factor of 0;
+  // backward: b a a ends on a whole factor. Both give 3 / 1
+  check( "mtld whole factor",
+         fabs( engine.average( tokens( { "a", "a", "b" } ), 0.72 ) - 3.0 ) < 1e-9 );
+  check( "mtld empty", engine.average( {}, 0.72 ) == 0.0 );
+  // the threshold is that of the call, not of an earlier one
+  check( "mtld threshold per call",
+         fabs( engine.average( tokens( { "a", "b", "c", "a", "d" } ), 0.5 ) - 5.0 / 0.4 ) < 1e-9 );
+}
+
+static void testCounters() {
+  check( "counter names",
+         string( Counters::intNames[Counters::wordCnt] ) == "wordCnt"
+         && string( Counters::doubleNames[Counters::N_DOUBLE_SUMS - 1] ) == "word_freq_log_n_corr_strict" );
+  structStats sum( 0, 0, "test" );
+  structStats child( 1, 0, "test" );
+  for ( size_t i = 0; i < child.int_sums.size(); ++i ) {
+    child.int_sums[i] = i + 1;
+  }
+  for ( size_t i = 0; i < child.double_sums.size(); ++i ) {
+    child.double_sums[i] = i / 2.0;
+  }
+  check( "counter accessors", child.nounCnt() == int( Counters::nounCnt ) + 1 );
+  sum.merge( &child );
+  sum.merge( &child );
+  bool ok = true;
+  for ( size_t i = 0; i < sum.int_sums.size(); ++i ) {
+    ok = ok && sum.int_sums[i] == int( 2 * ( i + 1 ) );
+  }
+  for ( size_t i = 0; i < sum.double_sums.size(); ++i ) {
+    ok = ok && sum.double_sums[i] == double( i );
+  }
+  check( "counters merged", ok );
+}
+
+static bool writeFile( const string &name, const string &content ) {
+  ofstream os( name );
+  os << content;
+  return bool( os );
+}
+
+static void testAnalyzers() {
+  string base = "/tmp/tscan-test-" + to_string( getpid() );
+  string fwd = base + ".fwd.lm";
+  string bwd = base + ".bwd.lm";
+  string withModels = base + ".models.cfg";
+  string without = base + ".cfg";
+  NGram::builder fwdBuilder( 3, false );
+  NGram::builder bwdBuilder( 3, true );
+  fwdBuilder.add( { "de", "kat", "slaapt" } );
+  bwdBuilder.add( { "de", "kat", "slaapt" } );
+  bool ok = fwdBuilder.save( fwd ) && bwdBuilder.save( bwd )
+    && writeFile( withModels, "useWopr=1\n[[wopr]]\nmodel_fwd=" + fwd
+                  + "\nmodel_bwd=" + bwd + "\n" )
+    && writeFile( without, "useWopr=0\n" );
+  check( "analyzer configurations written", ok );
+  try {
+    TScan::Analyzer first( withModels );
+    check( "first analyzer", first.configFile() == withModels );
+  }
+  catch ( const exception &e ) {
+    check( string( "first analyzer: " ) + e.what(), false );
+  }
+  // the second one doesn't name the models, so it must not open them
+  // again, nor still score with the ones of the first
+  unlink( fwd.c_str() );
+  unlink( bwd.c_str() );
+  try {
+    TScan::Analyzer second( without );
+    check( "second analyzer", second.configFile() == without );
+  }
+  catch ( const exception &e ) {
+    check( string( "second analyzer: " ) + e.what(), false );
+  }
+  unlink( withModels.c_str() );
+  unlink( without.c_str() );
+}
+
+int main() {
+  testShards();
+  testTempNames();
+  testMTLD();
+  testCounters();
+  testAnalyzers();
+  return failures == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -1,3 +1,6 @@
+#include <cstdio>
+#include <atomic>
+#include <unistd.h>
 #include "tscan/utils.h"
 
 using namespace std;
@@ -11,10 +14,87 @@ using namespace std;
  * @param val    the value of the new Metric
  */
 void addOneMetric( folia::Document *doc, folia::FoliaElement *parent, const string& cls, const string& val ) {
-  folia::Metric *m = new folia::Metric( folia::getArgs( "class='" + cls + "', value='" + val + "'" ), doc );
+  // filled directly: parsing an argument string costs more than the
+  // Metric itself, and breaks on values with quotes
+  folia::KWargs args;
+  args["class"] = cls;
+  args["value"] = val;
+  folia::Metric *m = new folia::Metric( args, doc );
   parent->append( m );
 }
 
+/**
+ * Formats a signed integer.
+ */
+string formatInteger( long long val ) {
+  char buf[32];
+  int len = snprintf( buf, sizeof( buf ), "%lld", val );
+  return string( buf, len );
+}
+
+/**
+ * Formats an unsigned integer.
+ */
+string formatUnsigned( unsigned long long val ) {
+  char buf[32];
+  int len = snprintf( buf, sizeof( buf ), "%llu", val );
+  return string( buf, len );
+}
+
+/**
+ * Formats a double like an ostream with the default precision (6).
+ */
+string formatDouble( double val ) {
+  char buf[32];
+  int len = snprintf( buf, sizeof( buf ), "%g", val );
+  return string( buf, len );
+}
+
+/**
+ * Builds the table of pronoun_classes(): the pronouns with their classes.
+ */
+static map<string, unsigned int> makePronounClasses() {
+  const string vnw_1sA[] = {"ik", "mij", "me", "mijn" };
+  const string vnw_2sA[] = {"jij", "je", "jou", "jouw" };
+  const string vnw_3smA[] = {"hij", "hem", "zijn" };
+  const string vnw_3sfA[] = {"zij", "ze", "haar"};
+  const string vnw_1pA[] = {"wij", "we", "ons", "onze"};
+  const string vnw_2pA[] = {"jullie"};
+  const string vnw_3pA[] = {"zij", "ze", "hen", "hun"};
+  map<string, unsigned int> classes;
+  for ( size_t i=0; i < sizeof(vnw_1sA)/sizeof(string); ++i )
+    classes[vnw_1sA[i]] |= 1 << VNW_1S;
+  for ( size_t i=0; i < sizeof(vnw_2sA)/sizeof(string); ++i )
+    classes[vnw_2sA[i]] |= 1 << VNW_2S;
+  for ( size_t i=0; i < sizeof(vnw_3smA)/sizeof(string); ++i )
+    classes[vnw_3smA[i]] |= 1 << VNW_3SM;
+  for ( size_t i=0; i < sizeof(vnw_3sfA)/sizeof(string); ++i )
+    classes[vnw_3sfA[i]] |= 1 << VNW_3SF;
+  for ( size_t i=0; i < sizeof(vnw_1pA)/sizeof(string); ++i )
+    classes[vnw_1pA[i]] |= 1 << VNW_1P;
+  for ( size_t i=0; i < sizeof(vnw_2pA)/sizeof(string); ++i )
+    classes[vnw_2pA[i]] |= 1 << VNW_2P;
+  for ( size_t i=0; i < sizeof(vnw_3pA)/sizeof(string); ++i )
+    classes[vnw_3pA[i]] |= 1 << VNW_3P;
+  return classes;
+}
+
+/**
+ * Returns the pronoun classes a word or lemma belongs to, as a bitmask.
+ * Two pronouns of the same class count as overlapping arguments.
+ * @param w_or_l word or lemma
+ * @return the bitmask with one bit per class, 0 if it isn't a pronoun
+ */
+unsigned int pronoun_classes( const string& w_or_l ) {
+  // initialised once, also when several threads get here at the same time
+  static const map<string, unsigned int> classes = makePronounClasses();
+  map<string, unsigned int>::const_iterator it = classes.find( w_or_l );
+  if ( it != classes.end() )
+    return it->second;
+  else
+    return 0;
+}
+
 /**
  * Calculates the overlap of the Word or Lemma with the buffer
  * @param w_or_l          word or lemma
@@ -28,69 +108,65 @@ void argument_overlap( const string& w_or_l,
     return;
   // cerr << "test overlap, lemma/word= " << w_or_l << endl;
   // cerr << "buffer=" << buffer << endl;
-  static string vnw_1sA[] = {"ik", "mij", "me", "mijn" };
-  static set<string> vnw_1s = set<string>( vnw_1sA,
-             vnw_1sA + sizeof(vnw_1sA)/sizeof(string) );
-  static string vnw_2sA[] = {"jij", "je", "jou", "jouw" };
-  static set<string> vnw_2s = set<string>( vnw_2sA,
-             vnw_2sA + sizeof(vnw_2sA)/sizeof(string) );
-  static string vnw_3smA[] = {"hij", "hem", "zijn" };
-  static set<string> vnw_3sm = set<string>( vnw_3smA,
-              vnw_3smA + sizeof(vnw_3smA)/sizeof(string) );
-  static string vnw_3sfA[] = {"zij", "ze", "haar"};
-  static set<string> vnw_3sf = set<string>( vnw_3sfA,
-              vnw_3sfA + sizeof(vnw_3sfA)/sizeof(string) );
-  static string vnw_1pA[] = {"wij", "we", "ons", "onze"};
-  static set<string> vnw_1p = set<string>( vnw_1pA,
-             vnw_1pA + sizeof(vnw_1pA)/sizeof(string) );
-  static string vnw_2pA[] = {"jullie"};
-  static set<string> vnw_2p = set<string>( vnw_2pA,
-             vnw_2pA + sizeof(vnw_2pA)/sizeof(string) );
-  static string vnw_3pA[] = {"zij", "ze", "hen", "hun"};
-  static set<string> vnw_3p = set<string>( vnw_3pA,
-             vnw_3pA + sizeof(vnw_3pA)/sizeof(string) );
-
+  unsigned int classes = pronoun_classes( w_or_l );
   for( size_t i=0; i < buffer.size(); ++i ){
-    if ( w_or_l == buffer[i] ){
-      ++arg_overlap_cnt;
-      break;
-    }
-    else if ( vnw_1s.find( w_or_l ) != vnw_1s.end() &&
-        vnw_1s.find( buffer[i] ) != vnw_1s.end() ){
-      ++arg_overlap_cnt;
-      break;
-    }
-    else if ( vnw_2s.find( w_or_l ) != vnw_2s.end() &&
-        vnw_2s.find( buffer[i] ) != vnw_2s.end() ){
-      ++arg_overlap_cnt;
-      break;
-    }
-    else if ( vnw_3sm.find( w_or_l ) != vnw_3sm.end() &&
-        vnw_3sm.find( buffer[i] ) != vnw_3sm.end() ){
+    if ( w_or_l == buffer[i]
+	 || ( classes & pronoun_classes( buffer[i] ) ) ){
       ++arg_overlap_cnt;
       break;
     }
-    else if ( vnw_3sf.find( w_or_l ) != vnw_3sf.end() &&
-        vnw_3sf.find( buffer[i] ) != vnw_3sf.end() ){
-      ++arg_overlap_cnt;
-      break;
-    }
-    else if ( vnw_1p.find( w_or_l ) != vnw_1p.end() &&
-        vnw_1p.find( buffer[i] ) != vnw_1p.end() ){
-      ++arg_overlap_cnt;
-       break;
-   }
-    else if ( vnw_2p.find( w_or_l ) != vnw_2p.end() &&
-        vnw_2p.find( buffer[i] ) != vnw_2p.end() ){
-      ++arg_overlap_cnt;
-      break;
-    }
-    else if ( vnw_3p.find( w_or_l ) != vnw_3p.end() &&
-        vnw_3p.find( buffer[i] ) != vnw_3p.end() ){
-      ++arg_overlap_cnt;
-      break;
+  }
+}
+
+/**
+ * Adds a token to the window. When the window is full, the oldest
+ * token is dropped.
+ * @param id      the interned word or lemma
+ * @param classes its pronoun classes, see pronoun_classes()
+ */
+void overlapWindow::push( Intern::Id id, unsigned int classes ) {
+  if ( ring.empty() )
+    return;
+  size_t pos;
+  if ( filled < ring.size() ){
+    pos = filled++;
+  }
+  else {
+    pos = oldest;
+    const entry& old = ring[pos];
+    --counts[old.id];
+    for ( int c=0; c < N_VNW_CLASSES; ++c ){
+      if ( old.classes & (1 << c) )
+	--class_counts[c];
     }
+    oldest = ( oldest + 1 ) % ring.size();
   }
+  ring[pos].id = id;
+  ring[pos].classes = classes;
+  if ( id >= counts.size() )
+    counts.resize( id + 1, 0 );
+  ++counts[id];
+  for ( int c=0; c < N_VNW_CLASSES; ++c ){
+    if ( classes & (1 << c) )
+      ++class_counts[c];
+  }
+}
+
+/**
+ * Checks if a token overlaps with the window: the same token is in it,
+ * or a pronoun of the same class. Gives the same answer as
+ * argument_overlap() on the window contents, in constant time.
+ * @param id      the interned word or lemma
+ * @param classes its pronoun classes, see pronoun_classes()
+ */
+bool overlapWindow::overlaps( Intern::Id id, unsigned int classes ) const {
+  if ( id < counts.size() && counts[id] > 0 )
+    return true;
+  for ( int c=0; c < N_VNW_CLASSES; ++c ){
+    if ( ( classes & (1 << c) ) && class_counts[c] > 0 )
+      return true;
+  }
+  return false;
 }
 
 /**
@@ -164,7 +240,7 @@ string toMString( double d ){
   if ( std::isnan(d) )
     return "NA";
   else
-    return TiCC::toString( d );
+    return formatDouble( d );
 }
 
 /**
@@ -211,3 +287,34 @@ ostream& operator<<( ostream& os, const density& d ) {
     os << d.d;
   return os;
 }
+
+/**
+ * The name an output file is written under until it is complete. Every
+ * call gives another name, with the process id and a counter, so server
+ * workers or processes that write the same output at the same time each
+ * have their own file, and the last one renamed wins.
+ * @param  name the final name of the file
+ * @return      the temporary name, in the same directory
+ */
+string tempName( const string& name ) {
+  static atomic<unsigned long> counter( 0 );
+  return name + ".tmp." + to_string( getpid() ) + "." + to_string( ++counter );
+}
+
+/**
+ * Closes a file written under a tempName() and renames it to name.
+ * A crash while writing thus never leaves a partial file behind under
+ * the final name.
+ * @param  out  the stream, opened on tmp
+ * @param  tmp  the temporary name, from tempName( name )
+ * @param  name the final name of the file
+ * @return      false when writing or renaming failed
+ */
+bool commitFile( ofstream& out, const string& tmp, const string& name ) {
+  out.close();
+  if ( out.fail() || rename( tmp.c_str(), name.c_str() ) != 0 ) {
+    remove( tmp.c_str() );
+    return false;
+  }
+  return true;
+}
@@ -1,11 +1,10 @@
 #include "tscan/stats.h"
+#include "tscan/log.h"
 
 using namespace std;
 
-vector<const wordStats*> wordStats::collectWords() const {
-  vector<const wordStats*> result;
-  result.push_back( this );
-  return result;
+wordSpan wordStats::collectWords() const {
+  return wordSpan( this, this + 1 );
 }
 
 bool wordStats::setPersRef() {
@@ -141,69 +140,42 @@ bool wordStats::checkNominal( const xmlNode *alpWord ) const {
  * CGNProps
  **********/
 
-void wordStats::setCGNProps( const folia::PosAnnotation* pa ) {
+void wordStats::setCGNProps( const tokenInfo& token ) {
+  const folia::PosAnnotation *pa = token.pa;
   if ( tag == CGN::LET )
     prop = CGN::ISLET;
   else if ( tag == CGN::SPEC && pos.find("eigen") != string::npos )
     prop = CGN::ISNAME;
   else if ( tag == CGN::WW ){
-    string wvorm = pa->feat("wvorm");
-    if ( wvorm == "inf" ){
+    switch ( token.wvorm ){
+    case CGN::WV_INF:
       prop = CGN::ISINF;
-      string pos = pa->feat("positie");
-      if ( pos == "vrij" ){
-	position = CGN::VRIJ;
-      }
-      else if ( pos == "prenom" ){
-	position = CGN::PRENOM;
-      }
-      else if ( pos == "nom" ){
-	position = CGN::NOMIN;
-      }
-    }
-    else if ( wvorm == "vd" ){
+      position = token.position;
+      break;
+    case CGN::WV_VD:
       prop = CGN::ISVD;
-      string pos = pa->feat("positie");
-      if ( pos == "vrij" ){
-	position = CGN::VRIJ;
-      }
-      else if ( pos == "prenom" ){
-	position = CGN::PRENOM;
-      }
-      else if ( pos == "nom" ){
-	position = CGN::NOMIN;
-      }
-    }
-    else if ( wvorm == "od" ){
+      position = token.position;
+      break;
+    case CGN::WV_OD:
       prop = CGN::ISOD;
-      string pos = pa->feat("positie");
-      if ( pos == "vrij" ){
-	position = CGN::VRIJ;
-      }
-      else if ( pos == "prenom" ){
-	position = CGN::PRENOM;
-      }
-      else if ( pos == "nom" ){
-	position = CGN::NOMIN;
-      }
-    }
-    else if ( wvorm == "pv" ){
-      string tijd = pa->feat("pvtijd");
-      if ( tijd == "tgw" )
+      position = token.position;
+      break;
+    case CGN::WV_PV:
+      if ( token.pvtijd == CGN::TGW )
 	prop = CGN::ISPVTGW;
-      else if ( tijd == "verl" )
+      else if ( token.pvtijd == CGN::VERL )
 	prop = CGN::ISPVVERL;
-      else if ( tijd == "conj" )
+      else if ( token.pvtijd == CGN::CONJ )
 	prop = CGN::ISSUBJ;
       else {
-	cerr << "cgnProps: een onverwachte ww tijd: " << tijd << endl;
+	TLOG( WARNING ) << "cgnProps: een onverwachte ww tijd: " << pa->feat("pvtijd");
       }
-    }
-    else if ( wvorm == "" ){
+      break;
+    case CGN::NO_WVORM:
       // probably WW(dial)
-    }
-    else {
-      cerr << "cgnProps: een onverwachte ww vorm: " << wvorm << endl;
+      break;
+    default:
+      TLOG( WARNING ) << "cgnProps: een onverwachte ww vorm: " << pa->feat("wvorm");
     }
   }
   else if ( tag == CGN::VNW ){
@@ -227,8 +199,8 @@ void wordStats::setCGNProps( const folia::PosAnnotation* pa ) {
 	    isPronRef = ( vwtype == "pers" || vwtype == "bez" );
 	  }
 	  else {
-	    cerr << "cgnProps: een onverwachte PRONOUN persoon : " << persoon
-		 << " for word " << word << endl;
+	    TLOG( WARNING ) << "cgnProps: een onverwachte PRONOUN persoon : "
+			    << persoon << " for word " << word;
 	  }
 	}
       }
@@ -243,8 +215,7 @@ void wordStats::setCGNProps( const folia::PosAnnotation* pa ) {
     archaic = ( cas == "gen" || cas == "dat" );
   }
   else if ( tag == CGN::VG ) {
-    string cp = pa->feat("conjtype");
-    isOnder = cp == "onder";
+    isOnder = token.conjtype == CGN::ONDER;
   }
 }
 
@@ -364,321 +335,192 @@ void wordStats::getSentenceOverlap( const vector<string>& wordbuffer,
  ************/
 
 /**
- * Adds cnt times "NA," to the outputstream
- * @param os  the current outputstream
- * @param cnt the number of times to print "NA,"
- */
-void na( ostream& os, int cnt ){
-  for ( int i=0; i < cnt; ++i ){
-    os << "NA,";
-  }
-  os << endl;
-}
-
-/**
- * Sets all headers of the wordStats .csv-output.
+ * Fills the columns of a word line.
+ * @param line the line to fill
  */
-void wordStats::CSVheader( ostream& os, const string& ) const {
-  wordSortHeader( os );
-  wordDifficultiesHeader( os );
-  coherenceHeader( os );
-  concreetHeader( os );
-  compoundHeader( os );
-  persoonlijkheidHeader( os );
-  miscHeader( os );
-  os << endl;
-}
-
-/**
- * Sets all .csv-output for wordStats.
- * @param os the current outputstream
- */
-void wordStats::toCSV( ostream& os ) const {
-  wordSortToCSV( os );
-  if ( parseFail )
-    return;
-  wordDifficultiesToCSV( os );
-  coherenceToCSV( os );
-  concreetToCSV( os );
-  compoundToCSV( os );
-  persoonlijkheidToCSV( os );
-  miscToCSV( os );
-  os << endl;
-}
-
-void wordStats::wordSortHeader( ostream& os ) const {
-  os << "InputFile,Segment,Woord,lemma,Voll_lemma,morfemen,Samenst_delen_Frog,Wrdsoort,Afk,";
-}
-
-void wordStats::wordSortToCSV( ostream& os ) const {
-  os << id << ",";
-  os << '"' << word << "\",";
-  if ( parseFail ){
-    na( os, 56 );
+void wordStats::CSVcolumns( csvLine& line ) const {
+  line.col( "Segment", id );
+  line.quoted( "Woord", word );
+  if ( parseFail && !line.isHeader() ){
+    // nothing else is known: the line is completed with NA's
     return;
   }
-  os << '"' << lemma << "\",";
-  os << '"' << full_lemma << "\",";
+  if ( line.wants( Groups::WORD_SORT ) )
+    wordSortCSV( line );
+  if ( line.wants( Groups::WORD_DIFFICULTIES ) )
+    wordDifficultiesCSV( line );
+  if ( line.wants( Groups::COHERENCE ) )
+    coherenceCSV( line );
+  if ( line.wants( Groups::CONCREET ) )
+    concreetCSV( line );
+  if ( line.wants( Groups::COMPOUND ) )
+    compoundCSV( line );
+  if ( line.wants( Groups::PERSOONLIJKHEID ) )
+    persoonlijkheidCSV( line );
+  if ( line.wants( Groups::MISC ) )
+    miscCSV( line );
+}
 
-  // Morphemes
-  os << '"';
+void wordStats::wordSortCSV( csvLine& line ) const {
+  line.quoted( "lemma", lemma );
+  line.quoted( "Voll_lemma", full_lemma );
+  string morphs;
   for( size_t i=0; i < morphemes.size(); ++i ){
-    os << "[" << morphemes[i] << "]";
+    morphs += "[" + morphemes[i] + "]";
   }
-  os << "\",";
-
-  os << (!compstr.empty() ? compstr : "-") << ",";
-
-  os << tag << ",";
+  line.quoted( "morfemen", morphs );
+  line.col( "Samenst_delen_Frog", !compstr.empty() ? compstr : "-" );
+  line.col( "Wrdsoort", CGN::toString( tag ) );
   if ( afkType == Afk::NO_A ) {
-    os << "0,";
+    line.col( "Afk", "0" );
   }
   else {
-    os << afkType << ",";
+    line.col( "Afk", Afk::toString( afkType ) );
   }
 }
 
-void wordStats::wordDifficultiesHeader( ostream& os ) const {
-  os << "Let_per_wrd,Wrd_per_let,Let_per_wrd_zn,Wrd_per_let_zn,"
-     << "Morf_per_wrd,Wrd_per_morf,Morf_per_wrd_zn,Wrd_per_morf_zn,"
-     << "Wrd_prev,Wrd_prev_z,"
-     << "Wrd_freq_log,Wrd_freq_zn_log,"
-     << "Wrd_freq_log_corr,Wrd_freq_zn_log_corr,"
-     << "Lem_freq_log,Lem_freq_zn_log,"
-     << "Freq1000,Freq2000,Freq3000,Freq5000,Freq10000,Freq20000,";
+void wordStats::wordDifficultiesCSV( csvLine& line ) const {
+  bool isName = ( prop == CGN::ISNAME );
+  // LET() zaken o.a. have no morphemes
+  double morphs = ( morphCnt == 0 ) ? 1.0 : double(morphCnt);
+  line.col( "Let_per_wrd", double(charCnt) );
+  line.col( "Wrd_per_let", 1.0/double(charCnt) );
+  line.missing( isName );
+  line.col( "Let_per_wrd_zn", double(charCnt) );
+  line.col( "Wrd_per_let_zn", 1.0/double(charCnt) );
+  line.missing( false );
+  line.col( "Morf_per_wrd", morphs );
+  line.col( "Wrd_per_morf", 1.0/morphs );
+  line.missing( isName );
+  line.col( "Morf_per_wrd_zn", morphs );
+  line.col( "Wrd_per_morf_zn", 1.0/morphs );
+  line.missing( false );
+
+  line.col( "Wrd_prev", prevalenceP );
+  line.col( "Wrd_prev_z", prevalenceZ );
+
+  line.col( "Wrd_freq_log", word_freq_log );
+  line.missing( isName );
+  line.col( "Wrd_freq_zn_log", word_freq_log );
+  line.missing( false );
+  line.col( "Wrd_freq_log_corr", word_freq_log_corr );
+  line.missing( isName );
+  line.col( "Wrd_freq_zn_log_corr", word_freq_log_corr );
+  line.missing( false );
+  line.col( "Lem_freq_log", lemma_freq_log );
+  line.missing( isName );
+  line.col( "Lem_freq_zn_log", lemma_freq_log );
+  line.missing( false );
+
+  line.col( "Freq1000", top_freq == top1000 );
+  line.col( "Freq2000", top_freq <= top2000 );
+  line.col( "Freq3000", top_freq <= top3000 );
+  line.col( "Freq5000", top_freq <= top5000 );
+  line.col( "Freq10000", top_freq <= top10000 );
+  line.col( "Freq20000", top_freq <= top20000 );
 }
 
-void wordStats::wordDifficultiesToCSV( ostream& os ) const {
-  os << std::showpoint
-     << double(charCnt) << ","
-     << 1.0/double(charCnt) <<  ",";
-  if ( prop == CGN::ISNAME ){
-    os << "NA,NA,";
-  }
-  else {
-    os << double(charCnt) << "," << 1.0/double(charCnt) <<  ",";
-  }
-  if ( morphCnt == 0 ){
-    // LET() zaken o.a.
-    os << 1.0 << "," << 1.0 << ",";
-  }
-  else {
-    os << double(morphCnt) << ","
-       << 1.0/double(morphCnt) << ",";
-  }
-  if ( prop == CGN::ISNAME ){
-    os << "NA,NA,";
-  }
-  else {
-    if ( morphCnt == 0 ){
-      os << 1.0 << "," << 1.0 << ",";
-    }
-    else {
-      os << double(morphCnt) << ","
-	 << 1.0/double(morphCnt) << ",";
-    }
-  }
-
-  if ( std::isnan(prevalenceP) )
-    os << "NA,";
-  else
-    os << prevalenceP << ",";
-  if ( std::isnan(prevalenceZ) )
-    os << "NA,";
-  else
-    os << prevalenceZ << ",";
-
-  if ( std::isnan(word_freq_log) )
-    os << "NA,";
-  else
-    os << word_freq_log << ",";
-  if ( prop == CGN::ISNAME || std::isnan(word_freq_log) )
-    os << "NA" << ",";
-  else
-    os << word_freq_log << ",";
-
-  if ( std::isnan(word_freq_log_corr) )
-    os << "NA,";
-  else
-    os << word_freq_log_corr << ",";
-  // column: Wrd_freq_zn_log_corr
-  if ( prop == CGN::ISNAME || std::isnan(word_freq_log_corr) )
-    os << "NA" << ",";
-  else
-    os << word_freq_log_corr << ",";
-
-  if ( std::isnan(lemma_freq_log) )
-    os << "NA,";
-  else
-    os << lemma_freq_log << ",";
-  if ( prop == CGN::ISNAME || std::isnan(lemma_freq_log) )
-    os << "NA" << ",";
-  else
-    os << lemma_freq_log << ",";
-  os << (top_freq==top1000?1:0) << ",";
-  os << (top_freq<=top2000?1:0) << ",";
-  os << (top_freq<=top3000?1:0) << ",";
-  os << (top_freq<=top5000?1:0) << ",";
-  os << (top_freq<=top10000?1:0) << ",";
-  os << (top_freq<=top20000?1:0) << ",";
-}
-
-void wordStats::coherenceHeader( ostream& os ) const {
-  os << "Conn_type,Conn_combi,Vnw_ref,";
-}
-
-void wordStats::coherenceToCSV( ostream& os ) const {
+void wordStats::coherenceCSV( csvLine& line ) const {
   if ( connType == Conn::NOCONN )
-    os << "0,";
+    line.col( "Conn_type", "0" );
   else
-    os << connType << ",";
-  os << isMultiConn << ","
-     << isPronRef << ",";
+    line.col( "Conn_type", Conn::toString( connType ) );
+  line.col( "Conn_combi", isMultiConn );
+  line.col( "Vnw_ref", isPronRef );
 }
 
-void wordStats::concreetHeader( ostream& os ) const {
-  os << "Semtype_nw,";
-  os << "Alg_nw,"; // 20150721: Feature added
-  os << "Conc_nw_strikt,";
-  os << "Conc_nw_ruim,";
-  os << "Semtype_bvnw,";
-  os << "Conc_bvnw_strikt,";
-  os << "Conc_bvnw_ruim,";
-  os << "Semtype_ww,";
-  os << "Alg_ww,"; // 20150821: Feature added
-  os << "Semtype_bw,"; // 20150821: Feature added
-}
-
-void wordStats::concreetToCSV( ostream& os ) const {
+void wordStats::concreetCSV( csvLine& line ) const {
   if ( tag == CGN::N || prop == CGN::ISNAME ) {
-    os << sem_type << ",";
+    line.col( "Semtype_nw", SEM::toString( sem_type ) );
   }
   else {
-    os << "0,";
+    line.col( "Semtype_nw", "0" );
   }
   if ( tag == CGN::N ) {
-    os << general_noun_type << ",";
+    line.col( "Alg_nw", General::toString( general_noun_type ) ); // 20150721: Feature added
   }
   else {
-    os << "0,";
+    line.col( "Alg_nw", "0" );
   }
-  os << SEM::isStrictNoun(sem_type) << "," << SEM::isBroadNoun(sem_type) << ",";
+  line.col( "Conc_nw_strikt", SEM::isStrictNoun( sem_type ) );
+  line.col( "Conc_nw_ruim", SEM::isBroadNoun( sem_type ) );
   if ( tag == CGN::ADJ ) {
-    os << sem_type << ",";
+    line.col( "Semtype_bvnw", SEM::toString( sem_type ) );
   }
   else {
-    os << "0,";
+    line.col( "Semtype_bvnw", "0" );
   }
-  os << SEM::isStrictAdj(sem_type) << "," << SEM::isBroadAdj(sem_type) << ",";
+  line.col( "Conc_bvnw_strikt", SEM::isStrictAdj( sem_type ) );
+  line.col( "Conc_bvnw_ruim", SEM::isBroadAdj( sem_type ) );
   if ( tag == CGN::WW ) {
-    os << sem_type << ",";
-    os << general_verb_type << ",";
+    line.col( "Semtype_ww", SEM::toString( sem_type ) );
+    line.col( "Alg_ww", General::toString( general_verb_type ) ); // 20150821: Feature added
   }
   else {
-    os << "0,";
-    os << "0,";
+    line.col( "Semtype_ww", "0" );
+    line.col( "Alg_ww", "0" );
   }
   if ( tag == CGN::BW ) {
-    os << adverb_type << ",";
+    line.col( "Semtype_bw", Adverb::toString( adverb_type ) ); // 20150821: Feature added
   }
   else {
-    os << "0,";
+    line.col( "Semtype_bw", "0" );
   }
 }
 
-void wordStats::compoundHeader( ostream& os ) const {
-  os << "Samenst,Samenst_delen,";
-  os << "Let_per_wrd_hfdwrd,Let_per_wrd_satwrd,";
-  os << "Wrd_freq_log_hfdwrd,Wrd_freq_log_satwrd,Wrd_freq_log_(hfd_sat),";
-  os << "Freq1000_hfdwrd,Freq5000_hfdwrd,Freq20000_hfdwrd,";
-  os << "Freq1000_satwrd,Freq5000_satwrd,Freq20000_satwrd,";
-  os << "Samenst_Frog,";
+void wordStats::compoundCSV( csvLine& line ) const {
+  line.col( "Samenst", is_compound );
+  // not applicable for non-compounds
+  line.missing( !is_compound );
+  line.col( "Samenst_delen", double(compound_parts) );
+  line.col( "Let_per_wrd_hfdwrd", double(charCntHead) );
+  line.col( "Let_per_wrd_satwrd", double(charCntSat) );
+  line.col( "Wrd_freq_log_hfdwrd", word_freq_log_head );
+  line.col( "Wrd_freq_log_satwrd", word_freq_log_sat );
+  line.col( "Wrd_freq_log_(hfd_sat)", word_freq_log_head_sat );
+  line.col( "Freq1000_hfdwrd", top_freq_head == top1000 );
+  line.col( "Freq5000_hfdwrd", top_freq_head <= top5000 );
+  line.col( "Freq20000_hfdwrd", top_freq_head <= top20000 );
+  line.col( "Freq1000_satwrd", top_freq_sat == top1000 );
+  line.col( "Freq5000_satwrd", top_freq_sat <= top5000 );
+  line.col( "Freq20000_satwrd", top_freq_sat <= top20000 );
+  line.missing( false );
+
+  line.col( "Samenst_Frog", !compstr.empty() );
 }
 
-void wordStats::compoundToCSV( ostream& os ) const {
-  os << (is_compound ? 1 : 0) << ",";
-  if (is_compound) {
-    os << double(compound_parts) << ",";
-    os << double(charCntHead) << ",";
-    os << double(charCntSat) << ",";
-    if ( std::isnan(word_freq_log_head) )
-      os << "NA,";
-    else
-      os << word_freq_log_head << ",";
-    if ( std::isnan(word_freq_log_sat) )
-      os << "NA,";
-    else
-      os << word_freq_log_sat << ",";
-    if ( std::isnan(word_freq_log_head_sat) )
-      os << "NA,";
-    else
-      os << word_freq_log_head_sat << ",";
-    os << (top_freq_head == top1000 ? 1 : 0) << ",";
-    os << (top_freq_head <= top5000 ? 1 : 0) << ",";
-    os << (top_freq_head <= top20000 ? 1 : 0) << ",";
-    os << (top_freq_sat == top1000 ? 1 : 0) << ",";
-    os << (top_freq_sat <= top5000 ? 1 : 0) << ",";
-    os << (top_freq_sat <= top20000 ? 1 : 0) << ",";
-  }
-  else {
-    // For non-compounds, just print not applicable for each attribute
-    for (int i = 0; i < 12; i++) {
-      os << "NA,";
-    }
-  }
-
-  os << (!compstr.empty() ? 1 : 0) << ",";
-}
-
-void wordStats::persoonlijkheidHeader( ostream& os ) const {
-  os << "Pers_ref,Pers_vnw1,Pers_vnw2,Pers_vnw3,Pers_vnw,"
-     << "Naam_POS,Naam_NER," // 20141125: Feature Naam_POS moved
-     << "Imp_ellips,"; // 20141125: Feature Pers_nw moved (deleted 20150703) and Emo_bvn deleted
-}
-
-void wordStats::persoonlijkheidToCSV( ostream& os ) const {
-  os << isPersRef << ","
-     << (prop == CGN::ISPPRON1 ) << ","
-     << (prop == CGN::ISPPRON2 ) << ","
-     << (prop == CGN::ISPPRON3 ) << ","
-     << (prop == CGN::ISPPRON1 || prop == CGN::ISPPRON2 || prop == CGN::ISPPRON3) << ",";
-  os << (prop == CGN::ISNAME) << ","; // column: Naam_POS
+void wordStats::persoonlijkheidCSV( csvLine& line ) const {
+  line.col( "Pers_ref", isPersRef );
+  line.col( "Pers_vnw1", prop == CGN::ISPPRON1 );
+  line.col( "Pers_vnw2", prop == CGN::ISPPRON2 );
+  line.col( "Pers_vnw3", prop == CGN::ISPPRON3 );
+  line.col( "Pers_vnw", prop == CGN::ISPPRON1 || prop == CGN::ISPPRON2 || prop == CGN::ISPPRON3 );
+  line.col( "Naam_POS", prop == CGN::ISNAME ); // 20141125: Feature Naam_POS moved
   if ( nerProp == NER::NONER )
-    os << "0,";
+    line.col( "Naam_NER", "0" );
   else
-    os << nerProp << ",";
-  os << isImperative << ",";
+    line.col( "Naam_NER", NER::toString( nerProp ) );
+  line.col( "Imp_ellips", isImperative );
 }
 
-
-void wordStats::miscHeader( ostream& os ) const {
-  os << "Ww_vorm,Ww_tt,Vol_dw,Onvol_dw,Infin,Archaisch,Log_prob_fwd,Log_prob_bwd,Intens,Formeel,Op_stoplijst,Eigen_classificatie";
-}
-
-void wordStats::miscToCSV( ostream& os ) const {
+void wordStats::miscCSV( csvLine& line ) const {
   if ( wwform == ::NO_VERB ){
-    os << "0,";
+    line.col( "Ww_vorm", "0" );
   }
   else {
-    os << wwform << ",";
-  }
-  os << (prop == CGN::ISPVTGW) << ",";
-  os << (prop == CGN::ISVD?toString(position):"0") << ","
-     << (prop == CGN::ISOD?toString(position):"0") << ","
-     << (prop == CGN::ISINF?toString(position):"0") << ",";
-  os << archaic << ",";
-  if ( std::isnan(logprob10_fwd) )
-    os << "NA,";
-  else
-    os << logprob10_fwd << ",";
-  if ( std::isnan(logprob10_bwd) )
-    os << "NA,";
-  else
-    os << logprob10_bwd << ",";
-  os << (intensify_type != Intensify::NO_INTENSIFY ? "1," : "0,");
-  os << Formal::toString(formal_type) << ",";
-  os << (on_stoplist ? "1" : "0") << ",";
-  os << my_classification << ",";
+    line.col( "Ww_vorm", toString( wwform ) );
+  }
+  line.col( "Ww_tt", prop == CGN::ISPVTGW );
+  line.col( "Vol_dw", prop == CGN::ISVD ? CGN::toString( position ) : "0" );
+  line.col( "Onvol_dw", prop == CGN::ISOD ? CGN::toString( position ) : "0" );
+  line.col( "Infin", prop == CGN::ISINF ? CGN::toString( position ) : "0" );
+  line.col( "Archaisch", archaic );
+  line.col( "Log_prob_fwd", logprob10_fwd );
+  line.col( "Log_prob_bwd", logprob10_bwd );
+  line.col( "Intens", intensify_type != Intensify::NO_INTENSIFY );
+  line.col( "Formeel", Formal::toString( formal_type ) );
+  line.col( "Op_stoplijst", on_stoplist );
+  line.col( "Eigen_classificatie", my_classification );
 }
 
 /**************
@@ -729,9 +571,9 @@ void wordStats::addMetrics( ) const {
   if ( isMultiConn )
     addOneMetric( doc, el, "multi_connective", "true" );
   if ( !std::isnan(prevalenceP) )
-    addOneMetric( doc, el, "prevalenceP", TiCC::toString(prevalenceP) );
+    addOneMetric( doc, el, "prevalenceP", prevalenceP );
   if ( !std::isnan(prevalenceZ) )
-    addOneMetric( doc, el, "prevalenceZ", TiCC::toString(prevalenceZ) );
+    addOneMetric( doc, el, "prevalenceZ", prevalenceZ );
   if ( f50 )
     addOneMetric( doc, el, "f50", "true" );
   if ( f65 )
@@ -752,20 +594,20 @@ void wordStats::addMetrics( ) const {
     addOneMetric( doc, el, "top10000", "true" );
   else if ( top_freq == top20000 )
     addOneMetric( doc, el, "top20000", "true" );
-  addOneMetric( doc, el, "word_freq", TiCC::toString(word_freq) );
+  addOneMetric( doc, el, "word_freq", word_freq );
   if ( !std::isnan(word_freq_log) )
-    addOneMetric( doc, el, "log_word_freq", TiCC::toString(word_freq_log) );
-  addOneMetric( doc, el, "lemma_freq", TiCC::toString(lemma_freq) );
+    addOneMetric( doc, el, "log_word_freq", word_freq_log );
+  addOneMetric( doc, el, "lemma_freq", lemma_freq );
   if ( !std::isnan(lemma_freq_log) )
-    addOneMetric( doc, el, "log_lemma_freq", TiCC::toString(lemma_freq_log) );
+    addOneMetric( doc, el, "log_lemma_freq", lemma_freq_log );
   addOneMetric( doc, el,
-    "word_overlap_count", TiCC::toString( wordOverlapCnt ) );
+    "word_overlap_count", wordOverlapCnt );
   addOneMetric( doc, el,
-    "lemma_overlap_count", TiCC::toString( lemmaOverlapCnt ) );
+    "lemma_overlap_count", lemmaOverlapCnt );
   if ( !std::isnan(logprob10_fwd) )
-    addOneMetric( doc, el, "lprob10_fwd", TiCC::toString(logprob10_fwd) );
+    addOneMetric( doc, el, "lprob10_fwd", logprob10_fwd );
   if ( !std::isnan(logprob10_bwd) )
-    addOneMetric( doc, el, "lprob10_bwd", TiCC::toString(logprob10_bwd) );
+    addOneMetric( doc, el, "lprob10_bwd", logprob10_bwd );
   if ( prop != CGN::JUSTAWORD )
     addOneMetric( doc, el, "property", TiCC::toString(prop) );
   if ( sem_type != SEM::NO_SEMTYPE )
@@ -0,0 +1,138 @@
+#!/usr/bin/env python3
+"""
+Offline throughput benchmark of tscan. Frog, Alpino, Wopr and the
+compound splitter are replaced by the stand-ins of replay.py, so the
+results only depend on tscan itself. Two runs are made:
+ - 'examples': all tests/*.example texts, through Frog;
+ - 'synthetic': large Frog tagged documents made by gendoc.py.
+For both the documents/s, words/s, peak RSS and the time per stage (from
+tscan --profile) are reported. With --save the results are written as
+JSON, with --baseline they are compared to such a file.
+"""
+import argparse
+import glob
+import json
+import os
+import random
+import shutil
+import subprocess
+import sys
+import tempfile
+import time
+
+import gendoc
+import replay
+
+HERE = os.path.dirname(os.path.abspath(__file__))
+PORTS = {"frog": 17001, "alpino": 17003, "wopr_fwd": 17020, "wopr_bwd": 17002,
+         "compound": 17005}
+
+
+def run(tscan, inputs, workdir, name):
+    """Runs tscan once over the inputs; returns the results."""
+    profile = os.path.join(workdir, name + ".profile.jsonl")
+    command = [tscan, "--config=" + os.path.join(HERE, "bench.cfg"),
+               "--profile=" + profile, "--log-level=warning"] + inputs
+    with open(os.path.join(workdir, name + ".log"), "w") as log:
+        start = time.time()
+        process = subprocess.Popen(command, cwd=os.path.join(HERE, os.pardir),
+                                   stdout=log, stderr=log)
+        _, status, usage = os.wait4(process.pid, 0)
+        seconds = time.time() - start
+    if status != 0:
+        sys.exit("tscan failed, see " + log.name)
+    reports = []
+    if os.path.exists(profile):
+        with open(profile) as f:
+            reports = [json.loads(line) for line in f]
+    words = sum(r["words"] for r in reports)
+    stages = {}
+    for r in reports:
+        for stage, s in r["stages"].items():
+            total = stages.setdefault(stage, {"calls": 0, "seconds": 0.0})
+            total["calls"] += s["calls"]
+            total["seconds"] += s["seconds"]
+    return {"documents": len(reports),
+            "failed": len(inputs) - len(reports),
+            "words": words,
+            "seconds": seconds,
+            "documents_per_second": len(reports) / seconds,
+            "words_per_second": words / seconds,
+            # kilobytes on Linux
+            "peak_rss_mb": usage.ru_maxrss / 1024.0,
+            "stages": stages}
+
+
+def report(name, r, base=None):
+    def change(key):
+        if not base or not base.get(key):
+            return ""
+        return "  (%+.1f%%)" % (100.0 * (r[key] - base[key]) / base[key])
+
+    print("%s: %d documents, %d words in %.2f s%s"
+          % (name, r["documents"], r["words"], r["seconds"],
+             ", %d FAILED" % r["failed"] if r["failed"] else ""))
+    for key, unit in (("documents_per_second", "documents/s"),
+                      ("words_per_second", "words/s"), ("peak_rss_mb", "MB peak RSS")):
+        print("  %12.1f %s%s" % (r[key], unit, change(key)))
+    for stage, s in sorted(r["stages"].items(), key=lambda x: -x[1]["seconds"]):
+        print("  %12.3f s %-18s %8d calls" % (s["seconds"], stage, s["calls"]))
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__,
+                                     formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("--tscan", default=os.path.join(HERE, os.pardir, os.pardir, "src", "tscan"))
+    parser.add_argument("--docs", type=int, default=4, help="number of synthetic documents")
+    parser.add_argument("--words", type=int, default=20000, help="words per synthetic document")
+    parser.add_argument("--seed", type=int, default=1)
+    parser.add_argument("--recordings", default=os.path.join(HERE, "recordings"))
+    parser.add_argument("--save", help="write the results to this JSON file")
+    parser.add_argument("--baseline", help="compare with the results in this JSON file")
+    parser.add_argument("--keep", action="store_true", help="keep the work directory")
+    args = parser.parse_args()
+
+    tscan = os.path.abspath(args.tscan)
+    if not os.access(tscan, os.X_OK):
+        sys.exit("no tscan at " + tscan + ", see --tscan")
+    recordings = replay.start(PORTS, args.recordings)
+    workdir = tempfile.mkdtemp(prefix="tscan-bench-")
+
+    examples = []
+    for name in sorted(glob.glob(os.path.join(HERE, os.pardir, "*.example"))):
+        copy = os.path.join(workdir, os.path.basename(name))
+        shutil.copy(name, copy)
+        examples.append(copy)
+    header, pars = gendoc.paragraphs()
+    rnd = random.Random(args.seed)
+    synthetic = []
+    for i in range(1, args.docs + 1):
+        name = os.path.join(workdir, "synth-%d.xml" % i)
+        with open(name, "w", encoding="utf-8") as f:
+            f.write(gendoc.document(header, pars, args.words, rnd)[0])
+        synthetic.append(name)
+
+    results = {"tscan": tscan,
+               "examples": run(tscan, examples, workdir, "examples"),
+               "synthetic": run(tscan, synthetic, workdir, "synthetic"),
+               "stand-ins": recordings.counts}
+    base = None
+    if args.baseline:
+        with open(args.baseline) as f:
+            base = json.load(f)
+    for name in ("examples", "synthetic"):
+        report(name, results[name], base and base.get(name))
+    for service, counts in sorted(recordings.counts.items()):
+        if counts["unknown"]:
+            print("warning: %d unknown %s requests" % (counts["unknown"], service))
+    if args.save:
+        with open(args.save, "w") as f:
+            json.dump(results, f, indent=2)
+    if args.keep:
+        print("work directory: " + workdir)
+    else:
+        shutil.rmtree(workdir)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,69 @@
+#!/usr/bin/env python3
+"""
+Makes large Frog tagged FoLiA documents for benchmarking tscan, from
+randomly picked paragraphs of the expected outputs of tests/*.example
+(without the tscan metrics). So Frog isn't needed to read them, and the
+Alpino stand-in of replay.py knows the parses of all their sentences.
+The same seed gives the same documents.
+"""
+import argparse
+import os
+import random
+import re
+
+import replay
+
+
+def paragraphs():
+    """The paragraphs of the examples, with their word counts, and the
+    header of a document that declares all annotations they use."""
+    result = []
+    header = None
+    for folia in replay.example_outputs().values():
+        text = folia.find("<text ")
+        if text < 0:
+            continue
+        if header is None or "alternative-annotation" in folia[:text] and \
+                "alternative-annotation" not in header:
+            header = folia[:text]
+        for m in re.finditer(r'<p xml:id="[^"]*\.p\.(\d+)">.*?</p>', folia, re.S):
+            result.append((int(m.group(1)), m.group(0), m.group(0).count("<w ")))
+    return header, result
+
+
+def document(header, pars, words, rnd):
+    """A document of at least 'words' words."""
+    body = []
+    count = 0
+    while count < words:
+        number, par, size = rnd.choice(pars)
+        # give the paragraph and all ids within the next number
+        par = re.sub(r'"[^".]*\.p\.%d(?=[."])' % number,
+                     '"synth.p.%d' % (len(body) + 1), par)
+        body.append("    " + par)
+        count += size
+    head = re.sub(r'xml:id="[^"]*"', 'xml:id="synth"', header, count=1)
+    return (head + '<text xml:id="synth.text">\n' + "\n".join(body)
+            + "\n  </text>\n</FoLiA>\n", count)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__)
+    parser.add_argument("--docs", type=int, default=1, help="number of documents")
+    parser.add_argument("--words", type=int, default=10000, help="words per document")
+    parser.add_argument("--seed", type=int, default=1)
+    parser.add_argument("--out", default=".", help="directory to write synth-<n>.xml to")
+    args = parser.parse_args()
+    rnd = random.Random(args.seed)
+    header, pars = paragraphs()
+    os.makedirs(args.out, exist_ok=True)
+    for i in range(1, args.docs + 1):
+        xml, count = document(header, pars, args.words, rnd)
+        name = os.path.join(args.out, "synth-%d.xml" % i)
+        with open(name, "w", encoding="utf-8") as f:
+            f.write(xml)
+        print("%s: %d words" % (name, count))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,311 @@
+#!/usr/bin/env python3
+"""
+Stand-in servers for Frog, Alpino, Wopr and the compound splitter, so
+tscan can be run without the real services, e.g. for benchmarking.
+
+Replies come from, in this order:
+ - recordings made with --record, one <service>.jsonl file per service
+   in the recordings directory;
+ - for Frog: the expected outputs of tests/*.example, without the tscan
+   metrics, for the text of the matching example;
+ - for Alpino: the parses listed in tests/alpino_lookup.data;
+ - otherwise a reply is made up: Wopr gets probabilities derived from
+   the words, the compound splitter splits long words in two, and Frog
+   lemmatizes single words to themselves.
+
+With --record SERVICE=HOST:PORT the requests for that service are passed
+on to the real server and its replies are added to the recordings.
+"""
+import argparse
+import glob
+import hashlib
+import json
+import math
+import os
+import re
+import socket
+import socketserver
+import sys
+import threading
+from xml.sax.saxutils import escape
+
+TESTS = os.path.join(os.path.dirname(os.path.abspath(__file__)), os.pardir)
+SERVICES = ("frog", "alpino", "wopr_fwd", "wopr_bwd", "compound")
+
+
+def normalize(text):
+    return " ".join(text.split())
+
+
+def frog_input(text):
+    """The lines tscan sends to Frog for an input text, see readFrogInput()."""
+    lines = []
+    incomment = False
+    for line in text.split("\n"):
+        line = line.rstrip("\r").split("###")[0]
+        if line.startswith("\ufeff"):
+            line = line[1:]
+        line = re.sub(r"[{\[]", "(", line)
+        line = re.sub(r"[}\]]", ")", line)
+        if line.startswith("<<<"):
+            incomment = True
+        elif line.startswith(">>>"):
+            incomment = False
+            continue
+        if incomment:
+            continue
+        lines.append(line)
+    return "\n".join(lines)
+
+
+def strip_tscan(folia):
+    """A tscan output as Frog returned it: without the tscan metrics."""
+    folia = re.sub(r"<\?xml-stylesheet[^>]*\?>\n?", "", folia)
+    folia = re.sub(r"\n\s*<metric [^>]*/>", "", folia)
+    folia = re.sub(r"\n\s*<pos [^>]*set=\"tscan-set\"/>", "", folia)
+    folia = re.sub(r"\n\s*<metric-annotation [^>]*/>", "", folia)
+    # folialint --strip empties the version
+    folia = re.sub(r'(<FoLiA [^>]*)version=""', r'\1version="2.0.0"', folia, count=1)
+    return folia
+
+
+def example_outputs():
+    """The stripped expected outputs of the examples, by example name."""
+    result = {}
+    for name in sorted(glob.glob(os.path.join(TESTS, "*.example"))):
+        if os.path.exists(name + ".ok"):
+            with open(name + ".ok", encoding="utf-8") as f:
+                result[name] = strip_tscan(f.read())
+    return result
+
+
+def alpino_parses():
+    """The pre-parsed sentences, by their tokens."""
+    lookup = os.path.join(TESTS, "alpino_lookup.data")
+    result = {}
+    with open(lookup, encoding="utf-8") as f:
+        for line in f:
+            parts = line.rstrip("\n").split("\t")
+            if len(parts) == 3:
+                result[normalize(parts[0])] = (os.path.join(TESTS, parts[1]), int(parts[2]))
+    return result
+
+
+def read_parse(filename, index):
+    with open(filename, encoding="utf-8") as f:
+        xml = f.read()
+    if index == 0:
+        return xml
+    trees = re.findall(r"<alpino_ds.*?</alpino_ds>", xml, re.S)
+    if index > len(trees):
+        return ""
+    return '<?xml version="1.0" encoding="UTF-8"?>\n' + trees[index - 1] + "\n"
+
+
+def folia_document(sentences, declarations, words):
+    """A FoLiA document of tokenized sentences.
+    @param words makes the inner XML of a word from its text"""
+    out = ['<?xml version="1.0" encoding="UTF-8"?>',
+           '<FoLiA xmlns="http://ilk.uvt.nl/folia" xml:id="replay" version="2.0.0">',
+           '  <metadata type="native">', '    <annotations>',
+           '      <text-annotation/>', '      <token-annotation/>',
+           '      <sentence-annotation/>']
+    out += ["      " + d for d in declarations]
+    out += ['    </annotations>', '  </metadata>', '  <text xml:id="replay.text">']
+    for i, (tokens, extra) in enumerate(sentences, 1):
+        out.append('    <s xml:id="replay.s.%d">' % i)
+        for j, token in enumerate(tokens, 1):
+            out.append('      <w xml:id="replay.s.%d.w.%d"><t>%s</t>%s</w>'
+                       % (i, j, escape(token), words(token)))
+        if extra:
+            out.append("      " + extra)
+        out.append('    </s>')
+    out += ['  </text>', '</FoLiA>', '']
+    return "\n".join(out)
+
+
+def word_prob(word):
+    h = int(hashlib.md5(word.encode("utf-8")).hexdigest()[:8], 16)
+    return -1.0 - (h % 500) / 100.0
+
+
+def made_up_wopr(text):
+    sentences = []
+    for line in text.split("\n"):
+        tokens = line.split()
+        if not tokens:
+            continue
+        avg = sum(word_prob(t) for t in tokens) / len(tokens)
+        entropy = -avg * math.log2(10.0)
+        extra = ('<metric class="avg_prob10" value="%g"/><metric class="entropy" value="%g"/>'
+                 '<metric class="perplexity" value="%g"/>' % (avg, entropy, 2 ** entropy))
+        sentences.append((tokens, extra))
+    return folia_document(sentences, ['<metric-annotation set="wopr"/>'],
+                          lambda t: '<metric class="lprob10" value="%g"/>' % word_prob(t))
+
+
+def made_up_lemma(text):
+    tokens = text.split()
+    return folia_document([(tokens, "")],
+                          ['<lemma-annotation set="http://ilk.uvt.nl/folia/sets/frog-mblem-nl"/>'],
+                          lambda t: '<lemma class="%s"/>' % escape(t.lower(), {'"': "&quot;"}))
+
+
+def made_up_split(word):
+    if len(word) < 12:
+        return word
+    half = len(word) // 2
+    return word[:half] + "," + word[half:]
+
+
+class Recordings:
+    """The replies, by service and normalized request."""
+
+    def __init__(self, directory):
+        self.directory = directory
+        self.replies = dict((s, {}) for s in SERVICES)
+        self.counts = dict((s, {"recorded": 0, "made up": 0, "unknown": 0}) for s in SERVICES)
+        self.lock = threading.Lock()
+        for service in SERVICES:
+            name = os.path.join(directory, service + ".jsonl") if directory else None
+            if name and os.path.exists(name):
+                with open(name, encoding="utf-8") as f:
+                    for line in f:
+                        entry = json.loads(line)
+                        self.replies[service][normalize(entry["request"])] = entry["reply"]
+        for name, folia in example_outputs().items():
+            with open(name, encoding="utf-8") as f:
+                key = normalize(frog_input(f.read()))
+            self.replies["frog"].setdefault(key, folia)
+        self.parses = alpino_parses()
+
+    def record(self, service, request, reply):
+        with self.lock:
+            self.replies[service][normalize(request)] = reply
+            os.makedirs(self.directory, exist_ok=True)
+            with open(os.path.join(self.directory, service + ".jsonl"), "a", encoding="utf-8") as f:
+                f.write(json.dumps({"request": request, "reply": reply}) + "\n")
+
+    def count(self, service, kind):
+        with self.lock:
+            self.counts[service][kind] += 1
+
+    def reply(self, service, request):
+        key = normalize(request)
+        if key in self.replies[service]:
+            self.count(service, "recorded")
+            return self.replies[service][key]
+        if service == "alpino" and key in self.parses:
+            self.count(service, "recorded")
+            return read_parse(*self.parses[key])
+        if service.startswith("wopr"):
+            self.count(service, "made up")
+            return made_up_wopr(request)
+        if service == "compound":
+            self.count(service, "made up")
+            return made_up_split(request.split(",")[0].strip())
+        if service == "frog" and len(request.split()) == 1:
+            self.count(service, "made up")
+            return made_up_lemma(request)
+        self.count(service, "unknown")
+        return ""
+
+
+def read_request(sock, service):
+    """Reads a request as tscan sends it: for Frog ended by an EOT line,
+    for Alpino and Wopr by an empty line, for the compound splitter a
+    single write."""
+    if service == "compound":
+        return sock.recv(65536).decode("utf-8").strip()
+    f = sock.makefile("r", encoding="utf-8", newline="\n")
+    lines = []
+    for line in f:
+        line = line.rstrip("\r\n")
+        if service == "frog" and line == "EOT":
+            break
+        if service != "frog" and not line and lines:
+            break
+        lines.append(line)
+    return "\n".join(lines).strip("\n")
+
+
+def forward(address, service, request):
+    """Asks the real server."""
+    host, port = address.rsplit(":", 1)
+    with socket.create_connection((host, int(port))) as sock:
+        if service == "frog":
+            sock.sendall((request + "\nEOT\n").encode("utf-8"))
+        elif service == "compound":
+            sock.sendall(request.encode("utf-8"))
+        else:
+            sock.sendall((request + "\n\n").encode("utf-8"))
+        lines = []
+        for line in sock.makefile("r", encoding="utf-8"):
+            line = line.rstrip("\n")
+            if service == "frog" and line == "READY":
+                break
+            lines.append(line)
+            if service == "compound":
+                break
+        return "\n".join(lines)
+
+
+def serve(service, port, recordings, record=None):
+    class Handler(socketserver.BaseRequestHandler):
+        def handle(self):
+            request = read_request(self.request, service)
+            if record:
+                reply = forward(record, service, request)
+                recordings.record(service, request, reply)
+            else:
+                reply = recordings.reply(service, request)
+            if service == "frog":
+                reply = reply.rstrip("\n") + "\nREADY\n" if reply else "READY\n"
+            elif reply and not reply.endswith("\n"):
+                reply += "\n"
+            self.request.sendall(reply.encode("utf-8"))
+
+    socketserver.ThreadingTCPServer.allow_reuse_address = True
+    server = socketserver.ThreadingTCPServer(("127.0.0.1", port), Handler)
+    server.daemon_threads = True
+    thread = threading.Thread(target=server.serve_forever, daemon=True)
+    thread.start()
+    return server
+
+
+def start(ports, directory, records=None):
+    """Starts a server per service in ports; returns the recordings."""
+    recordings = Recordings(directory)
+    for service, port in ports.items():
+        serve(service, port, recordings, (records or {}).get(service))
+    return recordings
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__,
+                                     formatter_class=argparse.RawDescriptionHelpFormatter)
+    for service, port in zip(SERVICES, (17001, 17003, 17020, 17002, 17005)):
+        parser.add_argument("--" + service.replace("_", "-"), type=int, default=port,
+                            help="port of the %s stand-in (default %d)" % (service, port))
+    parser.add_argument("--recordings", default=os.path.join(TESTS, "bench", "recordings"),
+                        help="directory of the recorded replies")
+    parser.add_argument("--record", action="append", default=[], metavar="SERVICE=HOST:PORT",
+                        help="pass the requests for SERVICE on to a real server, and record them")
+    args = parser.parse_args()
+    records = {}
+    for r in args.record:
+        service, _, address = r.partition("=")
+        if service not in SERVICES or not address:
+            parser.error("unknown service or address in --record " + r)
+        records[service] = address
+    ports = dict((s, getattr(args, s)) for s in SERVICES)
+    start(ports, args.recordings, records)
+    print("serving " + ", ".join("%s on %d" % sp for sp in ports.items()), file=sys.stderr)
+    try:
+        threading.Event().wait()
+    except KeyboardInterrupt:
+        pass
+
+
+if __name__ == "__main__":
+    main()
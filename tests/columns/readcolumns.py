@@ -0,0 +1,144 @@
+#!/usr/bin/env python3
+"""
+Reads the columnar output of 'tscan --columns', as described in
+include/tscan/columns.h, and prints every document as the CSV file that
+tscan writes for it.
+
+As a module: read(path) returns the blocks of a file, as Block objects.
+"""
+import csv
+import gzip
+import math
+import struct
+import sys
+
+INT, REAL, TEXT = 0, 1, 2
+INT_NA = -2 ** 63
+TEXT_NA = 0xFFFFFFFF
+
+
+class Block:
+    """The table of one document: its name and (name, type, values) per
+    column, with None for NA."""
+
+    def __init__(self, document, rows, columns):
+        self.document = document
+        self.rows = rows
+        self.columns = columns
+
+
+class Truncated(Exception):
+    """The file ends in the middle of a block."""
+
+
+class Reader:
+    def __init__(self, data, pos, order):
+        self.data = data
+        self.pos = pos
+        self.order = order
+
+    def take(self, size):
+        if self.pos + size > len(self.data):
+            raise Truncated()
+        part = self.data[self.pos:self.pos + size]
+        self.pos += size
+        return part
+
+    def number(self, fmt, count=None):
+        if count is None:
+            return struct.unpack(self.order + fmt, self.take(struct.calcsize(fmt)))[0]
+        return list(struct.unpack("%s%d%s" % (self.order, count, fmt),
+                                  self.take(count * struct.calcsize(fmt))))
+
+    def string(self):
+        return self.take(self.number("I")).decode("utf-8")
+
+
+def block(reader):
+    document = reader.string()
+    rows = reader.number("Q")
+    columns = []
+    for _ in range(reader.number("I")):
+        name = reader.string()
+        kind = reader.number("B")
+        if kind == INT:
+            values = [None if v == INT_NA else v for v in reader.number("q", rows)]
+        elif kind == REAL:
+            values = [None if math.isnan(v) else v for v in reader.number("d", rows)]
+        elif kind == TEXT:
+            words = [reader.string() for _ in range(reader.number("I"))]
+            values = [None if c == TEXT_NA else words[c] for c in reader.number("I", rows)]
+        else:
+            raise ValueError("unknown type %d of column %s in %s" % (kind, name, document))
+        columns.append((name, kind, values))
+    return Block(document, rows, columns)
+
+
+def load(path):
+    if path.endswith(".gz"):
+        with gzip.open(path, "rb") as f:
+            return f.read()
+    if path.endswith(".zst"):
+        import zstandard
+        with open(path, "rb") as f:
+            # every block is a frame of its own
+            return zstandard.ZstdDecompressor().stream_reader(f, read_across_frames=True).read()
+    with open(path, "rb") as f:
+        return f.read()
+
+
+def read(path, truncated=None):
+    """The blocks of a file. A truncated block at the end is left out, and
+    reported in truncated[0] when a list is given."""
+    data = load(path)
+    blocks = []
+    pos = 0
+    while pos < len(data):
+        try:
+            if data[pos:pos + 4] != b"TSCB":
+                raise ValueError("%s: no block at byte %d" % (path, pos))
+            if len(data) < pos + 16:
+                raise Truncated()
+            order = "<" if struct.unpack("<I", data[pos + 4:pos + 8])[0] == 1 else ">"
+            version, size = struct.unpack(order + "IQ", data[pos + 4:pos + 16])
+            if version != 1:
+                raise ValueError("%s: unknown version %d" % (path, version))
+            end = pos + 16 + size
+            if end > len(data):
+                raise Truncated()
+            reader = Reader(data[:end], pos + 16, order)
+            blocks.append(block(reader))
+            if reader.pos != end:
+                raise ValueError("%s: the block at byte %d has the wrong size" % (path, pos))
+            pos = end
+        except Truncated:
+            if truncated is not None:
+                truncated[:] = [True]
+            break
+    return blocks
+
+
+def csv_value(kind, value):
+    if value is None:
+        return "NA"
+    if kind == REAL:
+        return "%#g" % value
+    return str(value)
+
+
+def main():
+    if len(sys.argv) != 2:
+        sys.exit("usage: readcolumns.py <file>.tcol[.gz|.zst]")
+    truncated = []
+    out = csv.writer(sys.stdout, lineterminator="\n")
+    for b in read(sys.argv[1], truncated):
+        print("# " + b.document)
+        out.writerow([name for name, _, _ in b.columns])
+        for row in range(b.rows):
+            out.writerow([csv_value(kind, values[row]) for _, kind, values in b.columns])
+    if truncated:
+        print("the last block is truncated", file=sys.stderr)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,127 @@
+#!/usr/bin/env python3
+"""
+Tests the columnar output of 'tscan --columns' against its CSV output,
+with the stand-ins of bench/replay.py for the services: every block,
+read back with readcolumns.py, must hold the tables of the CSV files of
+its document. Two runs append to the same files at the same time.
+"""
+import csv
+import gzip
+import io
+import os
+import shutil
+import subprocess
+import sys
+import tempfile
+
+HERE = os.path.dirname(os.path.abspath(__file__))
+TESTS = os.path.join(HERE, os.pardir)
+sys.path.insert(0, os.path.join(TESTS, "bench"))
+import replay  # noqa: E402
+import readcolumns  # noqa: E402
+
+PORTS = {"frog": 17001, "alpino": 17003, "wopr_fwd": 17020, "wopr_bwd": 17002,
+         "compound": 17005}
+LEVELS = ("document", "paragraphs", "sentences", "words")
+EXAMPLES = ("afk.example", "mtld.example", "d1.example")
+
+failures = 0
+
+
+def check(name, ok, detail=""):
+    global failures
+    if ok:
+        print("%-40s \033[1;32m OK  \033[0m" % name)
+    else:
+        failures += 1
+        print("%-40s \033[1;31m  FAILED  \033[0m %s" % (name, detail))
+
+
+def run(tscan, inputs, prefix, workdir, compress="none"):
+    log = open(os.path.join(workdir, os.path.basename(prefix) + ".log"), "a")
+    return subprocess.Popen([tscan, "--config=" + os.path.join(TESTS, "bench", "bench.cfg"),
+                             "--columns=" + prefix, "--compress=" + compress] + inputs,
+                            cwd=TESTS, stdout=log, stderr=log)
+
+
+def read_csv(name):
+    opener = gzip.open if name.endswith(".gz") else open
+    with opener(name, "rb") as f:
+        return list(csv.reader(io.StringIO(f.read().decode("utf-8"))))
+
+
+def same(kind, value, cell):
+    """Whether a value read back is the one written in the CSV."""
+    if kind == readcolumns.REAL and value is not None and cell != "NA":
+        return abs(float(cell) - value) <= 1e-5 * max(1.0, abs(value))
+    return readcolumns.csv_value(kind, value) == cell
+
+
+def compare(block, table):
+    """The first difference between a block and a CSV table, or None."""
+    header = [name for name, _, _ in block.columns]
+    if header != table[0]:
+        return "the columns differ"
+    if block.rows != len(table) - 1:
+        return "%d rows, the CSV has %d" % (block.rows, len(table) - 1)
+    for c, (name, kind, values) in enumerate(block.columns):
+        for row in range(block.rows):
+            if not same(kind, values[row], table[row + 1][c]):
+                return "%s row %d: %r, the CSV has %r" % (name, row + 1, values[row],
+                                                         table[row + 1][c])
+    return None
+
+
+def roundtrip(name, prefix, inputs, extension):
+    for level, suffix in enumerate(LEVELS):
+        truncated = []
+        blocks = readcolumns.read("%s.%s.tcol%s" % (prefix, suffix, extension), truncated)
+        check("%s %s blocks" % (name, suffix),
+              sorted(b.document for b in blocks) == sorted(inputs) and not truncated,
+              repr([b.document for b in blocks]))
+        for b in blocks:
+            problem = compare(b, read_csv("%s.%s.csv%s" % (b.document, suffix, extension)))
+            check("%s %s %s" % (name, suffix, os.path.basename(b.document)),
+                  problem is None, problem or "")
+
+
+def main():
+    tscan = os.path.join(os.environ.get("tscan_bin", os.path.join(TESTS, os.pardir, "src")),
+                         "tscan")
+    if not os.access(tscan, os.X_OK):
+        sys.exit("no tscan at " + tscan + ", set tscan_bin")
+    replay.start(PORTS, None)
+    workdir = tempfile.mkdtemp(prefix="tscan-columns-")
+    inputs = []
+    for example in EXAMPLES:
+        inputs.append(os.path.join(workdir, example))
+        shutil.copy(os.path.join(TESTS, example), inputs[-1])
+
+    # two runs append to the same files at once
+    plain = os.path.join(workdir, "plain")
+    runs = [run(tscan, inputs[:2], plain, workdir), run(tscan, inputs[2:], plain, workdir)]
+    check("columns runs", all(r.wait() == 0 for r in runs))
+    roundtrip("columns", plain, inputs, "")
+
+    packed = os.path.join(workdir, "packed")
+    check("columns gz run", run(tscan, inputs, packed, workdir, "gz").wait() == 0)
+    roundtrip("columns gz", packed, inputs, ".gz")
+
+    # a run that was killed while writing
+    cut = os.path.join(workdir, "cut.tcol")
+    with open(plain + ".words.tcol", "rb") as f:
+        data = f.read()
+    with open(cut, "wb") as f:
+        f.write(data[:-10])
+    truncated = []
+    blocks = readcolumns.read(cut, truncated)
+    check("columns truncated block", len(blocks) == len(inputs) - 1 and truncated == [True])
+
+    if failures:
+        print("the output is in " + workdir)
+        sys.exit(1)
+    shutil.rmtree(workdir)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,112 @@
+#!/usr/bin/env python3
+"""
+Tests that selecting metric groups with --groups doesn't change their
+columns, with the stand-ins of bench/replay.py for the services: for
+every group, the CSV files of a run with only that group must hold the
+same values as those of a run with all groups. A group that misses an
+analysis it needs, which --groups then skips, fails here.
+"""
+import csv
+import os
+import shutil
+import subprocess
+import sys
+import tempfile
+
+HERE = os.path.dirname(os.path.abspath(__file__))
+TESTS = os.path.join(HERE, os.pardir)
+sys.path.insert(0, os.path.join(TESTS, "bench"))
+import replay  # noqa: E402
+
+PORTS = {"frog": 17001, "alpino": 17003, "wopr_fwd": 17020, "wopr_bwd": 17002,
+         "compound": 17005}
+GROUPS = ("topPredictors", "wordDifficulties", "compound", "sentDifficulties",
+          "informationDensity", "coherence", "concreet", "persoonlijkheid", "verb",
+          "imperative", "wordSort", "prepPhrase", "intens", "formal", "misc")
+LEVELS = ("document", "paragraphs", "sentences", "words")
+# with compounds the noun lexicon lacks, separable verbs and names
+EXAMPLES = ("concreet1.example", "gebeuren_conc.example", "svp.example", "afk.example")
+
+failures = 0
+
+
+def check(name, ok, detail=""):
+    global failures
+    if ok:
+        print("%-40s \033[1;32m OK  \033[0m" % name)
+    else:
+        failures += 1
+        print("%-40s \033[1;31m  FAILED  \033[0m %s" % (name, detail))
+
+
+def run(tscan, workdir, name, groups):
+    """Starts tscan on copies of the examples in their own directory."""
+    directory = os.path.join(workdir, name)
+    os.mkdir(directory)
+    inputs = []
+    for example in EXAMPLES:
+        inputs.append(os.path.join(directory, example))
+        shutil.copy(os.path.join(TESTS, example), inputs[-1])
+    log = open(os.path.join(directory, "tscan.log"), "w")
+    return subprocess.Popen([tscan, "--config=" + os.path.join(TESTS, "bench", "bench.cfg"),
+                             "--groups=" + groups] + inputs,
+                            cwd=TESTS, stdout=log, stderr=log)
+
+
+def table(workdir, name, example, level):
+    with open(os.path.join(workdir, name, "%s.%s.csv" % (example, level)),
+              encoding="utf-8") as f:
+        rows = list(csv.reader(f))
+    return rows[0], rows[1:]
+
+
+def compare(full, part):
+    """The first column of the group that differs from the full run, or None."""
+    header, rows = part
+    full_header, full_rows = full
+    if len(rows) != len(full_rows):
+        return "%d rows, with all groups %d" % (len(rows), len(full_rows))
+    for c, name in enumerate(header):
+        if name == "Inputfile":
+            continue
+        if name not in full_header:
+            return "no column " + name + " with all groups"
+        f = full_header.index(name)
+        for r, row in enumerate(rows):
+            if row[c] != full_rows[r][f]:
+                return "%s row %d: %s, with all groups %s" % (name, r + 1, row[c],
+                                                             full_rows[r][f])
+    return None
+
+
+def main():
+    tscan = os.path.join(os.environ.get("tscan_bin", os.path.join(TESTS, os.pardir, "src")),
+                         "tscan")
+    if not os.access(tscan, os.X_OK):
+        sys.exit("no tscan at " + tscan + ", set tscan_bin")
+    replay.start(PORTS, None)
+    workdir = tempfile.mkdtemp(prefix="tscan-groups-")
+    runs = {"all": run(tscan, workdir, "all", "all")}
+    for group in GROUPS:
+        runs[group] = run(tscan, workdir, group, group)
+    for name, process in runs.items():
+        if process.wait() != 0:
+            check("groups run " + name, False, "see " + os.path.join(workdir, name))
+    if failures == 0:
+        for group in GROUPS:
+            problems = []
+            for example in EXAMPLES:
+                for level in LEVELS:
+                    problem = compare(table(workdir, "all", example, level),
+                                      table(workdir, group, example, level))
+                    if problem:
+                        problems.append("%s %s: %s" % (example, level, problem))
+            check("groups " + group, not problems, "; ".join(problems[:3]))
+    if failures:
+        print("the output is in " + workdir)
+        sys.exit(1)
+    shutil.rmtree(workdir)
+
+
+if __name__ == "__main__":
+    main()
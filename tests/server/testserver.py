@@ -0,0 +1,160 @@
+#!/usr/bin/env python3
+"""
+Tests the request/reply protocol of 'tscan --serve' (see server.h), with
+the stand-ins of bench/replay.py for the services: replies to valid and
+invalid requests, over a unix socket and over TCP, and that a TCP server
+only listens on the loopback interface.
+"""
+import os
+import shutil
+import socket
+import subprocess
+import sys
+import tempfile
+import time
+
+HERE = os.path.dirname(os.path.abspath(__file__))
+TESTS = os.path.join(HERE, os.pardir)
+sys.path.insert(0, os.path.join(TESTS, "bench"))
+import replay  # noqa: E402
+
+PORTS = {"frog": 17001, "alpino": 17003, "wopr_fwd": 17020, "wopr_bwd": 17002,
+         "compound": 17005}
+TCP_PORT = 17100
+
+failures = 0
+
+
+def check(name, ok, detail=""):
+    global failures
+    if ok:
+        print("%-40s \033[1;32m OK  \033[0m" % name)
+    else:
+        failures += 1
+        print("%-40s \033[1;31m  FAILED  \033[0m %s" % (name, detail))
+
+
+def start(tscan, address, workdir):
+    log = open(os.path.join(workdir, "server-%s.log" % os.path.basename(address)), "w")
+    return subprocess.Popen([tscan, "--config=" + os.path.join(TESTS, "bench", "bench.cfg"),
+                             "--serve=" + address, "--workers=2"],
+                            cwd=TESTS, stdout=log, stderr=log)
+
+
+def connect(address):
+    if address.isdigit():
+        return socket.create_connection(("127.0.0.1", int(address)))
+    sock = socket.socket(socket.AF_UNIX, socket.SOCK_STREAM)
+    sock.connect(address)
+    return sock
+
+
+def wait(server, address):
+    """Waits until the server accepts connections, while it loads the lexicons."""
+    for _ in range(600):
+        if server.poll() is not None:
+            return False
+        try:
+            connect(address).close()
+            return True
+        except OSError:
+            time.sleep(0.1)
+    return False
+
+
+def request(address, lines):
+    with connect(address) as sock:
+        sock.sendall(("".join(line + "\n" for line in lines) + "\n").encode("utf-8"))
+        reply = b""
+        while True:
+            data = sock.recv(65536)
+            if not data:
+                break
+            reply += data
+    return reply.decode("utf-8")
+
+
+def outputs(reply):
+    return [line[len("output="):] for line in reply.split("\n") if line.startswith("output=")]
+
+
+def protocol(address, workdir):
+    name = "serve " + ("tcp" if address.isdigit() else "socket")
+    text = os.path.join(workdir, "%s.example" % name.replace(" ", "-"))
+    shutil.copy(os.path.join(TESTS, "afk.example"), text)
+
+    reply = request(address, ["input=" + text, "csv=0"])
+    check(name + " analyse", reply == "OK\noutput=%s.tscan.xml\n\n" % text
+          and os.path.exists(text + ".tscan.xml"), repr(reply))
+
+    folia = os.path.join(workdir, name.replace(" ", "-") + ".xml")
+    reply = request(address, ["input=" + text, "output=" + folia, "csv=1"])
+    files = outputs(reply)
+    check(name + " output and tables", reply.startswith("OK\n") and reply.endswith("\n\n")
+          and len(files) > 1 and files[0] == folia
+          and all(os.path.exists(f) for f in files), repr(reply))
+
+    reply = request(address, ["csv=1"])
+    check(name + " missing input", reply == "ERROR missing 'input'\n\n", repr(reply))
+
+    reply = request(address, ["input=" + text, "nonsense"])
+    check(name + " invalid line", reply == "ERROR invalid request line 'nonsense'\n\n",
+          repr(reply))
+
+    reply = request(address, ["input=" + text, "csv=maybe"])
+    check(name + " invalid csv", reply == "ERROR invalid value for 'csv': maybe\n\n",
+          repr(reply))
+
+    reply = request(address, ["input=" + os.path.join(workdir, "missing.example")])
+    check(name + " missing file", reply.startswith("ERROR ") and reply.endswith("\n\n"),
+          repr(reply))
+
+
+def listens_on_loopback_only(port):
+    """Whether /proc/net/tcp lists the port as listening on 127.0.0.1 only."""
+    if not os.path.exists("/proc/net/tcp"):
+        return True
+    local = set()
+    with open("/proc/net/tcp") as f:
+        for line in f.readlines()[1:]:
+            fields = line.split()
+            host, hexport = fields[1].split(":")
+            if int(hexport, 16) == port and fields[3] == "0A":  # LISTEN
+                local.add(host)
+    return local == {"0100007F"}
+
+
+def main():
+    tscan = os.path.join(os.environ.get("tscan_bin", os.path.join(TESTS, os.pardir, "src")),
+                         "tscan")
+    if not os.access(tscan, os.X_OK):
+        sys.exit("no tscan at " + tscan + ", set tscan_bin")
+    replay.start(PORTS, None)
+    workdir = tempfile.mkdtemp(prefix="tscan-server-")
+    servers = []
+    try:
+        for address in (os.path.join(workdir, "tscan.sock"), str(TCP_PORT)):
+            server = start(tscan, address, workdir)
+            servers.append(server)
+            if not wait(server, address):
+                check("serve " + address, False, "the server didn't start, see " + workdir)
+                continue
+            protocol(address, workdir)
+        check("serve tcp on loopback only", listens_on_loopback_only(TCP_PORT))
+
+        bad = subprocess.run([tscan, "--config=" + os.path.join(TESTS, "bench", "bench.cfg"),
+                              "--serve=99999"], cwd=TESTS,
+                             stdout=subprocess.DEVNULL, stderr=subprocess.DEVNULL)
+        check("serve invalid port", bad.returncode != 0)
+    finally:
+        for server in servers:
+            server.kill()
+            server.wait()
+    if failures:
+        print("the logs are in " + workdir)
+        sys.exit(1)
+    shutil.rmtree(workdir)
+
+
+if __name__ == "__main__":
+    main()